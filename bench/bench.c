@@ -0,0 +1,355 @@
+#define _POSIX_C_SOURCE 199309L
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "bmi270.h"
+#include "bmi270_codec.h"
+#include "bmi270_spectrum.h"
+#include "bmi270_strapdown.h"
+#include "bmi270_pool.h"
+#include "bmi270_sim.h"
+
+#define NUM_RUNS 5                      // Repetitions per benchmark, median is reported
+#define CODEC_SAMPLES 200               // Samples per codec block (1 s at 200 Hz)
+#define CODEC_CHANNELS 6                // Acc + gyr
+
+/* ----------------------------------------------------
+                    HELPER FUNCTIONS
+-----------------------------------------------------*/
+
+struct result
+{
+    const char *name;
+    long iterations;
+    double ns_per_call;
+    double ns_min;
+    double transactions_per_call;
+    double bytes_per_call;
+};
+
+static double now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static int compare_double(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+
+    return (x > y) - (x < y);
+}
+
+static volatile double sink;
+
+static void bench_acc_raw(struct bmi270 *sensor, long n)
+{
+    int16_t x, y, z;
+
+    for (long i = 0; i < n; i++)
+    {
+        get_acc_raw(sensor, &x, &y, &z);
+        sink = x + y + z;
+    }
+}
+
+static void bench_gyr_raw(struct bmi270 *sensor, long n)
+{
+    int16_t x, y, z;
+
+    for (long i = 0; i < n; i++)
+    {
+        get_gyr_raw(sensor, &x, &y, &z);
+        sink = x + y + z;
+    }
+}
+
+static void bench_acc_gyr_raw(struct bmi270 *sensor, long n)
+{
+    int16_t acc[3], gyr[3];
+
+    for (long i = 0; i < n; i++)
+    {
+        get_acc_raw(sensor, &acc[0], &acc[1], &acc[2]);
+        get_gyr_raw(sensor, &gyr[0], &gyr[1], &gyr[2]);
+        sink = acc[0] + gyr[0];
+    }
+}
+
+static void bench_convert(struct bmi270 *sensor, long n)
+{
+    int16_t raw[3] = {1234, -2345, 16384};
+    double acc[3], gyr[3];
+
+    for (long i = 0; i < n; i++)
+    {
+        raw[0] = (int16_t)i;
+        convert_acc_raw(sensor, raw, acc);
+        convert_gyr_raw(sensor, raw, gyr);
+        sink = acc[0] + gyr[0];
+    }
+}
+
+static void bench_load_config(struct bmi270 *sensor, long n)
+{
+    struct bmi270_sim *sim = sensor->bus_ctx;
+
+    for (long i = 0; i < n; i++)
+    {
+        sim->regs[INTERNAL_STATUS] = 0x00;
+        load_config_file(sensor);
+    }
+}
+
+static void bench_apply_config(struct bmi270 *sensor, long n)
+{
+    for (long i = 0; i < n; i++)
+    {
+        set_mode(sensor, PERFORMANCE_MODE);
+        set_acc_range(sensor, ACC_RANGE_2G);
+        set_gyr_range(sensor, GYR_RANGE_1000);
+        set_acc_odr(sensor, ACC_ODR_200);
+        set_gyr_odr(sensor, GYR_ODR_200);
+        set_acc_bwp(sensor, ACC_BWP_OSR4);
+        set_gyr_bwp(sensor, GYR_BWP_OSR4);
+        disable_fifo_header(sensor);
+        enable_data_streaming(sensor);
+        enable_acc_filter_perf(sensor);
+        enable_gyr_noise_perf(sensor);
+        enable_gyr_filter_perf(sensor);
+    }
+}
+
+static struct bmi270_pool pool;
+
+static void bench_batch_share(struct bmi270 *sensor, long n)
+{
+    struct bmi270_sample sample = {.flags = SAMPLE_VALID};
+
+    for (long i = 0; i < n; i++)
+    {
+        struct bmi270_batch *batch = bmi270_pool_acquire(&pool);
+
+        // Fill from the bus, hand to two sinks, both release
+        while (batch->count < batch->capacity && get_acc_gyr_raw(sensor, sample.acc, sample.gyr) == 0)
+            bmi270_batch_push(batch, &sample);
+
+        bmi270_batch_ref(batch);
+        bmi270_batch_unref(batch);
+        bmi270_batch_unref(batch);
+        sink = batch->count;
+    }
+}
+
+static struct bmi270_codec codec;
+static int16_t codec_samples[CODEC_SAMPLES * CODEC_CHANNELS];
+static uint8_t codec_block[CODEC_HEADER_SIZE + CODEC_CHANNELS * (CODEC_CHANNEL_SIZE + 2 * CODEC_SAMPLES)];
+static int codec_block_len;
+
+static void bench_codec_encode(struct bmi270 *sensor, long n)
+{
+    (void)sensor;
+
+    for (long i = 0; i < n; i++)
+    {
+        codec_block_len = bmi270_codec_encode(&codec, codec_samples, CODEC_SAMPLES, CODEC_CHANNELS, codec_block, sizeof(codec_block));
+        sink = codec_block_len;
+    }
+}
+
+static void bench_codec_decode(struct bmi270 *sensor, long n)
+{
+    int16_t samples[CODEC_SAMPLES * CODEC_CHANNELS];
+    uint16_t count;
+    uint8_t channels;
+
+    (void)sensor;
+
+    for (long i = 0; i < n; i++)
+    {
+        bmi270_codec_decode(&codec, codec_block, codec_block_len, samples, CODEC_SAMPLES * CODEC_CHANNELS, &count, &channels);
+        sink = samples[i % (CODEC_SAMPLES * CODEC_CHANNELS)];
+    }
+}
+
+static void bench_strapdown(struct bmi270 *sensor, long n)
+{
+    struct bmi270_strapdown sd;
+    struct bmi270_strapdown_output out;
+    struct bmi270_sample sample = {.flags = SAMPLE_VALID, .acc = {120, -80, 16384}, .gyr = {300, -200, 100}};
+
+    bmi270_strapdown_init(&sd, sensor, 10.0);
+
+    for (long i = 0; i < n; i++)
+    {
+        sample.gyr[0] = (int16_t)i;
+
+        if (bmi270_strapdown_update_sample(&sd, &sample, &out))
+            sink = out.delta_angle[0];
+    }
+}
+
+static struct bmi270_spectrum spectrum;
+
+static void bench_spectrum_fft(struct bmi270 *sensor, long n)
+{
+    float re[1024], im[1024];
+
+    (void)sensor;
+
+    for (long i = 0; i < n; i++)
+    {
+        for (int k = 0; k < 1024; k++)
+        {
+            re[k] = (float)((k * 7 + i) % 64) - 32.0f;
+            im[k] = 0.0f;
+        }
+
+        bmi270_spectrum_fft(&spectrum, re, im);
+        sink = re[i % 1024];
+    }
+}
+
+static struct result run(const char *name, struct bmi270 *sensor, void (*fn)(struct bmi270 *, long), long n)
+{
+    struct bmi270_sim *sim = sensor->bus_ctx;
+    struct result result = {.name = name, .iterations = n};
+    double times[NUM_RUNS];
+    uint64_t transactions, bytes;
+
+    // Warm up
+    fn(sensor, n / 10 + 1);
+
+    transactions = sim->transactions;
+    bytes = sim->bytes_read + sim->bytes_written;
+
+    for (int r = 0; r < NUM_RUNS; r++)
+    {
+        double start = now_ns();
+        fn(sensor, n);
+        times[r] = (now_ns() - start) / (double)n;
+    }
+
+    qsort(times, NUM_RUNS, sizeof(double), compare_double);
+
+    result.ns_per_call = times[NUM_RUNS / 2];
+    result.ns_min = times[0];
+    result.transactions_per_call = (double)(sim->transactions - transactions) / (double)(n * NUM_RUNS);
+    result.bytes_per_call = (double)(sim->bytes_read + sim->bytes_written - bytes) / (double)(n * NUM_RUNS);
+
+    return result;
+}
+
+static void report(FILE *out, const struct result *r)
+{
+    fprintf(out, "{\"name\": \"%s\", \"iterations\": %ld, \"ns_per_call\": %.1f, \"ns_min\": %.1f, \"transactions_per_call\": %.2f, \"bytes_per_call\": %.1f}\n",
+            r->name, r->iterations, r->ns_per_call, r->ns_min, r->transactions_per_call, r->bytes_per_call);
+}
+
+/* ----------------------------------------------------
+                        MAIN
+-----------------------------------------------------*/
+
+int main(int argc, char **argv)
+{
+    const char *output = "bench_output.txt";
+    long scale = 1;
+    FILE *out;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+            output = argv[++i];
+        else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+            scale = atol(argv[++i]);
+        else
+        {
+            printf("Usage: %s [-o output_file|-] [-s iteration_scale]\n", argv[0]);
+            return -1;
+        }
+    }
+
+    if (strcmp(output, "-") == 0)
+        out = stdout;
+    else if ((out = fopen(output, "w")) == NULL)
+    {
+        printf("ERROR: Could not open %s\n", output);
+        return -1;
+    }
+
+    struct bmi270_sim sim;
+    struct bmi270 sensor = {.i2c_addr = I2C_PRIM_ADDR};
+
+    bmi270_sim_init(&sim);
+    bmi270_sim_attach(&sensor, &sim);
+
+    if (bmi270_init(&sensor) < 0)
+    {
+        printf("ERROR: Simulated sensor failed to initialize\n");
+        return -1;
+    }
+
+    set_acc_range(&sensor, ACC_RANGE_2G);
+    set_gyr_range(&sensor, GYR_RANGE_1000);
+
+    // 200 Hz, 10 ms batches: two samples per batch
+    struct bmi270 *sensors[] = {&sensor};
+    struct bmi270_pool_config pool_config;
+
+    set_acc_odr(&sensor, ACC_ODR_200);
+    set_gyr_odr(&sensor, GYR_ODR_200);
+    bmi270_pool_config(&pool_config, sensors, 1, 10000, 8);
+
+    if (bmi270_pool_init(&pool, &pool_config, NULL, 0) < 0)
+    {
+        printf("ERROR: Sample pool failed to initialize\n");
+        return -1;
+    }
+
+    // Sensor-like codec input: slow motion plus a few LSB of noise
+    for (int i = 0; i < CODEC_SAMPLES * CODEC_CHANNELS; i++)
+    {
+        codec_samples[i] = (int16_t)(4000.0 * sin(0.02 * i / CODEC_CHANNELS + i % CODEC_CHANNELS) + rand() % 16 - 8);
+    }
+
+    codec_block_len = bmi270_codec_encode(&codec, codec_samples, CODEC_SAMPLES, CODEC_CHANNELS, codec_block, sizeof(codec_block));
+
+    struct bmi270_spectrum_config spectrum_config;
+
+    bmi270_spectrum_defaults(&spectrum_config);
+    bmi270_spectrum_init(&spectrum, &sensor, &spectrum_config);
+
+    struct result results[] = {
+        run("get_acc_raw", &sensor, bench_acc_raw, 200000 * scale),
+        run("get_gyr_raw", &sensor, bench_gyr_raw, 200000 * scale),
+        run("sample_acc_gyr_raw", &sensor, bench_acc_gyr_raw, 100000 * scale),
+        run("convert_acc_gyr", &sensor, bench_convert, 1000000 * scale),
+        run("apply_config", &sensor, bench_apply_config, 2000 * scale),
+        run("load_config_file", &sensor, bench_load_config, 2 * scale),
+        run("batch_fill_share", &sensor, bench_batch_share, 100000 * scale),
+        run("codec_encode_200x6", &sensor, bench_codec_encode, 20000 * scale),
+        run("codec_decode_200x6", &sensor, bench_codec_decode, 20000 * scale),
+        run("spectrum_fft_1024", &sensor, bench_spectrum_fft, 20000 * scale),
+        run("strapdown_update", &sensor, bench_strapdown, 1000000 * scale),
+    };
+
+    for (size_t i = 0; i < sizeof(results) / sizeof(results[0]); i++)
+    {
+        report(out, &results[i]);
+    }
+
+    if (out != stdout)
+    {
+        fclose(out);
+        printf("Benchmark results written to %s\n", output);
+    }
+
+    return 0;
+}
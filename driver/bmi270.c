@@ -1,19 +1,139 @@
+#include <errno.h>
 #include <fcntl.h>
 #include <linux/i2c.h>
 #include <linux/i2c-dev.h>
+#include <stdarg.h>
 #include <stdio.h>
 #include <sys/ioctl.h>
 #include <unistd.h>
 #include <string.h>
 
 #include "bmi270.h"
+#include "bmi270_config_file.h"
+#include "bmi270_regs.h"
+#include "bmi270_stats.h"
 
-extern const uint8_t bmi270_config_file[];
+static bmi270_log_handler log_handler = NULL;
+static uint8_t log_level = BMI270_LOG_OFF;
+static void *log_ctx = NULL;
 
 /* ----------------------------------------------------
                      FUNCTIONS
 -----------------------------------------------------*/
 
+void bmi270_set_log_handler(bmi270_log_handler handler, uint8_t level, void *ctx)
+{
+    log_handler = handler;
+    log_level = handler ? level : BMI270_LOG_OFF;
+    log_ctx = ctx;
+}
+
+void bmi270_log_print(uint8_t level, const char *message, void *ctx)
+{
+    FILE *out = ctx ? (FILE *)ctx : stdout;
+
+    if (level == BMI270_LOG_ERROR)
+        fprintf(out, "Error: %s\n", message);
+    else
+        fprintf(out, "%s\n", message);
+}
+
+void bmi270_log(uint8_t level, const char *format, ...)
+{
+    char message[256];
+    va_list args;
+
+    // Nothing is formatted unless a handler wants the message
+    if (level > log_level)
+        return;
+
+    va_start(args, format);
+    vsnprintf(message, sizeof(message), format, args);
+    va_end(args);
+
+    log_handler(level, message, log_ctx);
+}
+
+static int set_error(struct bmi270 *sensor, int code, uint8_t reg)
+{
+    sensor->last_error = code;
+    sensor->last_error_reg = reg;
+    sensor->error_count++;
+
+    return code;
+}
+
+int bmi270_get_last_error(struct bmi270 *sensor, uint8_t *reg)
+{
+    if (reg)
+        *reg = sensor->last_error_reg;
+
+    return sensor->last_error;
+}
+
+int bmi270_set_error(struct bmi270 *sensor, int code, uint8_t reg)
+{
+    return set_error(sensor, code, reg);
+}
+
+void bmi270_clear_error(struct bmi270 *sensor)
+{
+    sensor->last_error = 0;
+    sensor->last_error_reg = 0;
+}
+
+static inline int bus_transfer(struct bmi270 *sensor, struct i2c_rdwr_ioctl_data *i2c_data)
+{
+    if (sensor->transfer)
+        return sensor->transfer(sensor, i2c_data->msgs, i2c_data->nmsgs);
+
+    return ioctl(sensor->i2c_fd, I2C_RDWR, i2c_data) < 0 ? -errno : 0;
+}
+
+static int i2c_attempt(struct bmi270 *sensor, struct i2c_rdwr_ioctl_data *i2c_data, uint8_t op, uint32_t bytes)
+{
+    uint64_t start;
+    int result;
+
+    if (!sensor->stats)
+        return bus_transfer(sensor, i2c_data);
+
+    start = bmi270_stats_now();
+    result = bus_transfer(sensor, i2c_data);
+    bmi270_stats_record(sensor->stats, op, bytes, bmi270_stats_now() - start, result < 0);
+
+    return result;
+}
+
+static int i2c_transfer(struct bmi270 *sensor, struct i2c_rdwr_ioctl_data *i2c_data, uint8_t op, uint32_t bytes)
+{
+    uint8_t retries = sensor->max_retries < MAX_RETRIES ? sensor->max_retries : MAX_RETRIES;
+    int result = i2c_attempt(sensor, i2c_data, op, bytes);
+
+    // Short, bounded backoff: a glitch must not stall the acquisition loop
+    for (uint8_t i = 0; result < 0 && i < retries; i++)
+    {
+        usleep(RETRY_DELAY_US << i);
+
+        if (sensor->stats)
+            bmi270_stats_retry(sensor->stats);
+
+        result = i2c_attempt(sensor, i2c_data, op, bytes);
+    }
+
+    return result;
+}
+
+static int transfer_failed(struct bmi270 *sensor, int result, uint8_t reg_addr, const char *what)
+{
+    // Custom transfers may just return -1
+    int code = (result < -1) ? result : -EIO;
+
+    bmi270_log(BMI270_LOG_ERROR, "0x%X --> Failed to %s I2C device (register 0x%X: %s)", sensor->i2c_addr, what, reg_addr, strerror(-code));
+
+    return set_error(sensor, code, reg_addr);
+}
+
 void print_binary(uint8_t num)
 {
     for (int i = 7; i >= 0; i--)
@@ -23,13 +143,13 @@ void print_binary(uint8_t num)
     printf("\n");
 }
 
-uint8_t read_register(struct bmi270 *sensor, uint8_t reg_addr)
+int read_register(struct bmi270 *sensor, uint8_t reg_addr, uint8_t *value)
 {
-    uint8_t result = 0;
     struct i2c_rdwr_ioctl_data i2c_data;
     struct i2c_msg i2c_msg[2];
-    char write_buf[1] = {reg_addr};
-    char read_buf[1] = {0};
+    uint8_t write_buf[1] = {reg_addr};
+    uint8_t read_buf[1] = {0};
+    int result;
 
     // Setup I2C write operation to send register address to device
     i2c_msg[0].addr = sensor->i2c_addr;
@@ -47,27 +167,21 @@ uint8_t read_register(struct bmi270 *sensor, uint8_t reg_addr)
     i2c_data.msgs = i2c_msg;
     i2c_data.nmsgs = 2;
 
-    // Send I2C transaction to read data from register    i2c_msg[0].addr = sensor->i2c_addr;
-    i2c_msg[0].flags = 0;
-    i2c_msg[0].len = sizeof(write_buf);
-    i2c_msg[0].buf = write_buf;
-    if (ioctl(sensor->i2c_fd, I2C_RDWR, &i2c_data) < 0)
-    {
-        printf("0x%X --> Failed to read from I2C device\n", sensor->i2c_addr);
-        return -1;
-    }
+    // Send I2C transaction to read data from register
+    if ((result = i2c_transfer(sensor, &i2c_data, STATS_OP_READ, 1)) < 0)
+        return transfer_failed(sensor, result, reg_addr, "read from");
 
-    // Combine the read buffer to an integer value
-    result = (uint8_t)read_buf[0];
+    *value = read_buf[0];
 
-    return result;
+    return 0;
 }
 
 int read_register_block(struct bmi270 *sensor, uint8_t reg_addr, uint8_t *data, uint8_t len)
 {
     struct i2c_rdwr_ioctl_data i2c_data;
     struct i2c_msg i2c_msg[2];
-    char write_buf[1] = {reg_addr};
+    uint8_t write_buf[1] = {reg_addr};
+    int result;
 
     // Setup I2C write operation to send register address to device
     i2c_msg[0].addr = sensor->i2c_addr;
@@ -86,11 +200,8 @@ int read_register_block(struct bmi270 *sensor, uint8_t reg_addr, uint8_t *data,
     i2c_data.nmsgs = 2;
 
     // Send I2C transaction to read data from registers
-    if (ioctl(sensor->i2c_fd, I2C_RDWR, &i2c_data) < 0)
-    {
-        printf("0x%X --> Failed to read from I2C device\n", sensor->i2c_addr);
-        return -1;
-    }
+    if ((result = i2c_transfer(sensor, &i2c_data, STATS_OP_READ_BLK, len)) < 0)
+        return transfer_failed(sensor, result, reg_addr, "read from");
 
     return 0;
 }
@@ -99,7 +210,8 @@ int write_register(struct bmi270 *sensor, uint8_t reg_addr, uint8_t value)
 {
     struct i2c_rdwr_ioctl_data i2c_data;
     struct i2c_msg i2c_msg[1];
-    char write_buf[2] = {reg_addr, value};
+    uint8_t write_buf[2] = {reg_addr, value};
+    int result;
 
     // Setup I2C write operation to send register address and data to device
     i2c_msg[0].addr = sensor->i2c_addr;
@@ -112,11 +224,8 @@ int write_register(struct bmi270 *sensor, uint8_t reg_addr, uint8_t value)
     i2c_data.nmsgs = 1;
 
     // Send I2C transaction to write data to register
-    if (ioctl(sensor->i2c_fd, I2C_RDWR, &i2c_data) < 0)
-    {
-        printf("0x%X --> Failed to write to I2C device\n", sensor->i2c_addr);
-        return -1;
-    }
+    if ((result = i2c_transfer(sensor, &i2c_data, STATS_OP_WRITE, 1)) < 0)
+        return transfer_failed(sensor, result, reg_addr, "write to");
 
     return 0;
 }
@@ -125,7 +234,11 @@ int write_register_block(struct bmi270 *sensor, uint8_t reg_addr, uint8_t len, c
 {
     struct i2c_rdwr_ioctl_data i2c_data;
     struct i2c_msg i2c_msg[1];
-    char write_buf[33] = {reg_addr};
+    uint8_t write_buf[33] = {reg_addr};
+    int result;
+
+    if (len > sizeof(write_buf) - 1)
+        return set_error(sensor, -EINVAL, reg_addr);
 
     for (int i = 0; i < len; i++)
     {
@@ -143,486 +256,1591 @@ int write_register_block(struct bmi270 *sensor, uint8_t reg_addr, uint8_t len, c
     i2c_data.nmsgs = 1;
 
     // Send I2C transaction to write data to register
-    if (ioctl(sensor->i2c_fd, I2C_RDWR, &i2c_data) < 0)
-    {
-        printf("0x%X --> Failed to write to I2C device\n", sensor->i2c_addr);
-        return -1;
-    }
+    if ((result = i2c_transfer(sensor, &i2c_data, STATS_OP_WRITE_BLK, len)) < 0)
+        return transfer_failed(sensor, result, reg_addr, "write to");
 
     return 0;
 }
 
-int load_config_file(struct bmi270 *sensor)
+int update_register(struct bmi270 *sensor, uint8_t reg_addr, uint8_t clear, uint8_t set)
 {
-    sensor->internal_status = read_register(sensor, INTERNAL_STATUS);
-
-    if (sensor->internal_status & 0x01)
-    {
-        printf("0x%x --> Already initialized!\n", sensor->i2c_addr);
-    }
-    else if (sensor->internal_status & 0x02)
-    {
-        printf("0x%x --> IMPORTANT: Sensor needs power cycle!\n", sensor->i2c_addr);
-    }
-    else
-    {
-        printf("0x%x --> Initializing...\n", sensor->i2c_addr);
-        write_register(sensor, PWR_CONF, 0x00);
-        usleep(450);
-        write_register(sensor, INIT_CTRL, 0x00);
-
-        for (int i = 0; i < 256; i++)
-        {
-            write_register(sensor, INIT_ADDR_0, 0x00);
-            write_register(sensor, INIT_ADDR_1, i);
-            write_register_block(sensor, INIT_DATA, 32, &bmi270_config_file[i * 32]);
-            usleep(20);
-        }
+    uint8_t value;
+    int result;
 
-        write_register(sensor, INIT_CTRL, 0x01);
-        usleep(20000);
+    if ((result = read_register(sensor, reg_addr, &value)) < 0)
+        return result;
 
-        sensor->internal_status = read_register(sensor, INTERNAL_STATUS);
-    }
+    return write_register(sensor, reg_addr, (value & ~clear) | set);
+}
 
-    printf("0x%x --> Initialization status: %x (1 --> OK)\n", sensor->i2c_addr, sensor->internal_status);
+static const uint8_t *config_data(struct bmi270 *sensor)
+{
+    return sensor->config_file ? sensor->config_file : bmi270_config_file;
 }
 
-int bmi270_init(struct bmi270 *sensor)
+uint32_t bmi270_crc32(const uint8_t *data, size_t len)
 {
-    // Open I2C bus
-    if ((sensor->i2c_fd = open(I2C_DEVICE, O_RDWR)) < 0)
-    {
-        printf("Error: Could not open I2C bus for %s\n", I2C_DEVICE);
-        return -1;
-    }
+    uint32_t crc = 0xFFFFFFFF;
 
-    // Set I2C address
-    if (ioctl(sensor->i2c_fd, I2C_SLAVE, sensor->i2c_addr) < 0)
+    // Bitwise CRC-32 (IEEE 802.3, reflected): only run once per upload, no table needed
+    for (size_t i = 0; i < len; i++)
     {
-        printf("Error: Could not set I2C address to 0x%X\n", sensor->i2c_addr);
-        close(sensor->i2c_fd);
-        return -1;
+        crc ^= data[i];
+
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+        }
     }
 
-    printf("0x%X --> I2C setup successfull!\n", sensor->i2c_addr);
+    return ~crc;
+}
 
-    // Check if chip ID matches
-    if ((sensor->chip_id = read_register(sensor, CHIP_ID_ADDRESS)) != BMI270_CHIP_ID)
+int bmi270_set_config_file(struct bmi270 *sensor, const uint8_t *data, uint32_t crc)
+{
+    if (data != NULL && bmi270_crc32(data, CONFIG_FILE_SIZE) != crc)
     {
-        printf("Error: Chip ID mismatch! --> CURRENT: 0x%X - BMI270: 0x%X\n", sensor->chip_id, BMI270_CHIP_ID);
-        return -1;
+        bmi270_log(BMI270_LOG_ERROR, "0x%X --> Config file CRC mismatch!", sensor->i2c_addr);
+        return set_error(sensor, -EBADMSG, INIT_DATA);
     }
 
-    printf("0x%X --> Chip ID: 0x%X\n", sensor->i2c_addr, sensor->chip_id);
-
-    load_config_file(sensor);
+    sensor->config_file = data;
+    sensor->config_crc = crc;
 
     return 0;
 }
 
-void set_mode(struct bmi270 *sensor, uint8_t mode)
+int bmi270_read_config_file(const char *path, uint8_t *data, uint32_t *crc)
 {
-    if (mode == LOW_POWER_MODE)
-    {
+    FILE *file;
+    size_t len;
+    int extra;
 
-        write_register(sensor, PWR_CTRL, 0x04);
-        write_register(sensor, ACC_CONF, 0x17);
-        write_register(sensor, GYR_CONF, 0x28);
-        write_register(sensor, PWR_CONF, 0x03);
-        sensor->acc_odr = 50;
-        sensor->gyr_odr = 100;
-        printf("0x%X --> Mode set to: LOW_POWER_MODE\n", sensor->i2c_addr);
-    }
-    else if (mode == NORMAL_MODE)
+    if ((file = fopen(path, "rb")) == NULL)
     {
-        write_register(sensor, PWR_CTRL, 0x0E);
-        write_register(sensor, ACC_CONF, 0xA8);
-        write_register(sensor, GYR_CONF, 0xA9);
-        write_register(sensor, PWR_CONF, 0x02);
-        sensor->acc_odr = 100;
-        sensor->gyr_odr = 200;
-        printf("0x%X --> Mode set to: NORMAL_MODE\n", sensor->i2c_addr);
+        bmi270_log(BMI270_LOG_ERROR, "Could not open config file %s", path);
+        return -errno;
     }
-    else if (mode == PERFORMANCE_MODE)
+
+    len = fread(data, 1, CONFIG_FILE_SIZE, file);
+    extra = fgetc(file);
+    fclose(file);
+
+    if (len != CONFIG_FILE_SIZE || extra != EOF)
     {
-        write_register(sensor, PWR_CTRL, 0x0E);
-        write_register(sensor, ACC_CONF, 0xA8);
-        write_register(sensor, GYR_CONF, 0xE9);
-        write_register(sensor, PWR_CONF, 0x02);
-        sensor->acc_odr = 100;
-        sensor->gyr_odr = 200;
-        printf("0x%X --> Mode set to: PERFORMANCE_MODE\n", sensor->i2c_addr);
+        bmi270_log(BMI270_LOG_ERROR, "Config file %s is not %d bytes", path, CONFIG_FILE_SIZE);
+        return -EINVAL;
     }
-    else
-        printf("0x%X --> Wrong sensor mode. Use 'LOWER_POWER_MODE', 'NORMAL_MODE' or 'PERFORMANCE_MODE'\n", sensor->i2c_addr);
-}
 
-void enable_aux(struct bmi270 *sensor)
-{
-    write_register(sensor, PWR_CTRL, (read_register(sensor, PWR_CTRL) | BIT_0));
-    printf("0x%X --> Auxiliary sensor enabled\n", sensor->i2c_addr);
-}
+    *crc = bmi270_crc32(data, CONFIG_FILE_SIZE);
 
-void disable_aux(struct bmi270 *sensor)
-{
-    write_register(sensor, PWR_CTRL, (read_register(sensor, PWR_CTRL) & ~BIT_0));
-    printf("0x%X --> Auxiliary sensor disabled\n", sensor->i2c_addr);
+    return 0;
 }
 
-void enable_acc(struct bmi270 *sensor)
+int load_config_start(struct bmi270 *sensor)
 {
-    write_register(sensor, PWR_CTRL, (read_register(sensor, PWR_CTRL) | BIT_1));
-    printf("0x%X --> Accelerometer enabled\n", sensor->i2c_addr);
+    int result;
+
+    if ((result = write_register(sensor, PWR_CONF, 0x00)) < 0)
+        return result;
+
+    usleep(450);
+
+    return write_register(sensor, INIT_CTRL, 0x00);
 }
 
-void disable_acc(struct bmi270 *sensor)
+static int set_init_addr(struct bmi270 *sensor, uint16_t offset)
 {
-    write_register(sensor, PWR_CTRL, (read_register(sensor, PWR_CTRL) & ~BIT_1));
-    printf("0x%X --> Accelerometer disabled\n", sensor->i2c_addr);
+    // INIT_ADDR counts 16 bit words, INIT_ADDR_0 holds bits 3:0
+    uint16_t words = offset / 2;
+    int result;
+
+    if ((result = write_register(sensor, INIT_ADDR_0, words & LSB_MASK_8BIT)) < 0)
+        return result;
+
+    return write_register(sensor, INIT_ADDR_1, words >> 4);
 }
 
-void enable_gyr(struct bmi270 *sensor)
+int load_config_chunk(struct bmi270 *sensor, uint16_t chunk)
 {
-    write_register(sensor, PWR_CTRL, (read_register(sensor, PWR_CTRL) | BIT_2));
-    printf("0x%X --> Gyroscope enabled\n", sensor->i2c_addr);
+    int result;
+
+    if (chunk >= CONFIG_NUM_CHUNKS)
+        return set_error(sensor, -EINVAL, INIT_DATA);
+
+    if ((result = set_init_addr(sensor, chunk * CONFIG_CHUNK_SIZE)) < 0)
+        return result;
+
+    return write_register_block(sensor, INIT_DATA, CONFIG_CHUNK_SIZE, &config_data(sensor)[chunk * CONFIG_CHUNK_SIZE]);
 }
 
-void disable_gyr(struct bmi270 *sensor)
+int verify_config_file(struct bmi270 *sensor)
 {
-    write_register(sensor, PWR_CTRL, (read_register(sensor, PWR_CTRL) & ~BIT_2));
-    printf("0x%X --> Gyroscope disabled\n", sensor->i2c_addr);
+    const uint8_t *expected = config_data(sensor);
+    uint8_t buffer[CONFIG_VERIFY_SIZE];
+    int result;
+
+    for (uint16_t offset = 0; offset < CONFIG_FILE_SIZE; offset += CONFIG_VERIFY_SIZE)
+    {
+        if ((result = set_init_addr(sensor, offset)) < 0 ||
+            (result = read_register_block(sensor, INIT_DATA, buffer, CONFIG_VERIFY_SIZE)) < 0)
+            return result;
+
+        if (memcmp(buffer, expected + offset, CONFIG_VERIFY_SIZE) != 0)
+        {
+            bmi270_log(BMI270_LOG_ERROR, "0x%X --> Config file read-back mismatch at offset %d", sensor->i2c_addr, offset);
+            return set_error(sensor, -EIO, INIT_DATA);
+        }
+    }
+
+    return 0;
 }
 
-void enable_temp(struct bmi270 *sensor)
+int load_config_finish(struct bmi270 *sensor)
 {
-    write_register(sensor, PWR_CTRL, (read_register(sensor, PWR_CTRL) | BIT_3));
-    printf("0x%X --> Temperature sensor enabled\n", sensor->i2c_addr);
+    return write_register(sensor, INIT_CTRL, 0x01);
 }
 
-void disable_temp(struct bmi270 *sensor)
+int get_config_version(struct bmi270 *sensor, uint16_t *version)
 {
-    write_register(sensor, PWR_CTRL, (read_register(sensor, PWR_CTRL) & ~BIT_3));
-    printf("0x%X --> Temperature sensor disabled\n", sensor->i2c_addr);
+    uint8_t page[FEAT_PAGE_SIZE];
+    int result;
+
+    if ((result = read_feature_page(sensor, FEAT_PAGE_CONFIG_ID, page)) < 0)
+        return result;
+
+    *version = page[FEAT_OFF_CONFIG_ID] | page[FEAT_OFF_CONFIG_ID + 1] << 8;
+
+    return 0;
 }
 
-void set_acc_range(struct bmi270 *sensor, uint8_t range)
+static int upload_config_file(struct bmi270 *sensor)
 {
-    double value = 0.0;
+    uint32_t crc = sensor->config_file ? sensor->config_crc : bmi270_config_file_crc;
+    int result;
 
-    switch (range)
+    // A corrupted blob can leave the sensor needing a power cycle: check before touching it
+    if (bmi270_crc32(config_data(sensor), CONFIG_FILE_SIZE) != crc)
     {
-    case (ACC_RANGE_16G):
-        value = 16.0;
-        break;
-    case (ACC_RANGE_8G):
-        value = 8.0;
-        break;
-    case (ACC_RANGE_4G):
-        value = 4.0;
-        break;
-    case (ACC_RANGE_2G):
-        value = 2.0;
-        break;
-    default:
-        printf("0x%X --> Wrong ACC range. Use 'ACC_RANGE_2G', 'ACC_RANGE_4G', 'ACC_RANGE_8G' or 'ACC_RANGE_16G'\n", sensor->i2c_addr);
-        return;
+        bmi270_log(BMI270_LOG_ERROR, "0x%X --> Config file CRC mismatch!", sensor->i2c_addr);
+        return set_error(sensor, -EBADMSG, INIT_DATA);
     }
 
-    write_register(sensor, ACC_RANGE, range);
-    sensor->acc_range = value * GRAVITY;
-    printf("0x%X --> ACC range set to: %0.fG\n", sensor->i2c_addr, value);
-}
+    bmi270_log(BMI270_LOG_INFO, "0x%X --> Initializing...", sensor->i2c_addr);
 
-void set_gyr_range(struct bmi270 *sensor, uint8_t range)
-{
-    double value = 0.0;
+    if ((result = load_config_start(sensor)) < 0)
+        return result;
 
-    switch (range)
+    for (int i = 0; i < CONFIG_NUM_CHUNKS; i++)
     {
-    case (GYR_RANGE_2000):
-        value = 2000.0;
-        break;
-    case (GYR_RANGE_1000):
-        value = 1000.0;
-        break;
-    case (GYR_RANGE_500):
-        value = 500.0;
-        break;
-    case (GYR_RANGE_250):
-        value = 250.0;
-        break;
-    case (GYR_RANGE_125):
-        value = 125.0;
-        break;
-    default:
-        printf("0x%X --> Wrong GYR range. Use 'GYR_RANGE_2000', 'GYR_RANGE_1000', 'GYR_RANGE_500', 'GYR_RANGE_250' or 'GYR_RANGE_125'\n", sensor->i2c_addr);
-        return;
-    }
+        if ((result = load_config_chunk(sensor, i)) < 0)
+            return result;
 
-    write_register(sensor, GYR_RANGE, range);
-    sensor->gyr_range = value * DEG2RAD;
-    printf("0x%X --> GYR range set to: %0.f\n", sensor->i2c_addr, value);
-}
-
-void set_acc_odr(struct bmi270 *sensor, uint8_t odr)
-{
-    int value = 0;
-
-    switch (odr)
-    {
-    case (ACC_ODR_1600):
-        value = 1600;
-        break;
-    case (ACC_ODR_800):
-        value = 800;
-        break;
-    case (ACC_ODR_400):
-        value = 400;
-        break;
-    case (ACC_ODR_200):
-        value = 200;
-        break;
-    case (ACC_ODR_100):
-        value = 100;
-        break;
-    case (ACC_ODR_50):
-        value = 50;
-        break;
-    case (ACC_ODR_25):
-        value = 25;
-        break;
-    default:
-        printf("0x%X --> Wrong ACC ODR. Use 'ACC_ODR_1600', 'ACC_ODR_800', 'ACC_ODR_400', 'ACC_ODR_200', 'ACC_ODR_100', 'ACC_ODR_50' or 'ACC_ODR_25'\n", sensor->i2c_addr);
-        return;
+        usleep(20);
     }
 
-    write_register(sensor, ACC_CONF, ((read_register(sensor, ACC_CONF) & MSB_MASK_8BIT) | odr));
-    sensor->acc_odr = value;
-    printf("0x%X --> ACC ODR set to: %d Hz\n", sensor->i2c_addr, value);
-}
-
-void set_gyr_odr(struct bmi270 *sensor, uint8_t odr)
-{
-    int value = 0;
-
-    switch (odr)
-    {
-    case (GYR_ODR_3200):
-        value = 3200;
-        break;
-    case (GYR_ODR_1600):
-        value = 1600;
-        break;
-    case (GYR_ODR_800):
-        value = 800;
-        break;
-    case (GYR_ODR_400):
-        value = 400;
-        break;
-    case (GYR_ODR_200):
-        value = 200;
-        break;
-    case (GYR_ODR_100):
-        value = 100;
-        break;
-    case (GYR_ODR_50):
-        value = 50;
-        break;
-    case (GYR_ODR_25):
-        value = 25;
-        break;
-    default:
-        printf("0x%X --> Wrong GYR ODR. Use 'GYR_ODR_3200', 'GYR_ODR_1600', 'GYR_ODR_800', 'GYR_ODR_400', 'GYR_ODR_200', 'GYR_ODR_100', 'GYR_ODR_50' or 'GYR_ODR_25'\n", sensor->i2c_addr);
-        return;
-    }
+    if (sensor->config_verify && (result = verify_config_file(sensor)) < 0)
+        return result;
 
-    write_register(sensor, GYR_CONF, ((read_register(sensor, GYR_CONF) & MSB_MASK_8BIT) | odr));
-    sensor->gyr_odr = value;
-    printf("0x%X --> GYR ODR set to: %d Hz\n", sensor->i2c_addr, value);
-}
-
-void set_acc_bwp(struct bmi270 *sensor, uint8_t bwp)
-{
-    char str[7];
-
-    switch (bwp)
-    {
-    case (ACC_BWP_OSR4):
-        strcpy(str, "OSR4");
-        break;
-    case (ACC_BWP_OSR2):
-        strcpy(str, "OSR2");
-        break;
-    case (ACC_BWP_NORMAL):
-        strcpy(str, "NORMAL");
-        break;
-    case (ACC_BWP_CIC):
-        strcpy(str, "CIC");
-        break;
-    case (ACC_BWP_RES16):
-        strcpy(str, "RES16");
-        break;
-    case (ACC_BWP_RES32):
-        strcpy(str, "RES32");
-        break;
-    case (ACC_BWP_RES64):
-        strcpy(str, "RES64");
-        break;
-    case (ACC_BWP_RES128):
-        strcpy(str, "RES128");
-        break;
-    default:
-        printf("0x%X --> Wrong ACC BWP. Use 'ACC_BWP_OSR4', 'ACC_BWP_OSR2', 'ACC_BWP_NORMAL', 'ACC_BWP_CIC', 'ACC_BWP_RES16', 'ACC_BWP_RES32', 'ACC_BWP_RES64' or 'ACC_BWP_RES128'\n", sensor->i2c_addr);
-        return;
+    if ((result = load_config_finish(sensor)) < 0)
+        return result;
+
+    // Poll instead of always waiting the worst case
+    for (int waited = 0; waited < CONFIG_INIT_WAIT_MS; waited++)
+    {
+        usleep(1000);
+
+        if ((result = read_register(sensor, INTERNAL_STATUS, &sensor->internal_status)) < 0)
+            return result;
+
+        if ((sensor->internal_status & STATUS_MSG_MASK) != STATUS_NOT_INIT)
+            break;
     }
 
-    write_register(sensor, ACC_CONF, ((read_register(sensor, ACC_CONF) & LSB_MASK_8BIT_8) | (bwp << 4)));
-    printf("0x%X --> ACC BWP set to: %s\n", sensor->i2c_addr, str);
+    return 0;
 }
 
-void set_gyr_bwp(struct bmi270 *sensor, uint8_t bwp)
+int load_config_file(struct bmi270 *sensor)
 {
-    char str[7];
+    // Without an explicit expectation only the embedded file has a known version, a custom one is always uploaded
+    uint16_t expected = sensor->config_version ? sensor->config_version : sensor->config_file ? 0 : CONFIG_FILE_VERSION;
+    uint16_t version;
+    int result;
 
-    switch (bwp)
+    if ((result = read_register(sensor, INTERNAL_STATUS, &sensor->internal_status)) < 0)
+        return result;
+
+    if ((sensor->internal_status & STATUS_MSG_MASK) == STATUS_INIT_OK)
     {
-    case (GYR_BWP_OSR4):
-        strcpy(str, "OSR4");
-        break;
-    case (GYR_BWP_OSR2):
-        strcpy(str, "OSR2");
-        break;
-    case (GYR_BWP_NORMAL):
-        strcpy(str, "NORMAL");
-        break;
-    default:
-        printf("0x%X --> Wrong GYR BWP. Use 'GYR_BWP_OSR4', 'GYR_BWP_OSR2' or 'GYR_BWP_NORMAL'\n", sensor->i2c_addr);
-        return;
+        if (get_config_version(sensor, &version) < 0)
+        {
+            bmi270_log(BMI270_LOG_WARN, "0x%X --> Config version unreadable: reloading", sensor->i2c_addr);
+        }
+        else if (expected == 0)
+        {
+            bmi270_log(BMI270_LOG_INFO, "0x%X --> Custom config file without config_version: reloading", sensor->i2c_addr);
+        }
+        else if (version == expected)
+        {
+            // Warm restart: the feature engine is already running the expected config file
+            bmi270_log(BMI270_LOG_INFO, "0x%X --> Already initialized! (config version 0x%04X)", sensor->i2c_addr, version);
+            return 0;
+        }
+        else
+        {
+            bmi270_log(BMI270_LOG_WARN, "0x%X --> Config version 0x%04X, expected 0x%04X: reloading", sensor->i2c_addr, version, expected);
+        }
+
+        if ((result = write_register(sensor, CMD, SOFT_RESET)) < 0)
+            return result;
+
+        usleep(2000);
     }
+    else if (sensor->internal_status & STATUS_INIT_ERR)
+    {
+        bmi270_log(BMI270_LOG_ERROR, "0x%X --> IMPORTANT: Sensor needs power cycle!", sensor->i2c_addr);
+        return set_error(sensor, -EAGAIN, INTERNAL_STATUS);
+    }
+
+    if ((result = upload_config_file(sensor)) < 0)
+        return result;
+
+    bmi270_log(BMI270_LOG_INFO, "0x%X --> Initialization status: %X (1 --> OK)", sensor->i2c_addr, sensor->internal_status);
 
-    write_register(sensor, GYR_CONF, ((read_register(sensor, GYR_CONF) & LSB_MASK_8BIT_8) | (bwp << 4)));
-    printf("0x%X --> GYR BWP set to: %s\n", sensor->i2c_addr, str);
+    if ((sensor->internal_status & STATUS_MSG_MASK) != STATUS_INIT_OK)
+        return set_error(sensor, -EIO, INTERNAL_STATUS);
+
+    // A wrong expectation would re-upload on every start
+    if (expected != 0 && get_config_version(sensor, &version) == 0 && version != expected)
+        bmi270_log(BMI270_LOG_WARN, "0x%X --> Uploaded config file reports version 0x%04X, expected 0x%04X", sensor->i2c_addr, version, expected);
+
+    return 0;
 }
 
-void enable_fifo_header(struct bmi270 *sensor)
+static int check_and_load(struct bmi270 *sensor)
 {
-    write_register(sensor, FIFO_CONFIG_1, (read_register(sensor, FIFO_CONFIG_1) | BIT_4));
-    printf("0x%X --> FIFO header enabled\n", sensor->i2c_addr);
+    int result;
+
+    // Check if chip ID matches
+    if ((result = read_register(sensor, CHIP_ID_ADDRESS, &sensor->chip_id)) < 0)
+        return result;
+
+    if (sensor->chip_id != BMI270_CHIP_ID)
+    {
+        bmi270_log(BMI270_LOG_ERROR, "Chip ID mismatch! --> CURRENT: 0x%X - BMI270: 0x%X", sensor->chip_id, BMI270_CHIP_ID);
+        return set_error(sensor, -ENODEV, CHIP_ID_ADDRESS);
+    }
+
+    bmi270_log(BMI270_LOG_INFO, "0x%X --> Chip ID: 0x%X", sensor->i2c_addr, sensor->chip_id);
+
+    return load_config_file(sensor);
 }
 
-void disable_fifo_header(struct bmi270 *sensor)
+int bmi270_init(struct bmi270 *sensor)
 {
-    write_register(sensor, FIFO_CONFIG_1, (read_register(sensor, FIFO_CONFIG_1) & ~BIT_4));
-    printf("0x%X --> FIFO Header disabled (ODR of all enabled sensors need to be identical)\n", sensor->i2c_addr);
+    return bmi270_init_bus(sensor, I2C_DEVICE);
 }
 
-void enable_data_streaming(struct bmi270 *sensor)
+int bmi270_init_bus(struct bmi270 *sensor, const char *device)
 {
-    write_register(sensor, FIFO_CONFIG_1, (read_register(sensor, FIFO_CONFIG_1) & ~LAST_3_BITS));
-    printf("0x%X --> Data streaming mode enabled (no data will be stored in FIFO)\n", sensor->i2c_addr);
+    int result;
+
+    // Custom bus transfers (e.g. simulated bus) do not need the I2C device
+    if (!sensor->transfer)
+    {
+        // Open I2C bus
+        if ((sensor->i2c_fd = open(device, O_RDWR)) < 0)
+        {
+            result = -errno;
+            bmi270_log(BMI270_LOG_ERROR, "Could not open I2C bus for %s", device);
+            return set_error(sensor, result, 0);
+        }
+
+        sensor->owns_fd = 1;
+
+        // Set I2C address
+        if (ioctl(sensor->i2c_fd, I2C_SLAVE, sensor->i2c_addr) < 0)
+        {
+            result = -errno;
+            bmi270_log(BMI270_LOG_ERROR, "Could not set I2C address to 0x%X", sensor->i2c_addr);
+            bmi270_close(sensor);
+            return set_error(sensor, result, 0);
+        }
+
+        bmi270_log(BMI270_LOG_INFO, "0x%X --> I2C setup successfull!", sensor->i2c_addr);
+    }
+
+    // No BMI270 at this address: nothing left to use the bus for. A failed
+    // config load keeps the bus open, recovery may still bring the sensor up.
+    if ((result = check_and_load(sensor)) == -ENODEV)
+        bmi270_close(sensor);
+
+    return result;
 }
 
-void disable_data_streaming(struct bmi270 *sensor)
+int bmi270_init_fd(struct bmi270 *sensor, int fd)
 {
-    write_register(sensor, FIFO_CONFIG_1, (read_register(sensor, FIFO_CONFIG_1) | LAST_3_BITS));
-    printf("0x%X --> Data streaming mode disabled (data will be stored in FIFO)\n", sensor->i2c_addr);
+    // I2C_RDWR carries the address in every message, the fd can be shared
+    sensor->i2c_fd = fd;
+
+    return check_and_load(sensor);
 }
 
-void enable_acc_filter_perf(struct bmi270 *sensor)
+int bmi270_close(struct bmi270 *sensor)
 {
-    write_register(sensor, ACC_CONF, (read_register(sensor, ACC_CONF) | BIT_7));
-    printf("0x%X --> ACC filter performance enabled (performance optimized)\n", sensor->i2c_addr);
+    int result = 0;
+
+    if (sensor->owns_fd && close(sensor->i2c_fd) < 0)
+        result = -errno;
+
+    sensor->i2c_fd = -1;
+    sensor->owns_fd = 0;
+
+    return result;
 }
 
-void disable_acc_filter_perf(struct bmi270 *sensor)
+int set_mode(struct bmi270 *sensor, uint8_t mode)
 {
-    write_register(sensor, ACC_CONF, (read_register(sensor, ACC_CONF) & ~BIT_7));
-    printf("0x%X --> ACC filter performance disabled (power optimized)\n", sensor->i2c_addr);
+    uint8_t regs[4];
+    const char *name;
+    int result;
+
+    if (mode == LOW_POWER_MODE)
+    {
+        regs[0] = 0x04, regs[1] = 0x17, regs[2] = 0x28, regs[3] = 0x03;
+        sensor->acc_odr = 50;
+        sensor->gyr_odr = 100;
+        name = "LOW_POWER_MODE";
+    }
+    else if (mode == NORMAL_MODE)
+    {
+        regs[0] = 0x0E, regs[1] = 0xA8, regs[2] = 0xA9, regs[3] = 0x02;
+        sensor->acc_odr = 100;
+        sensor->gyr_odr = 200;
+        name = "NORMAL_MODE";
+    }
+    else if (mode == PERFORMANCE_MODE)
+    {
+        regs[0] = 0x0E, regs[1] = 0xA8, regs[2] = 0xE9, regs[3] = 0x02;
+        sensor->acc_odr = 100;
+        sensor->gyr_odr = 200;
+        name = "PERFORMANCE_MODE";
+    }
+    else
+    {
+        bmi270_log(BMI270_LOG_ERROR, "0x%X --> Wrong sensor mode. Use 'LOW_POWER_MODE', 'NORMAL_MODE' or 'PERFORMANCE_MODE'", sensor->i2c_addr);
+        return set_error(sensor, -EINVAL, 0);
+    }
+
+    if ((result = write_register(sensor, PWR_CTRL, regs[0])) < 0 ||
+        (result = write_register(sensor, ACC_CONF, regs[1])) < 0 ||
+        (result = write_register(sensor, GYR_CONF, regs[2])) < 0 ||
+        (result = write_register(sensor, PWR_CONF, regs[3])) < 0)
+        return result;
+
+    bmi270_log(BMI270_LOG_INFO, "0x%X --> Mode set to: %s", sensor->i2c_addr, name);
+    return 0;
 }
 
-void enable_gyr_noise_perf(struct bmi270 *sensor)
+static int update_and_log(struct bmi270 *sensor, uint8_t reg_addr, uint8_t clear, uint8_t set, const char *message)
 {
-    write_register(sensor, GYR_CONF, (read_register(sensor, GYR_CONF) | BIT_6));
-    printf("0x%X --> GYR noise performance enabled (performance optimized)\n", sensor->i2c_addr);
+    int result;
+
+    if ((result = update_register(sensor, reg_addr, clear, set)) < 0)
+        return result;
+
+    bmi270_log(BMI270_LOG_INFO, "0x%X --> %s", sensor->i2c_addr, message);
+    return 0;
 }
 
-void disable_gyr_noise_perf(struct bmi270 *sensor)
+int enable_aux(struct bmi270 *sensor)
 {
-    write_register(sensor, GYR_CONF, (read_register(sensor, GYR_CONF) & ~BIT_6));
-    printf("0x%X --> GYR noise performance disabled (power optimized)\n", sensor->i2c_addr);
+    return update_and_log(sensor, FIELD_REG(PWR_CTRL_AUX_EN), FIELD_MASK(PWR_CTRL_AUX_EN), FIELD_MASK(PWR_CTRL_AUX_EN), "Auxiliary sensor enabled");
 }
 
-void enable_gyr_filter_perf(struct bmi270 *sensor)
+int disable_aux(struct bmi270 *sensor)
 {
-    write_register(sensor, GYR_CONF, (read_register(sensor, GYR_CONF) | BIT_7));
-    printf("0x%X --> GYR filter performance enabled (performance optimized)\n", sensor->i2c_addr);
+    return update_and_log(sensor, FIELD_REG(PWR_CTRL_AUX_EN), FIELD_MASK(PWR_CTRL_AUX_EN), 0, "Auxiliary sensor disabled");
 }
 
-void disable_gyr_filter_perf(struct bmi270 *sensor)
+int enable_acc(struct bmi270 *sensor)
 {
-    write_register(sensor, GYR_CONF, (read_register(sensor, GYR_CONF) & ~BIT_7));
-    printf("0x%X --> GYR filter performance disabled (power optimized)\n", sensor->i2c_addr);
+    return update_and_log(sensor, FIELD_REG(PWR_CTRL_ACC_EN), FIELD_MASK(PWR_CTRL_ACC_EN), FIELD_MASK(PWR_CTRL_ACC_EN), "Accelerometer enabled");
 }
 
-void get_acc_raw(struct bmi270 *sensor, int16_t *acc_x_raw, int16_t *acc_y_raw, int16_t *acc_z_raw)
+int disable_acc(struct bmi270 *sensor)
 {
-    uint8_t buffer[6];
-
-    read_register_block(sensor, ACC_X_7_0, (uint8_t *)&buffer, 6);
+    return update_and_log(sensor, FIELD_REG(PWR_CTRL_ACC_EN), FIELD_MASK(PWR_CTRL_ACC_EN), 0, "Accelerometer disabled");
+}
 
-    *acc_x_raw = (buffer[1] << 8) | buffer[0];
-    *acc_y_raw = (buffer[3] << 8) | buffer[2];
-    *acc_z_raw = (buffer[5] << 8) | buffer[4];
+int enable_gyr(struct bmi270 *sensor)
+{
+    return update_and_log(sensor, FIELD_REG(PWR_CTRL_GYR_EN), FIELD_MASK(PWR_CTRL_GYR_EN), FIELD_MASK(PWR_CTRL_GYR_EN), "Gyroscope enabled");
 }
 
-void get_gyr_raw(struct bmi270 *sensor, int16_t *gyr_x_raw, int16_t *gyr_y_raw, int16_t *gyr_z_raw)
+int disable_gyr(struct bmi270 *sensor)
 {
-    uint8_t buffer[6];
+    return update_and_log(sensor, FIELD_REG(PWR_CTRL_GYR_EN), FIELD_MASK(PWR_CTRL_GYR_EN), 0, "Gyroscope disabled");
+}
 
-    read_register_block(sensor, GYR_X_7_0, (uint8_t *)&buffer, 6);
+int enable_temp(struct bmi270 *sensor)
+{
+    return update_and_log(sensor, FIELD_REG(PWR_CTRL_TEMP_EN), FIELD_MASK(PWR_CTRL_TEMP_EN), FIELD_MASK(PWR_CTRL_TEMP_EN), "Temperature sensor enabled");
+}
 
-    *gyr_x_raw = (buffer[1] << 8) | buffer[0];
-    *gyr_y_raw = (buffer[3] << 8) | buffer[2];
-    *gyr_z_raw = (buffer[5] << 8) | buffer[4];
+int disable_temp(struct bmi270 *sensor)
+{
+    return update_and_log(sensor, FIELD_REG(PWR_CTRL_TEMP_EN), FIELD_MASK(PWR_CTRL_TEMP_EN), 0, "Temperature sensor disabled");
 }
 
-void get_temp_raw(struct bmi270 *sensor, int16_t *temp)
+int set_acc_range(struct bmi270 *sensor, uint8_t range)
 {
-    uint8_t buffer[2];
+    int result;
+
+    if (range > ACC_RANGE_16G)
+    {
+        bmi270_log(BMI270_LOG_ERROR, "0x%X --> Wrong ACC range. Use 'ACC_RANGE_2G', 'ACC_RANGE_4G', 'ACC_RANGE_8G' or 'ACC_RANGE_16G'", sensor->i2c_addr);
+        return set_error(sensor, -EINVAL, ACC_RANGE);
+    }
 
-    read_register_block(sensor, TEMP_7_0, (uint8_t *)&buffer, 2);
+    if ((result = write_register(sensor, ACC_RANGE, FIELD_PREP(ACC_RANGE_SEL, range))) < 0)
+        return result;
 
-    *temp = (buffer[1] << 8) | buffer[0];
+    sensor->acc_range = ACC_RANGE_G(range) * GRAVITY;
+    bmi270_log(BMI270_LOG_INFO, "0x%X --> ACC range set to: %uG", sensor->i2c_addr, ACC_RANGE_G(range));
+    return 0;
 }
 
-void get_acc(struct bmi270 *sensor, double *acc_x, double *acc_y, double *acc_z)
+int set_gyr_range(struct bmi270 *sensor, uint8_t range)
 {
-    int16_t acc_x_raw, acc_y_raw, acc_z_raw;
+    int result;
+
+    if (range > GYR_RANGE_125)
+    {
+        bmi270_log(BMI270_LOG_ERROR, "0x%X --> Wrong GYR range. Use 'GYR_RANGE_2000', 'GYR_RANGE_1000', 'GYR_RANGE_500', 'GYR_RANGE_250' or 'GYR_RANGE_125'", sensor->i2c_addr);
+        return set_error(sensor, -EINVAL, GYR_RANGE);
+    }
 
-    get_acc_raw(sensor, &acc_x_raw, &acc_y_raw, &acc_z_raw);
+    if ((result = write_register(sensor, GYR_RANGE, FIELD_PREP(GYR_RANGE_SEL, range))) < 0)
+        return result;
 
-    *acc_x = (double)acc_x_raw * sensor->acc_range / 32768.0;
-    *acc_y = (double)acc_y_raw * sensor->acc_range / 32768.0;
-    *acc_z = (double)acc_z_raw * sensor->acc_range / 32768.0;
+    sensor->gyr_range = GYR_RANGE_DPS(range) * DEG2RAD;
+    bmi270_log(BMI270_LOG_INFO, "0x%X --> GYR range set to: %u", sensor->i2c_addr, GYR_RANGE_DPS(range));
+    return 0;
 }
 
-void get_gyr(struct bmi270 *sensor, double *gyr_x, double *gyr_y, double *gyr_z)
+int set_acc_odr(struct bmi270 *sensor, uint8_t odr)
 {
-    int16_t gyr_x_raw, gyr_y_raw, gyr_z_raw;
+    uint8_t acc_conf;
+    int result;
+
+    // Below 12.5 Hz only with the filter performance mode off (undersampling)
+    if (odr < ACC_ODR_0_78 || odr > ACC_ODR_1600)
+    {
+        bmi270_log(BMI270_LOG_ERROR, "0x%X --> Wrong ACC ODR. Use 'ACC_ODR_1600', 'ACC_ODR_800', 'ACC_ODR_400', 'ACC_ODR_200', 'ACC_ODR_100', 'ACC_ODR_50', 'ACC_ODR_25', 'ACC_ODR_12_5' or, undersampling only, 'ACC_ODR_6_25' - 'ACC_ODR_0_78'", sensor->i2c_addr);
+        return set_error(sensor, -EINVAL, ACC_CONF);
+    }
+
+    if ((result = read_register(sensor, ACC_CONF, &acc_conf)) < 0)
+        return result;
+
+    // The sensor flags these as a configuration error in filter performance mode
+    if (odr < ACC_ODR_12_5 && (acc_conf & FIELD_MASK(ACC_CONF_PERF)))
+    {
+        bmi270_log(BMI270_LOG_ERROR, "0x%X --> ACC ODR below 12.5 Hz needs the filter performance mode off", sensor->i2c_addr);
+        return set_error(sensor, -EINVAL, ACC_CONF);
+    }
 
-    get_gyr_raw(sensor, &gyr_x_raw, &gyr_y_raw, &gyr_z_raw);
+    if ((result = write_register(sensor, ACC_CONF, (acc_conf & ~FIELD_MASK(ACC_CONF_ODR)) | FIELD_PREP(ACC_CONF_ODR, odr))) < 0)
+        return result;
 
-    *gyr_x = (double)gyr_x_raw * sensor->gyr_range / 32768.0;
-    *gyr_y = (double)gyr_y_raw * sensor->gyr_range / 32768.0;
-    *gyr_z = (double)gyr_z_raw * sensor->gyr_range / 32768.0;
+    sensor->acc_odr = ODR_HZ(odr);
+    bmi270_log(BMI270_LOG_INFO, "0x%X --> ACC ODR set to: %.2f Hz", sensor->i2c_addr, sensor->acc_odr);
+    return 0;
 }
 
-void get_temp(struct bmi270 *sensor, double *temp_celsius)
+int set_gyr_odr(struct bmi270 *sensor, uint8_t odr)
 {
-    int16_t temp_raw;
+    int result;
 
-    get_temp_raw(sensor, &temp_raw);
+    if (odr < GYR_ODR_25 || odr > GYR_ODR_3200)
+    {
+        bmi270_log(BMI270_LOG_ERROR, "0x%X --> Wrong GYR ODR. Use 'GYR_ODR_3200', 'GYR_ODR_1600', 'GYR_ODR_800', 'GYR_ODR_400', 'GYR_ODR_200', 'GYR_ODR_100', 'GYR_ODR_50' or 'GYR_ODR_25'", sensor->i2c_addr);
+        return set_error(sensor, -EINVAL, GYR_CONF);
+    }
 
-    *temp_celsius = (double)temp_raw * 0.001952594 + 23.0;
+    if ((result = FIELD_UPDATE(sensor, GYR_CONF_ODR, odr)) < 0)
+        return result;
+
+    sensor->gyr_odr = ODR_HZ(odr);
+    bmi270_log(BMI270_LOG_INFO, "0x%X --> GYR ODR set to: %.0f Hz", sensor->i2c_addr, sensor->gyr_odr);
+    return 0;
+}
+
+int set_acc_bwp(struct bmi270 *sensor, uint8_t bwp)
+{
+    static const char *names[8] = {"OSR4", "OSR2", "NORMAL", "CIC", "RES16", "RES32", "RES64", "RES128"};
+    int result;
+
+    if (bwp > ACC_BWP_RES128)
+    {
+        bmi270_log(BMI270_LOG_ERROR, "0x%X --> Wrong ACC BWP. Use 'ACC_BWP_OSR4', 'ACC_BWP_OSR2', 'ACC_BWP_NORMAL', 'ACC_BWP_CIC', 'ACC_BWP_RES16', 'ACC_BWP_RES32', 'ACC_BWP_RES64' or 'ACC_BWP_RES128'", sensor->i2c_addr);
+        return set_error(sensor, -EINVAL, ACC_CONF);
+    }
+
+    if ((result = FIELD_UPDATE(sensor, ACC_CONF_BWP, bwp)) < 0)
+        return result;
+
+    bmi270_log(BMI270_LOG_INFO, "0x%X --> ACC BWP set to: %s", sensor->i2c_addr, names[bwp]);
+    return 0;
+}
+
+int set_gyr_bwp(struct bmi270 *sensor, uint8_t bwp)
+{
+    static const char *names[3] = {"OSR4", "OSR2", "NORMAL"};
+    int result;
+
+    if (bwp > GYR_BWP_NORMAL)
+    {
+        bmi270_log(BMI270_LOG_ERROR, "0x%X --> Wrong GYR BWP. Use 'GYR_BWP_OSR4', 'GYR_BWP_OSR2' or 'GYR_BWP_NORMAL'", sensor->i2c_addr);
+        return set_error(sensor, -EINVAL, GYR_CONF);
+    }
+
+    // Only bits 4-5: bit 6 is the noise performance mode
+    if ((result = FIELD_UPDATE(sensor, GYR_CONF_BWP, bwp)) < 0)
+        return result;
+
+    bmi270_log(BMI270_LOG_INFO, "0x%X --> GYR BWP set to: %s", sensor->i2c_addr, names[bwp]);
+    return 0;
+}
+
+int enable_fifo_header(struct bmi270 *sensor)
+{
+    return update_and_log(sensor, FIELD_REG(FIFO_HEADER_EN), 0, FIELD_MASK(FIFO_HEADER_EN), "FIFO header enabled");
+}
+
+int disable_fifo_header(struct bmi270 *sensor)
+{
+    return update_and_log(sensor, FIELD_REG(FIFO_HEADER_EN), FIELD_MASK(FIFO_HEADER_EN), 0, "FIFO Header disabled (ODR of all enabled sensors need to be identical)");
+}
+
+int set_fifo_watermark(struct bmi270 *sensor, uint16_t bytes)
+{
+    uint8_t buffer[2] = { bytes & FULL_MASK_8BIT, (bytes >> 8) & LSB_MASK_8BIT_5 };
+    int result;
+
+    if (bytes > FIFO_SIZE)
+    {
+        bmi270_log(BMI270_LOG_ERROR, "0x%X --> FIFO watermark out of range: %d bytes (max. %d)", sensor->i2c_addr, bytes, FIFO_SIZE);
+        return set_error(sensor, -EINVAL, FIFO_WTM_0);
+    }
+
+    // Both bytes in one transaction: the watermark is never half updated
+    if ((result = write_register_block(sensor, FIFO_WTM_0, 2, buffer)) < 0)
+        return result;
+
+    bmi270_log(BMI270_LOG_DEBUG, "0x%X --> FIFO watermark set to: %d bytes", sensor->i2c_addr, bytes);
+    return 0;
+}
+
+int get_fifo_watermark(struct bmi270 *sensor, uint16_t *bytes)
+{
+    uint8_t buffer[2];
+    int result;
+
+    if ((result = read_register_block(sensor, FIFO_WTM_0, buffer, 2)) < 0)
+        return result;
+
+    *bytes = (buffer[1] << 8 | buffer[0]) & FIFO_WTM_MASK;
+
+    return 0;
+}
+
+int enable_data_streaming(struct bmi270 *sensor)
+{
+    return update_and_log(sensor, FIELD_REG(FIFO_SENSORS_EN), FIELD_MASK(FIFO_SENSORS_EN), 0, "Data streaming mode enabled (no data will be stored in FIFO)");
+}
+
+int disable_data_streaming(struct bmi270 *sensor)
+{
+    return update_and_log(sensor, FIELD_REG(FIFO_SENSORS_EN), 0, FIELD_MASK(FIFO_SENSORS_EN), "Data streaming mode disabled (data will be stored in FIFO)");
+}
+
+int enable_acc_filter_perf(struct bmi270 *sensor)
+{
+    uint8_t odr;
+    int result;
+
+    if ((result = FIELD_READ(sensor, ACC_CONF_ODR, &odr)) < 0)
+        return result;
+
+    if (odr < ACC_ODR_12_5)
+    {
+        bmi270_log(BMI270_LOG_ERROR, "0x%X --> ACC filter performance needs an ODR of at least 12.5 Hz", sensor->i2c_addr);
+        return set_error(sensor, -EINVAL, ACC_CONF);
+    }
+
+    return update_and_log(sensor, FIELD_REG(ACC_CONF_PERF), 0, FIELD_MASK(ACC_CONF_PERF), "ACC filter performance enabled (performance optimized)");
+}
+
+int disable_acc_filter_perf(struct bmi270 *sensor)
+{
+    return update_and_log(sensor, FIELD_REG(ACC_CONF_PERF), FIELD_MASK(ACC_CONF_PERF), 0, "ACC filter performance disabled (power optimized)");
+}
+
+int enable_gyr_noise_perf(struct bmi270 *sensor)
+{
+    return update_and_log(sensor, FIELD_REG(GYR_CONF_NOISE), 0, FIELD_MASK(GYR_CONF_NOISE), "GYR noise performance enabled (performance optimized)");
+}
+
+int disable_gyr_noise_perf(struct bmi270 *sensor)
+{
+    return update_and_log(sensor, FIELD_REG(GYR_CONF_NOISE), FIELD_MASK(GYR_CONF_NOISE), 0, "GYR noise performance disabled (power optimized)");
+}
+
+int enable_gyr_filter_perf(struct bmi270 *sensor)
+{
+    return update_and_log(sensor, FIELD_REG(GYR_CONF_PERF), 0, FIELD_MASK(GYR_CONF_PERF), "GYR filter performance enabled (performance optimized)");
+}
+
+int disable_gyr_filter_perf(struct bmi270 *sensor)
+{
+    return update_and_log(sensor, FIELD_REG(GYR_CONF_PERF), FIELD_MASK(GYR_CONF_PERF), 0, "GYR filter performance disabled (power optimized)");
+}
+
+int get_acc_raw(struct bmi270 *sensor, int16_t *acc_x_raw, int16_t *acc_y_raw, int16_t *acc_z_raw)
+{
+    uint8_t buffer[6];
+    int result;
+
+    if ((result = read_register_block(sensor, ACC_X_7_0, (uint8_t *)&buffer, 6)) < 0)
+        return result;
+
+    *acc_x_raw = (buffer[1] << 8) | buffer[0];
+    *acc_y_raw = (buffer[3] << 8) | buffer[2];
+    *acc_z_raw = (buffer[5] << 8) | buffer[4];
+
+    return 0;
+}
+
+int get_gyr_raw(struct bmi270 *sensor, int16_t *gyr_x_raw, int16_t *gyr_y_raw, int16_t *gyr_z_raw)
+{
+    uint8_t buffer[6];
+    int result;
+
+    if ((result = read_register_block(sensor, GYR_X_7_0, (uint8_t *)&buffer, 6)) < 0)
+        return result;
+
+    *gyr_x_raw = (buffer[1] << 8) | buffer[0];
+    *gyr_y_raw = (buffer[3] << 8) | buffer[2];
+    *gyr_z_raw = (buffer[5] << 8) | buffer[4];
+
+    return 0;
+}
+
+int get_acc_gyr_raw(struct bmi270 *sensor, int16_t *acc, int16_t *gyr)
+{
+    uint8_t buffer[12];
+    int result;
+
+    // ACC and GYR data registers are contiguous: one transaction per sample
+    if ((result = read_register_block(sensor, ACC_X_7_0, (uint8_t *)&buffer, 12)) < 0)
+        return result;
+
+    for (int i = 0; i < 3; i++)
+    {
+        acc[i] = (buffer[2 * i + 1] << 8) | buffer[2 * i];
+        gyr[i] = (buffer[6 + 2 * i + 1] << 8) | buffer[6 + 2 * i];
+    }
+
+    return 0;
+}
+
+int get_fifo_length(struct bmi270 *sensor, uint16_t *length)
+{
+    uint8_t buffer[2];
+    int result;
+
+    if ((result = read_register_block(sensor, FIFO_LENGTH_0, (uint8_t *)&buffer, 2)) < 0)
+        return result;
+
+    *length = ((buffer[1] & 0x3F) << 8) | buffer[0];
+
+    return 0;
+}
+
+int read_fifo(struct bmi270 *sensor, uint8_t *data, uint16_t len)
+{
+    int result;
+
+    // FIFO_DATA does not auto-increment: consecutive bursts continue the stream
+    for (uint16_t offset = 0; offset < len; offset += FIFO_READ_CHUNK)
+    {
+        uint16_t chunk = len - offset < FIFO_READ_CHUNK ? len - offset : FIFO_READ_CHUNK;
+
+        if ((result = read_register_block(sensor, FIFO_DATA, data + offset, (uint8_t)chunk)) < 0)
+            return result;
+    }
+
+    return 0;
+}
+
+int parse_fifo_frame(const uint8_t *data, uint16_t len, uint8_t fifo_config, struct bmi270_fifo_frame *frame)
+{
+    uint8_t sensors, size;
+
+    frame->acc = frame->gyr = frame->aux = NULL;
+    frame->sensortime = 0;
+    frame->value = 0;
+
+    if (len == 0)
+        return 0;
+
+    if (fifo_config & FIELD_MASK(FIFO_HEADER_EN))
+    {
+        frame->header = data[0];
+
+        if (frame->header == FIFO_EMPTY)
+            return 0;
+
+        switch (frame->header)
+        {
+        case FIFO_HEAD_SKIP:
+        case FIFO_HEAD_CONFIG:
+        case FIFO_HEAD_DROP:
+            if (len < 2)
+                return 0;
+
+            frame->type = frame->header == FIFO_HEAD_SKIP ? FIFO_FRAME_SKIP : frame->header == FIFO_HEAD_CONFIG ? FIFO_FRAME_CONFIG : FIFO_FRAME_DROP;
+            frame->value = data[1];
+            return 2;
+
+        case FIFO_HEAD_TIME:
+            if (len < 4)
+                return 0;
+
+            frame->type = FIFO_FRAME_TIME;
+            frame->sensortime = data[1] | (data[2] << 8) | ((uint32_t)data[3] << 16);
+            return 4;
+        }
+
+        if ((frame->header & FIFO_HEAD_MODE_MASK) != FIFO_HEAD_REGULAR)
+            return -EINVAL;
+
+        sensors = frame->header & (FIFO_HEAD_AUX | FIFO_HEAD_GYR | FIFO_HEAD_ACC);
+        data++, len--;
+    }
+    else
+    {
+        // Headerless: every frame holds all sensors enabled in FIFO_CONFIG_1
+        frame->header = 0;
+        sensors = ((fifo_config & FIELD_MASK(FIFO_AUX_EN)) ? FIFO_HEAD_AUX : 0) |
+                  ((fifo_config & FIELD_MASK(FIFO_GYR_EN)) ? FIFO_HEAD_GYR : 0) |
+                  ((fifo_config & FIELD_MASK(FIFO_ACC_EN)) ? FIFO_HEAD_ACC : 0);
+    }
+
+    size = (sensors & FIFO_HEAD_AUX ? AUX_DATA_LEN : 0) + (sensors & FIFO_HEAD_GYR ? 6 : 0) + (sensors & FIFO_HEAD_ACC ? 6 : 0);
+
+    if (size == 0 || len < size)
+        return 0;
+
+    // Payload order: AUX, GYR, ACC
+    frame->type = FIFO_FRAME_DATA;
+
+    if (sensors & FIFO_HEAD_AUX)
+        frame->aux = data, data += AUX_DATA_LEN;
+
+    if (sensors & FIFO_HEAD_GYR)
+        frame->gyr = data, data += 6;
+
+    if (sensors & FIFO_HEAD_ACC)
+        frame->acc = data;
+
+    return size + (frame->header ? 1 : 0);
+}
+
+int get_temp_raw(struct bmi270 *sensor, int16_t *temp)
+{
+    uint8_t buffer[2];
+    int result;
+
+    if ((result = read_register_block(sensor, TEMP_7_0, (uint8_t *)&buffer, 2)) < 0)
+        return result;
+
+    *temp = (buffer[1] << 8) | buffer[0];
+
+    return 0;
+}
+
+void convert_acc_raw(struct bmi270 *sensor, const int16_t *raw, double *acc)
+{
+    double scale = sensor->acc_range / 32768.0;
+
+    acc[0] = (double)raw[0] * scale;
+    acc[1] = (double)raw[1] * scale;
+    acc[2] = (double)raw[2] * scale;
+}
+
+void convert_gyr_raw(struct bmi270 *sensor, const int16_t *raw, double *gyr)
+{
+    double scale = sensor->gyr_range / 32768.0;
+
+    gyr[0] = (double)raw[0] * scale;
+    gyr[1] = (double)raw[1] * scale;
+    gyr[2] = (double)raw[2] * scale;
+}
+
+int get_acc(struct bmi270 *sensor, double *acc_x, double *acc_y, double *acc_z)
+{
+    int16_t raw[3];
+    double acc[3];
+    int result;
+
+    if ((result = get_acc_raw(sensor, &raw[0], &raw[1], &raw[2])) < 0)
+        return result;
+
+    convert_acc_raw(sensor, raw, acc);
+
+    *acc_x = acc[0];
+    *acc_y = acc[1];
+    *acc_z = acc[2];
+
+    return 0;
+}
+
+int get_gyr(struct bmi270 *sensor, double *gyr_x, double *gyr_y, double *gyr_z)
+{
+    int16_t raw[3];
+    double gyr[3];
+    int result;
+
+    if ((result = get_gyr_raw(sensor, &raw[0], &raw[1], &raw[2])) < 0)
+        return result;
+
+    convert_gyr_raw(sensor, raw, gyr);
+
+    *gyr_x = gyr[0];
+    *gyr_y = gyr[1];
+    *gyr_z = gyr[2];
+
+    return 0;
+}
+
+int get_temp(struct bmi270 *sensor, double *temp_celsius)
+{
+    int16_t temp_raw;
+    int result;
+
+    if ((result = get_temp_raw(sensor, &temp_raw)) < 0)
+        return result;
+
+    *temp_celsius = (double)temp_raw * 0.001952594 + 23.0;
+
+    return 0;
+}
+
+static uint16_t get_feature_word(const uint8_t *page, uint8_t offset)
+{
+    return (uint16_t)((page[offset + 1] << 8) | page[offset]);
+}
+
+static void set_feature_word(uint8_t *page, uint8_t offset, uint16_t value)
+{
+    page[offset] = value & FULL_MASK_8BIT;
+    page[offset + 1] = value >> 8;
+}
+
+int read_feature_page(struct bmi270 *sensor, uint8_t page, uint8_t *data)
+{
+    int result;
+
+    if ((result = write_register(sensor, FEAT_PAGE, page)) < 0)
+        return result;
+
+    return read_register_block(sensor, FEATURES_IN, data, FEAT_PAGE_SIZE);
+}
+
+int write_feature_page(struct bmi270 *sensor, uint8_t page, const uint8_t *data)
+{
+    uint8_t pwr_conf;
+    int result;
+
+    if ((result = read_register(sensor, PWR_CONF, &pwr_conf)) < 0)
+        return result;
+
+    // Feature registers can only be written with advanced power save disabled
+    if (pwr_conf & FIELD_MASK(PWR_CONF_ADV_PS))
+    {
+        if ((result = write_register(sensor, PWR_CONF, pwr_conf & ~FIELD_MASK(PWR_CONF_ADV_PS))) < 0)
+            return result;
+
+        usleep(450);
+    }
+
+    result = write_register(sensor, FEAT_PAGE, page);
+
+    if (result == 0)
+        result = write_register_block(sensor, FEATURES_IN, FEAT_PAGE_SIZE, data);
+
+    if (pwr_conf & FIELD_MASK(PWR_CONF_ADV_PS))
+    {
+        int restored = write_register(sensor, PWR_CONF, pwr_conf);
+
+        if (result == 0)
+            result = restored;
+    }
+
+    return result;
+}
+
+static int set_motion_feature(struct bmi270 *sensor, uint8_t page, uint8_t offset, uint16_t duration, uint16_t threshold, uint8_t axes, uint8_t enable)
+{
+    uint8_t data[FEAT_PAGE_SIZE];
+    int result;
+
+    if ((result = read_feature_page(sensor, page, data)) < 0)
+        return result;
+
+    set_feature_word(data, offset, (duration & MOTION_DUR_MASK) | ((axes & FEAT_AXIS_ALL) << 13));
+    set_feature_word(data, offset + 2, (get_feature_word(data, offset + 2) & ~(MOTION_THRES_MASK | MOTION_EN)) | (threshold & MOTION_THRES_MASK) | (enable ? MOTION_EN : 0));
+
+    return write_feature_page(sensor, page, data);
+}
+
+static int disable_motion_feature(struct bmi270 *sensor, uint8_t page, uint8_t offset)
+{
+    uint8_t data[FEAT_PAGE_SIZE];
+    int result;
+
+    if ((result = read_feature_page(sensor, page, data)) < 0)
+        return result;
+
+    set_feature_word(data, offset + 2, get_feature_word(data, offset + 2) & ~MOTION_EN);
+
+    return write_feature_page(sensor, page, data);
+}
+
+int enable_any_motion(struct bmi270 *sensor, uint16_t duration, uint16_t threshold, uint8_t axes)
+{
+    int result;
+
+    if ((result = set_motion_feature(sensor, FEAT_PAGE_ANY_MOT, FEAT_OFF_ANY_MOT, duration, threshold, axes, 1)) < 0)
+        return result;
+
+    bmi270_log(BMI270_LOG_INFO, "0x%X --> Any-motion enabled (duration: %d ms, threshold: %.2f mg)", sensor->i2c_addr, duration * 20, threshold * 0.48);
+    return 0;
+}
+
+int disable_any_motion(struct bmi270 *sensor)
+{
+    int result;
+
+    if ((result = disable_motion_feature(sensor, FEAT_PAGE_ANY_MOT, FEAT_OFF_ANY_MOT)) < 0)
+        return result;
+
+    bmi270_log(BMI270_LOG_INFO, "0x%X --> Any-motion disabled", sensor->i2c_addr);
+    return 0;
+}
+
+int enable_no_motion(struct bmi270 *sensor, uint16_t duration, uint16_t threshold, uint8_t axes)
+{
+    int result;
+
+    if ((result = set_motion_feature(sensor, FEAT_PAGE_NO_MOT, FEAT_OFF_NO_MOT, duration, threshold, axes, 1)) < 0)
+        return result;
+
+    bmi270_log(BMI270_LOG_INFO, "0x%X --> No-motion enabled (duration: %d ms, threshold: %.2f mg)", sensor->i2c_addr, duration * 20, threshold * 0.48);
+    return 0;
+}
+
+int disable_no_motion(struct bmi270 *sensor)
+{
+    int result;
+
+    if ((result = disable_motion_feature(sensor, FEAT_PAGE_NO_MOT, FEAT_OFF_NO_MOT)) < 0)
+        return result;
+
+    bmi270_log(BMI270_LOG_INFO, "0x%X --> No-motion disabled", sensor->i2c_addr);
+    return 0;
+}
+
+static int set_sig_motion(struct bmi270 *sensor, uint16_t block_size, uint8_t enable)
+{
+    uint8_t data[FEAT_PAGE_SIZE];
+    int result;
+
+    if ((result = read_feature_page(sensor, FEAT_PAGE_SIG_MOT, data)) < 0)
+        return result;
+
+    if (block_size)
+        set_feature_word(data, FEAT_OFF_SIG_MOT, block_size);
+
+    data[FEAT_OFF_SIG_MOT_EN] = (data[FEAT_OFF_SIG_MOT_EN] & ~BIT_0) | (enable ? BIT_0 : 0);
+
+    return write_feature_page(sensor, FEAT_PAGE_SIG_MOT, data);
+}
+
+int enable_sig_motion(struct bmi270 *sensor, uint16_t block_size)
+{
+    int result;
+
+    if ((result = set_sig_motion(sensor, block_size, 1)) < 0)
+        return result;
+
+    bmi270_log(BMI270_LOG_INFO, "0x%X --> Significant motion enabled", sensor->i2c_addr);
+    return 0;
+}
+
+int disable_sig_motion(struct bmi270 *sensor)
+{
+    int result;
+
+    if ((result = set_sig_motion(sensor, 0, 0)) < 0)
+        return result;
+
+    bmi270_log(BMI270_LOG_INFO, "0x%X --> Significant motion disabled", sensor->i2c_addr);
+    return 0;
+}
+
+static int update_step_counter(struct bmi270 *sensor, uint16_t mask, uint16_t value)
+{
+    uint8_t data[FEAT_PAGE_SIZE];
+    int result;
+
+    if ((result = read_feature_page(sensor, FEAT_PAGE_STEP_CNT, data)) < 0)
+        return result;
+
+    set_feature_word(data, FEAT_OFF_STEP_CNT, (get_feature_word(data, FEAT_OFF_STEP_CNT) & ~mask) | value);
+
+    return write_feature_page(sensor, FEAT_PAGE_STEP_CNT, data);
+}
+
+int enable_step_counter(struct bmi270 *sensor, uint16_t watermark)
+{
+    uint16_t mask = STEP_WTM_MASK | STEP_COUNTER_EN | STEP_DETECTOR_EN | STEP_ACTIVITY_EN;
+    int result;
+
+    if ((result = update_step_counter(sensor, mask, (watermark & STEP_WTM_MASK) | STEP_COUNTER_EN | STEP_DETECTOR_EN | STEP_ACTIVITY_EN)) < 0)
+        return result;
+
+    bmi270_log(BMI270_LOG_INFO, "0x%X --> Step counter enabled (watermark: %d steps)", sensor->i2c_addr, (watermark & STEP_WTM_MASK) * 20);
+    return 0;
+}
+
+int disable_step_counter(struct bmi270 *sensor)
+{
+    int result;
+
+    if ((result = update_step_counter(sensor, STEP_COUNTER_EN | STEP_DETECTOR_EN | STEP_ACTIVITY_EN, 0)) < 0)
+        return result;
+
+    bmi270_log(BMI270_LOG_INFO, "0x%X --> Step counter disabled", sensor->i2c_addr);
+    return 0;
+}
+
+int reset_step_counter(struct bmi270 *sensor)
+{
+    int result;
+
+    if ((result = update_step_counter(sensor, STEP_RESET, STEP_RESET)) < 0)
+        return result;
+
+    bmi270_log(BMI270_LOG_INFO, "0x%X --> Step counter reset", sensor->i2c_addr);
+    return 0;
+}
+
+int enable_wrist_gesture(struct bmi270 *sensor, uint8_t right_arm)
+{
+    uint8_t data[FEAT_PAGE_SIZE];
+    int result;
+
+    if ((result = read_feature_page(sensor, FEAT_PAGE_WR_GEST, data)) < 0)
+        return result;
+
+    data[FEAT_OFF_WR_GEST] = (data[FEAT_OFF_WR_GEST] & ~WR_GEST_ARM_RIGHT) | WR_GEST_EN | (right_arm ? WR_GEST_ARM_RIGHT : 0);
+
+    if ((result = write_feature_page(sensor, FEAT_PAGE_WR_GEST, data)) < 0)
+        return result;
+
+    bmi270_log(BMI270_LOG_INFO, "0x%X --> Wrist gesture enabled (%s arm)", sensor->i2c_addr, right_arm ? "right" : "left");
+    return 0;
+}
+
+int disable_wrist_gesture(struct bmi270 *sensor)
+{
+    uint8_t data[FEAT_PAGE_SIZE];
+    int result;
+
+    if ((result = read_feature_page(sensor, FEAT_PAGE_WR_GEST, data)) < 0)
+        return result;
+
+    data[FEAT_OFF_WR_GEST] &= ~WR_GEST_EN;
+
+    if ((result = write_feature_page(sensor, FEAT_PAGE_WR_GEST, data)) < 0)
+        return result;
+
+    bmi270_log(BMI270_LOG_INFO, "0x%X --> Wrist gesture disabled", sensor->i2c_addr);
+    return 0;
+}
+
+int set_int_pin_config(struct bmi270 *sensor, uint8_t int_pin, uint8_t config)
+{
+    int result;
+
+    if (int_pin != INT1 && int_pin != INT2)
+    {
+        bmi270_log(BMI270_LOG_ERROR, "0x%X --> Wrong interrupt pin. Use 'INT1' or 'INT2'", sensor->i2c_addr);
+        return set_error(sensor, -EINVAL, INT1_IO_CTRL);
+    }
+
+    if ((result = write_register(sensor, int_pin == INT1 ? INT1_IO_CTRL : INT2_IO_CTRL, config & (INT_ACTIVE_HIGH | INT_OPEN_DRAIN | INT_OUTPUT_EN))) < 0)
+        return result;
+
+    bmi270_log(BMI270_LOG_INFO, "0x%X --> INT%d configured", sensor->i2c_addr, int_pin);
+    return 0;
+}
+
+int map_feature_int(struct bmi270 *sensor, uint8_t int_pin, uint8_t features)
+{
+    int result;
+
+    if (int_pin != INT1 && int_pin != INT2)
+    {
+        bmi270_log(BMI270_LOG_ERROR, "0x%X --> Wrong interrupt pin. Use 'INT1' or 'INT2'", sensor->i2c_addr);
+        return set_error(sensor, -EINVAL, INT1_MAP_FEAT);
+    }
+
+    if ((result = write_register(sensor, int_pin == INT1 ? INT1_MAP_FEAT : INT2_MAP_FEAT, features)) < 0)
+        return result;
+
+    bmi270_log(BMI270_LOG_INFO, "0x%X --> Features mapped to INT%d: 0x%X", sensor->i2c_addr, int_pin, features);
+    return 0;
+}
+
+int map_data_int(struct bmi270 *sensor, uint8_t int_pin, uint8_t ints)
+{
+    int result;
+
+    if (int_pin != INT1 && int_pin != INT2)
+    {
+        bmi270_log(BMI270_LOG_ERROR, "0x%X --> Wrong interrupt pin. Use 'INT1' or 'INT2'", sensor->i2c_addr);
+        return set_error(sensor, -EINVAL, INT_MAP_DATA);
+    }
+
+    // INT1 in bits 3:0, INT2 in bits 7:4
+    ints &= LSB_MASK_8BIT;
+
+    if ((result = update_register(sensor, INT_MAP_DATA, int_pin == INT1 ? LSB_MASK_8BIT : MSB_MASK_8BIT, int_pin == INT1 ? ints : ints << 4)) < 0)
+        return result;
+
+    bmi270_log(BMI270_LOG_INFO, "0x%X --> Data interrupts mapped to INT%d: 0x%X", sensor->i2c_addr, int_pin, ints);
+    return 0;
+}
+
+int enable_int_latch(struct bmi270 *sensor)
+{
+    return update_and_log(sensor, INT_LATCH, 0, BIT_0, "Interrupt latch enabled");
+}
+
+int disable_int_latch(struct bmi270 *sensor)
+{
+    return update_and_log(sensor, INT_LATCH, BIT_0, 0, "Interrupt latch disabled");
+}
+
+int get_feature_int_status(struct bmi270 *sensor, uint8_t *status)
+{
+    return read_register(sensor, INT_STATUS_0, status);
+}
+
+int get_data_int_status(struct bmi270 *sensor, uint8_t *status)
+{
+    return read_register(sensor, INT_STATUS_1, status);
+}
+
+int get_step_count(struct bmi270 *sensor, uint32_t *steps)
+{
+    uint8_t data[FEAT_PAGE_SIZE];
+    int result;
+
+    if ((result = read_feature_page(sensor, FEAT_PAGE_OUT, data)) < 0)
+        return result;
+
+    *steps = (uint32_t)data[FEAT_OFF_STEP_OUT] | ((uint32_t)data[FEAT_OFF_STEP_OUT + 1] << 8) |
+             ((uint32_t)data[FEAT_OFF_STEP_OUT + 2] << 16) | ((uint32_t)data[FEAT_OFF_STEP_OUT + 3] << 24);
+
+    return 0;
+}
+
+int get_step_activity(struct bmi270 *sensor, uint8_t *activity)
+{
+    uint8_t data[FEAT_PAGE_SIZE];
+    int result;
+
+    if ((result = read_feature_page(sensor, FEAT_PAGE_OUT, data)) < 0)
+        return result;
+
+    *activity = data[FEAT_OFF_ACT_OUT] & 0x03;
+
+    return 0;
+}
+
+int get_wrist_gesture(struct bmi270 *sensor, uint8_t *gesture)
+{
+    uint8_t data[FEAT_PAGE_SIZE];
+    int result;
+
+    if ((result = read_feature_page(sensor, FEAT_PAGE_OUT, data)) < 0)
+        return result;
+
+    *gesture = data[FEAT_OFF_GEST_OUT] & 0x07;
+
+    return 0;
+}
+
+static uint8_t aux_burst_len(uint8_t burst)
+{
+    static const uint8_t lengths[4] = {1, 2, 6, 8};
+
+    return lengths[burst & 0x03];
+}
+
+static uint8_t aux_burst_code(uint8_t len)
+{
+    if (len <= 1)
+        return AUX_BURST_1;
+    if (len == 2)
+        return AUX_BURST_2;
+    if (len <= 6)
+        return AUX_BURST_6;
+    return AUX_BURST_8;
+}
+
+static int wait_aux_ready(struct bmi270 *sensor)
+{
+    uint8_t status;
+    int result;
+
+    for (int i = 0; i < 100; i++)
+    {
+        if ((result = read_register(sensor, STATUS, &status)) < 0)
+            return result;
+
+        if (!(status & AUX_BUSY))
+            return 0;
+
+        usleep(100);
+    }
+
+    bmi270_log(BMI270_LOG_ERROR, "0x%X --> AUX interface busy (timeout)", sensor->i2c_addr);
+    return set_error(sensor, -ETIMEDOUT, STATUS);
+}
+
+int setup_aux(struct bmi270 *sensor, uint8_t aux_addr)
+{
+    uint8_t pwr_conf;
+    int result;
+
+    if ((result = read_register(sensor, PWR_CONF, &pwr_conf)) < 0)
+        return result;
+
+    // AUX configuration needs advanced power save disabled
+    if (pwr_conf & FIELD_MASK(PWR_CONF_ADV_PS))
+    {
+        if ((result = write_register(sensor, PWR_CONF, pwr_conf & ~FIELD_MASK(PWR_CONF_ADV_PS))) < 0)
+            return result;
+
+        usleep(450);
+    }
+
+    if ((result = update_register(sensor, PWR_CTRL, 0, FIELD_MASK(PWR_CTRL_AUX_EN))) == 0 &&
+        (result = update_register(sensor, IF_CONF, 0, AUX_IF_EN)) == 0 &&
+        (result = write_register(sensor, AUX_DEV_ID, aux_addr << 1)) == 0)
+        result = write_register(sensor, AUX_IF_CONF, AUX_MANUAL_EN | (AUX_BURST_8 << 2) | AUX_BURST_8);
+
+    // Earlier low power configuration stays in place
+    if (pwr_conf & FIELD_MASK(PWR_CONF_ADV_PS))
+    {
+        int restored = write_register(sensor, PWR_CONF, pwr_conf);
+
+        if (result == 0)
+            result = restored;
+    }
+
+    if (result < 0)
+        return result;
+
+    sensor->aux_addr = aux_addr;
+    sensor->aux_len = AUX_DATA_LEN;
+
+    bmi270_log(BMI270_LOG_INFO, "0x%X --> AUX interface set up for device 0x%X (manual mode)", sensor->i2c_addr, aux_addr);
+    return 0;
+}
+
+int write_aux_register(struct bmi270 *sensor, uint8_t reg_addr, uint8_t value)
+{
+    int result;
+
+    // Writing the address triggers the transfer
+    if ((result = write_register(sensor, AUX_WR_DATA, value)) < 0 ||
+        (result = write_register(sensor, AUX_WR_ADDR, reg_addr)) < 0)
+        return result;
+
+    return wait_aux_ready(sensor);
+}
+
+int read_aux_register(struct bmi270 *sensor, uint8_t reg_addr, uint8_t *data, uint8_t len)
+{
+    uint8_t burst = aux_burst_code(len);
+    int result;
+
+    if (len == 0 || len > AUX_DATA_LEN)
+        return set_error(sensor, -EINVAL, AUX_RD_ADDR);
+
+    // Writing the address triggers the transfer
+    if ((result = update_register(sensor, AUX_IF_CONF, BIT_3 | BIT_2, AUX_MANUAL_EN | (burst << 2))) < 0 ||
+        (result = write_register(sensor, AUX_RD_ADDR, reg_addr)) < 0 ||
+        (result = wait_aux_ready(sensor)) < 0)
+        return result;
+
+    return read_register_block(sensor, AUX_DATA, data, len);
+}
+
+int start_aux_autonomous(struct bmi270 *sensor, uint8_t reg_addr, uint8_t burst, uint8_t odr)
+{
+    int result;
+
+    if (burst > AUX_BURST_8 || odr < AUX_ODR_12_5 || odr > AUX_ODR_800)
+    {
+        bmi270_log(BMI270_LOG_ERROR, "0x%X --> Wrong AUX burst or ODR. Use 'AUX_BURST_*' and 'AUX_ODR_*'", sensor->i2c_addr);
+        return set_error(sensor, -EINVAL, AUX_CONF);
+    }
+
+    // Leaving manual mode starts the autonomous reads at AUX ODR
+    if ((result = write_register(sensor, AUX_CONF, odr)) < 0 ||
+        (result = write_register(sensor, AUX_RD_ADDR, reg_addr)) < 0 ||
+        (result = write_register(sensor, AUX_IF_CONF, (burst << 2) | burst)) < 0)
+        return result;
+
+    sensor->aux_len = aux_burst_len(burst);
+
+    bmi270_log(BMI270_LOG_INFO, "0x%X --> AUX autonomous mode started (register 0x%X, %d bytes, ODR %d Hz)", sensor->i2c_addr, reg_addr, sensor->aux_len, 3200 >> (GYR_ODR_3200 - odr));
+    return 0;
+}
+
+int stop_aux_autonomous(struct bmi270 *sensor)
+{
+    int result;
+
+    if ((result = update_register(sensor, AUX_IF_CONF, 0, AUX_MANUAL_EN)) < 0 ||
+        (result = wait_aux_ready(sensor)) < 0)
+        return result;
+
+    bmi270_log(BMI270_LOG_INFO, "0x%X --> AUX autonomous mode stopped (manual mode)", sensor->i2c_addr);
+    return 0;
+}
+
+int enable_fifo_aux(struct bmi270 *sensor)
+{
+    return update_and_log(sensor, FIFO_CONFIG_1, 0, FIELD_MASK(FIFO_AUX_EN), "AUX data stored in FIFO");
+}
+
+int disable_fifo_aux(struct bmi270 *sensor)
+{
+    return update_and_log(sensor, FIFO_CONFIG_1, FIELD_MASK(FIFO_AUX_EN), 0, "AUX data not stored in FIFO");
+}
+
+int get_aux_raw(struct bmi270 *sensor, uint8_t *data)
+{
+    return read_register_block(sensor, AUX_DATA, data, sensor->aux_len ? sensor->aux_len : AUX_DATA_LEN);
+}
+
+int get_aux_acc_gyr_raw(struct bmi270 *sensor, uint8_t *aux, int16_t *acc, int16_t *gyr)
+{
+    uint8_t buffer[AUX_DATA_LEN + 12];
+    int result;
+
+    // DATA_0 - DATA_7, ACC and GYR are contiguous: one burst for 9-DoF
+    if ((result = read_register_block(sensor, AUX_DATA, (uint8_t *)&buffer, sizeof(buffer))) < 0)
+        return result;
+
+    for (int i = 0; i < AUX_DATA_LEN; i++)
+    {
+        aux[i] = buffer[i];
+    }
+
+    for (int i = 0; i < 3; i++)
+    {
+        acc[i] = (buffer[AUX_DATA_LEN + 2 * i + 1] << 8) | buffer[AUX_DATA_LEN + 2 * i];
+        gyr[i] = (buffer[AUX_DATA_LEN + 6 + 2 * i + 1] << 8) | buffer[AUX_DATA_LEN + 6 + 2 * i];
+    }
+
+    return 0;
+}
+
+static int read_acc_mg(struct bmi270 *sensor, int32_t *acc_mg)
+{
+    int16_t acc[3], gyr[3];
+    int result;
+
+    if ((result = get_acc_gyr_raw(sensor, acc, gyr)) < 0)
+        return result;
+
+    // +/- 16g: 2048 LSB/g
+    for (int i = 0; i < 3; i++)
+    {
+        acc_mg[i] = (int32_t)acc[i] * 1000 / 2048;
+    }
+
+    return 0;
+}
+
+int perform_acc_self_test(struct bmi270 *sensor, int32_t *diff_mg)
+{
+    int32_t positive[3], negative[3];
+    uint8_t saved[3], pwr_conf;
+    int result, passed;
+
+    // ACC_CONF, ACC_RANGE and PWR_CTRL are restored afterwards
+    if ((result = read_register_block(sensor, ACC_CONF, saved, 2)) < 0 ||
+        (result = read_register(sensor, PWR_CTRL, &saved[2])) < 0 ||
+        (result = read_register(sensor, PWR_CONF, &pwr_conf)) < 0)
+        return result;
+
+    if ((result = write_register(sensor, PWR_CONF, pwr_conf & ~FIELD_MASK(PWR_CONF_ADV_PS))) < 0)
+        return result;
+
+    usleep(450);
+
+    if ((result = write_register(sensor, PWR_CTRL, saved[2] | FIELD_MASK(PWR_CTRL_ACC_EN))) < 0 ||
+        (result = write_register(sensor, ACC_CONF, ACC_ST_CONF)) < 0 ||
+        (result = write_register(sensor, ACC_RANGE, ACC_RANGE_16G)) < 0)
+        goto restore;
+
+    usleep(2000);
+
+    if ((result = write_register(sensor, ACC_SELF_TEST, ACC_ST_AMP_HIGH | ACC_ST_SIGN_POS | ACC_ST_EN)) < 0)
+        goto restore;
+
+    usleep(ACC_ST_DELAY_US);
+
+    if ((result = read_acc_mg(sensor, positive)) < 0 ||
+        (result = write_register(sensor, ACC_SELF_TEST, ACC_ST_AMP_HIGH | ACC_ST_EN)) < 0)
+        goto restore;
+
+    usleep(ACC_ST_DELAY_US);
+
+    if ((result = read_acc_mg(sensor, negative)) < 0)
+        goto restore;
+
+    for (int i = 0; i < 3; i++)
+    {
+        diff_mg[i] = positive[i] - negative[i];
+    }
+
+restore:
+    // Restore even after a bus error, the first failure is reported
+    if ((passed = write_register(sensor, ACC_SELF_TEST, 0x00)) < 0 && result == 0)
+        result = passed;
+
+    if ((passed = write_register_block(sensor, ACC_CONF, 2, saved)) < 0 && result == 0)
+        result = passed;
+
+    if ((passed = write_register(sensor, PWR_CTRL, saved[2])) < 0 && result == 0)
+        result = passed;
+
+    if ((passed = write_register(sensor, PWR_CONF, pwr_conf)) < 0 && result == 0)
+        result = passed;
+
+    if (result < 0)
+        return result;
+
+    passed = diff_mg[0] >= ACC_ST_X_MIN_MG && diff_mg[1] <= ACC_ST_Y_MAX_MG && diff_mg[2] >= ACC_ST_Z_MIN_MG;
+
+    bmi270_log(passed ? BMI270_LOG_INFO : BMI270_LOG_WARN, "0x%X --> Accelerometer self-test %s (x: %d mg, y: %d mg, z: %d mg)",
+               sensor->i2c_addr, passed ? "passed" : "FAILED", diff_mg[0], diff_mg[1], diff_mg[2]);
+
+    return passed;
+}
+
+int perform_gyr_self_test(struct bmi270 *sensor, uint8_t *axes)
+{
+    uint8_t page[FEAT_PAGE_SIZE];
+    uint8_t pwr_ctrl, pwr_conf, g_trig = 0;
+    int result, passed, waited = 0, page_read = 0;
+
+    *axes = 0;
+
+    // The self-test runs on the feature engine and needs the accelerometer
+    if ((result = read_register(sensor, PWR_CTRL, &pwr_ctrl)) < 0 ||
+        (result = read_register(sensor, PWR_CONF, &pwr_conf)) < 0)
+        return result;
+
+    if ((result = write_register(sensor, PWR_CONF, pwr_conf & ~FIELD_MASK(PWR_CONF_ADV_PS))) < 0)
+        return result;
+
+    usleep(450);
+
+    if ((result = write_register(sensor, PWR_CTRL, pwr_ctrl | FIELD_MASK(PWR_CTRL_ACC_EN))) < 0 ||
+        (result = read_feature_page(sensor, 1, page)) < 0)
+        goto restore;
+
+    // G_TRIGGER runs the self-test instead of the component retrimming (CRT)
+    g_trig = page[FEAT_OFF_G_TRIG_1];
+    page_read = 1;
+    page[FEAT_OFF_G_TRIG_1] = (g_trig | G_TRIG_SELECT) & ~G_TRIG_BLOCK;
+
+    if ((result = write_feature_page(sensor, 1, page)) < 0 ||
+        (result = write_register(sensor, CMD, G_TRIGGER)) < 0)
+        goto restore;
+
+    do
+    {
+        usleep(10000);
+        waited += 10;
+
+        if ((result = read_register(sensor, GYR_SELF_TEST_AXES, axes)) < 0)
+            goto restore;
+    } while (!(*axes & GYR_ST_DONE) && waited < GYR_ST_TIMEOUT_MS);
+
+    if (!(*axes & GYR_ST_DONE))
+        result = set_error(sensor, -ETIMEDOUT, GYR_SELF_TEST_AXES);
+
+restore:
+    // Restore even after a bus error, the first failure is reported: a later G_TRIGGER runs CRT again
+    if (page_read)
+    {
+        page[FEAT_OFF_G_TRIG_1] = g_trig;
+
+        if ((passed = write_feature_page(sensor, 1, page)) < 0 && result == 0)
+            result = passed;
+    }
+
+    if ((passed = write_register(sensor, PWR_CTRL, pwr_ctrl)) < 0 && result == 0)
+        result = passed;
+
+    if ((passed = write_register(sensor, PWR_CONF, pwr_conf)) < 0 && result == 0)
+        result = passed;
+
+    if (result < 0)
+        return result;
+
+    passed = (*axes & GYR_ST_AXES_OK) == GYR_ST_AXES_OK;
+
+    bmi270_log(passed ? BMI270_LOG_INFO : BMI270_LOG_WARN, "0x%X --> Gyroscope self-test %s (axes: 0x%X)",
+               sensor->i2c_addr, passed ? "passed" : "FAILED", *axes);
+
+    return passed;
+}
+
+int get_error_status(struct bmi270 *sensor, uint8_t *err_reg, uint8_t *internal_status)
+{
+    int result;
+
+    if ((result = read_register(sensor, ERR_REG, err_reg)) < 0 ||
+        (result = read_register(sensor, INTERNAL_STATUS, internal_status)) < 0)
+        return result;
+
+    sensor->internal_status = *internal_status;
+
+    return 0;
 }
@@ -3,17 +3,42 @@
 #ifndef BMI270_H
 #define BMI270_H
 
+#include <stddef.h>
+
 #include "bmi270_defs.h"
 
 /* ----------------------------------------------------
                      FUNCTIONS
 -----------------------------------------------------*/
 
+/*
+ * All functions returning int return 0 on success or a negative errno value
+ * (-EIO, -EINVAL, -ENODEV, ...) which is also stored as the sensor's last error.
+ */
+
 /* Print 8 bit value as binary */
 void print_binary(uint8_t num);
 
+/* Set log handler (NULL = silent, default) for messages up to level (BMI270_LOG_*) */
+void bmi270_set_log_handler(bmi270_log_handler handler, uint8_t level, void *ctx);
+
+/* Log handler printing to the FILE * passed as ctx (stdout if NULL) */
+void bmi270_log_print(uint8_t level, const char *message, void *ctx);
+
+/* Emit log message through the log handler */
+void bmi270_log(uint8_t level, const char *format, ...) __attribute__((format(printf, 2, 3)));
+
+/* Get last error (negative errno, 0 = none) and the register involved */
+int bmi270_get_last_error(struct bmi270 *sensor, uint8_t *reg);
+
+/* Record an error as last error (negative errno, register involved) - returns code */
+int bmi270_set_error(struct bmi270 *sensor, int code, uint8_t reg);
+
+/* Clear last error */
+void bmi270_clear_error(struct bmi270 *sensor);
+
 /* Read 8 bit out of 8 bit register */
-uint8_t read_register(struct bmi270 *sensor, uint8_t reg);
+int read_register(struct bmi270 *sensor, uint8_t reg, uint8_t *value);
 
 /* Read block of 8 bit values out of 8 bit register */
 int read_register_block(struct bmi270 *sensor, uint8_t reg_addr, uint8_t *data, uint8_t len);
@@ -24,103 +49,268 @@ int write_register(struct bmi270 *sensor, uint8_t reg, uint8_t val);
 /* Write block of 8 bit values into 8 bit register */
 int write_register_block(struct bmi270 *sensor, uint8_t reg_addr, uint8_t len, const uint8_t *data);
 
-/* Load config file from bmi270_config_file.h into sensor */
+/* Read-modify-write: clear bits, then set bits of an 8 bit register */
+int update_register(struct bmi270 *sensor, uint8_t reg_addr, uint8_t clear, uint8_t set);
+
+/* CRC-32 (IEEE 802.3) of data */
+uint32_t bmi270_crc32(const uint8_t *data, size_t len);
+
+/* Upload data (CONFIG_FILE_SIZE bytes, kept by the caller) instead of the embedded config file, NULL = embedded - -EBADMSG on CRC mismatch */
+int bmi270_set_config_file(struct bmi270 *sensor, const uint8_t *data, uint32_t crc);
+
+/* Read a CONFIG_FILE_SIZE byte config file from path into data and compute its CRC */
+int bmi270_read_config_file(const char *path, uint8_t *data, uint32_t *crc);
+
+/* Load config file into sensor - skipped if already initialized with the expected version (config_version, see struct bmi270) */
 int load_config_file(struct bmi270 *sensor);
 
+/* Prepare config file upload (advanced power save off, INIT_CTRL = 0) */
+int load_config_start(struct bmi270 *sensor);
+
+/* Upload one CONFIG_CHUNK_SIZE byte chunk (0 - CONFIG_NUM_CHUNKS - 1) of the config file */
+int load_config_chunk(struct bmi270 *sensor, uint16_t chunk);
+
+/* Read back the uploaded config file in CONFIG_VERIFY_SIZE bursts, before load_config_finish - -EIO on mismatch */
+int verify_config_file(struct bmi270 *sensor);
+
+/* Finish config file upload (INIT_CTRL = 1), INTERNAL_STATUS is valid after ~20 ms */
+int load_config_finish(struct bmi270 *sensor);
+
+/* Get the version of the running config file (feature page 1) */
+int get_config_version(struct bmi270 *sensor, uint16_t *version);
+
 /* Initialize sensor - Includes I2C setup and the config file load */
 int bmi270_init(struct bmi270 *sensor);
 
+/* Initialize sensor on I2C bus device (e.g. "/dev/i2c-3") */
+int bmi270_init_bus(struct bmi270 *sensor, const char *device);
+
+/* Initialize sensor on an already opened I2C bus fd, which may be shared with other devices */
+int bmi270_init_fd(struct bmi270 *sensor, int fd);
+
+/* Close the I2C bus if it was opened by bmi270_init / bmi270_init_bus */
+int bmi270_close(struct bmi270 *sensor);
+
 /* Set sensor mode: Low power, Normal, Performance */
-void set_mode(struct bmi270 *sensor, uint8_t mode);
+int set_mode(struct bmi270 *sensor, uint8_t mode);
 
 /* Enable auxiliary sensor interface */
-void enable_aux(struct bmi270 *sensor);
+int enable_aux(struct bmi270 *sensor);
 
 /* Disable auxiliary sensor interface */
-void disable_aux(struct bmi270 *sensor);
+int disable_aux(struct bmi270 *sensor);
 
 /* Enable accelerometer */
-void enable_acc(struct bmi270 *sensor);
+int enable_acc(struct bmi270 *sensor);
 
 /* Disable accelerometer */
-void disable_acc(struct bmi270 *sensor);
+int disable_acc(struct bmi270 *sensor);
 
 /* Enable gyroscope */
-void enable_gyr(struct bmi270 *sensor);
+int enable_gyr(struct bmi270 *sensor);
 
 /* Disable gyroscope */
-void disable_gyr(struct bmi270 *sensor);
+int disable_gyr(struct bmi270 *sensor);
 
 /* Enable temperatur sensor */
-void enable_temp(struct bmi270 *sensor);
+int enable_temp(struct bmi270 *sensor);
 
 /* Disable temperatur sensor */
-void disable_temp(struct bmi270 *sensor);
+int disable_temp(struct bmi270 *sensor);
 
 /* Set accelerometer range */
-void set_acc_range(struct bmi270 *sensor, uint8_t range);
+int set_acc_range(struct bmi270 *sensor, uint8_t range);
 
 /* Set gyroscope range */
-void set_gyr_range(struct bmi270 *sensor, uint8_t range);
+int set_gyr_range(struct bmi270 *sensor, uint8_t range);
 
-/* Set accelerometer output data rate */
-void set_acc_odr(struct bmi270 *sensor, uint8_t odr);
+/* Set accelerometer output data rate - below ACC_ODR_12_5 only with the filter performance off (-EINVAL) */
+int set_acc_odr(struct bmi270 *sensor, uint8_t odr);
 
 /* Set gyroscope output data rate */
-void set_gyr_odr(struct bmi270 *sensor, uint8_t odr);
+int set_gyr_odr(struct bmi270 *sensor, uint8_t odr);
 
 /* Set accelerometer bandwidth parameter */
-void set_acc_bwp(struct bmi270 *sensor, uint8_t bwp);
+int set_acc_bwp(struct bmi270 *sensor, uint8_t bwp);
 
 /* Set gyroscope bandwidth */
-void set_gyr_bwp(struct bmi270 *sensor, uint8_t bwp);
+int set_gyr_bwp(struct bmi270 *sensor, uint8_t bwp);
 
 /* Enable FIFO header */
-void enable_fifo_header(struct bmi270 *sensor);
+int enable_fifo_header(struct bmi270 *sensor);
 
 /* Disable FIFO header */
-void disable_fifo_header(struct bmi270 *sensor);
+int disable_fifo_header(struct bmi270 *sensor);
+
+/* Set FIFO watermark (bytes, FIFO_WTM_0/1) - 0 disables the watermark interrupt */
+int set_fifo_watermark(struct bmi270 *sensor, uint16_t bytes);
+
+/* Get FIFO watermark (bytes) */
+int get_fifo_watermark(struct bmi270 *sensor, uint16_t *bytes);
 
 /* Enable data streaming */
-void enable_data_streaming(struct bmi270 *sensor);
+int enable_data_streaming(struct bmi270 *sensor);
 
 /* Disable data streaming */
-void disable_data_streaming(struct bmi270 *sensor);
+int disable_data_streaming(struct bmi270 *sensor);
 
-/* Enable accelerometer filter performance */
-void enable_acc_filter_perf(struct bmi270 *sensor);
+/* Enable accelerometer filter performance - needs an ODR of at least ACC_ODR_12_5 (-EINVAL) */
+int enable_acc_filter_perf(struct bmi270 *sensor);
 
 /* Disable accelerometer filter performance */
-void disable_acc_filter_perf(struct bmi270 *sensor);
+int disable_acc_filter_perf(struct bmi270 *sensor);
 
 /* Enable gyroscope noise performance */
-void enable_gyr_noise_perf(struct bmi270 *sensor);
+int enable_gyr_noise_perf(struct bmi270 *sensor);
 
 /* Disable gyroscope noise performance */
-void disable_gyr_noise_perf(struct bmi270 *sensor);
+int disable_gyr_noise_perf(struct bmi270 *sensor);
 
 /* Enable gyroscope filter performance */
-void enable_gyr_filter_perf(struct bmi270 *sensor);
+int enable_gyr_filter_perf(struct bmi270 *sensor);
 
 /* Disable gyroscope filter performance */
-void disable_gyr_filter_perf(struct bmi270 *sensor);
+int disable_gyr_filter_perf(struct bmi270 *sensor);
 
 /* Get raw accelerometer data */
-void get_acc_raw(struct bmi270 *sensor, int16_t *acc_x_raw, int16_t *acc_y_raw, int16_t *acc_z_raw);
+int get_acc_raw(struct bmi270 *sensor, int16_t *acc_x_raw, int16_t *acc_y_raw, int16_t *acc_z_raw);
 
 /* Get raw gyroscope data */
-void get_gyr_raw(struct bmi270 *sensor, int16_t *gyr_x_raw, int16_t *gyr_y_raw, int16_t *gyr_z_raw);
+int get_gyr_raw(struct bmi270 *sensor, int16_t *gyr_x_raw, int16_t *gyr_y_raw, int16_t *gyr_z_raw);
+
+/* Get raw accelerometer and gyroscope data (x, y, z) in one burst read */
+int get_acc_gyr_raw(struct bmi270 *sensor, int16_t *acc, int16_t *gyr);
+
+/* Get FIFO fill level (bytes) */
+int get_fifo_length(struct bmi270 *sensor, uint16_t *length);
+
+/* Read len bytes out of the FIFO, in FIFO_READ_CHUNK bursts */
+int read_fifo(struct bmi270 *sensor, uint8_t *data, uint16_t len);
+
+/* Parse one frame in place, fifo_config is FIFO_CONFIG_1 - returns bytes consumed, 0 at the end of the data */
+int parse_fifo_frame(const uint8_t *data, uint16_t len, uint8_t fifo_config, struct bmi270_fifo_frame *frame);
 
 /* Get raw temperature data */
-void get_temp_raw(struct bmi270 *sensor, int16_t *temp);
+int get_temp_raw(struct bmi270 *sensor, int16_t *temp);
+
+/* Convert raw accelerometer data (x, y, z) to m/s^2 */
+void convert_acc_raw(struct bmi270 *sensor, const int16_t *raw, double *acc);
+
+/* Convert raw gyroscope data (x, y, z) to rad/s */
+void convert_gyr_raw(struct bmi270 *sensor, const int16_t *raw, double *gyr);
 
 /* Get accelerometer data in m/s^2 */
-void get_acc(struct bmi270 *sensor, double *acc_x, double *acc_y, double *acc_z);
+int get_acc(struct bmi270 *sensor, double *acc_x, double *acc_y, double *acc_z);
 
-/* Get gyroscope data in °/s */
-void get_gyr(struct bmi270 *sensor, double *gyr_x, double *gyr_y, double *gyr_z);
+/* Get gyroscope data in rad/s */
+int get_gyr(struct bmi270 *sensor, double *gyr_x, double *gyr_y, double *gyr_z);
 
 /* Get temperature data in °C */
-void get_temp(struct bmi270 *sensor, double *temp);
+int get_temp(struct bmi270 *sensor, double *temp);
+
+/* Read 16 byte feature configuration page (FEAT_PAGE) */
+int read_feature_page(struct bmi270 *sensor, uint8_t page, uint8_t *data);
+
+/* Write 16 byte feature configuration page (FEAT_PAGE) */
+int write_feature_page(struct bmi270 *sensor, uint8_t page, const uint8_t *data);
+
+/* Enable any-motion detection - duration: 20 ms/LSB, threshold: 0.48 mg/LSB, axes: FEAT_AXIS_* */
+int enable_any_motion(struct bmi270 *sensor, uint16_t duration, uint16_t threshold, uint8_t axes);
+
+/* Disable any-motion detection */
+int disable_any_motion(struct bmi270 *sensor);
+
+/* Enable no-motion detection - duration: 20 ms/LSB, threshold: 0.48 mg/LSB, axes: FEAT_AXIS_* */
+int enable_no_motion(struct bmi270 *sensor, uint16_t duration, uint16_t threshold, uint8_t axes);
+
+/* Disable no-motion detection */
+int disable_no_motion(struct bmi270 *sensor);
+
+/* Enable significant motion detection - block_size: 0 keeps the current value */
+int enable_sig_motion(struct bmi270 *sensor, uint16_t block_size);
+
+/* Disable significant motion detection */
+int disable_sig_motion(struct bmi270 *sensor);
+
+/* Enable step counter, step detector and activity recognition - watermark: 20 steps/LSB (0 = off) */
+int enable_step_counter(struct bmi270 *sensor, uint16_t watermark);
+
+/* Disable step counter, step detector and activity recognition */
+int disable_step_counter(struct bmi270 *sensor);
+
+/* Reset step counter */
+int reset_step_counter(struct bmi270 *sensor);
+
+/* Enable wrist gesture detection */
+int enable_wrist_gesture(struct bmi270 *sensor, uint8_t right_arm);
+
+/* Disable wrist gesture detection */
+int disable_wrist_gesture(struct bmi270 *sensor);
+
+/* Configure interrupt pin electrical behaviour - config: INT_ACTIVE_HIGH | INT_OPEN_DRAIN | INT_OUTPUT_EN */
+int set_int_pin_config(struct bmi270 *sensor, uint8_t int_pin, uint8_t config);
+
+/* Map feature interrupts (*_INT) to interrupt pin */
+int map_feature_int(struct bmi270 *sensor, uint8_t int_pin, uint8_t features);
+
+/* Map data interrupts (FFULL_INT | FWM_INT | DRDY_INT | ERR_INT) to interrupt pin, replacing the previous mapping of that pin */
+int map_data_int(struct bmi270 *sensor, uint8_t int_pin, uint8_t ints);
+
+/* Enable latched interrupts (cleared by reading the status) */
+int enable_int_latch(struct bmi270 *sensor);
+
+/* Disable latched interrupts */
+int disable_int_latch(struct bmi270 *sensor);
+
+/* Get feature interrupt status (INT_STATUS_0, clear on read) */
+int get_feature_int_status(struct bmi270 *sensor, uint8_t *status);
+
+/* Get data interrupt status (INT_STATUS_1, clear on read): *_STATUS bits */
+int get_data_int_status(struct bmi270 *sensor, uint8_t *status);
+
+/* Get step counter value */
+int get_step_count(struct bmi270 *sensor, uint32_t *steps);
+
+/* Get step activity: ACTIVITY_STILL, ACTIVITY_WALKING, ACTIVITY_RUNNING, ACTIVITY_UNKNOWN */
+int get_step_activity(struct bmi270 *sensor, uint8_t *activity);
+
+/* Get last detected wrist gesture: GESTURE_* */
+int get_wrist_gesture(struct bmi270 *sensor, uint8_t *gesture);
+
+/* Set up AUX interface in manual mode for I2C device aux_addr (e.g. a magnetometer), advanced power save is restored */
+int setup_aux(struct bmi270 *sensor, uint8_t aux_addr);
+
+/* Write 8 bit value into register of auxiliary sensor (manual mode) */
+int write_aux_register(struct bmi270 *sensor, uint8_t reg, uint8_t val);
+
+/* Read up to 8 bytes out of auxiliary sensor (manual mode) */
+int read_aux_register(struct bmi270 *sensor, uint8_t reg_addr, uint8_t *data, uint8_t len);
+
+/* Let the BMI270 poll the auxiliary sensor at odr (AUX_ODR_*) into DATA_0 - DATA_7 */
+int start_aux_autonomous(struct bmi270 *sensor, uint8_t reg_addr, uint8_t burst, uint8_t odr);
+
+/* Stop autonomous AUX reads (back to manual mode) */
+int stop_aux_autonomous(struct bmi270 *sensor);
+
+/* Store AUX data in FIFO */
+int enable_fifo_aux(struct bmi270 *sensor);
+
+/* Do not store AUX data in FIFO */
+int disable_fifo_aux(struct bmi270 *sensor);
+
+/* Get raw auxiliary sensor data (aux_len bytes) */
+int get_aux_raw(struct bmi270 *sensor, uint8_t *data);
+
+/* Get raw AUX (8 bytes), accelerometer and gyroscope data in one burst read */
+int get_aux_acc_gyr_raw(struct bmi270 *sensor, uint8_t *aux, int16_t *acc, int16_t *gyr);
+
+/* Run the accelerometer self-test, diff_mg: positive - negative excitation (x, y, z) - returns 1 if passed, 0 if failed */
+int perform_acc_self_test(struct bmi270 *sensor, int32_t *diff_mg);
+
+/* Run the gyroscope self-test, axes: GYR_SELF_TEST_AXES - returns 1 if passed, 0 if failed */
+int perform_gyr_self_test(struct bmi270 *sensor, uint8_t *axes);
+
+/* Get ERR_REG and INTERNAL_STATUS */
+int get_error_status(struct bmi270 *sensor, uint8_t *err_reg, uint8_t *internal_status);
 
 #endif // BMI270_H
\ No newline at end of file
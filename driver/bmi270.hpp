@@ -0,0 +1,336 @@
+#pragma once
+
+#ifndef BMI270_HPP
+#define BMI270_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#if __cplusplus >= 202002L && __has_include(<span>)
+#include <span>
+#endif
+
+extern "C" {
+#include "bmi270.h"
+#include "bmi270_regs.h"
+}
+
+/* ----------------------------------------------------
+                 C++17 WRAPPER (RAII)
+-----------------------------------------------------*/
+
+namespace bmi
+{
+
+/* std::span on C++20, a minimal contiguous view on C++17 */
+#if __cplusplus >= 202002L && __has_include(<span>)
+template <class T>
+using span = std::span<T>;
+#else
+template <class T>
+class span
+{
+public:
+    constexpr span() noexcept = default;
+    constexpr span(T *data, std::size_t size) noexcept : data_(data), size_(size) {}
+
+    template <std::size_t N>
+    constexpr span(T (&array)[N]) noexcept : data_(array), size_(N) {}
+
+    template <class C, class = decltype(std::declval<C &>().data())>
+    constexpr span(C &container) noexcept : data_(container.data()), size_(container.size()) {}
+
+    template <class U, class = std::enable_if_t<std::is_convertible_v<U (*)[], T (*)[]>>>
+    constexpr span(const span<U> &other) noexcept : data_(other.data()), size_(other.size()) {}
+
+    constexpr T *data() const noexcept { return data_; }
+    constexpr std::size_t size() const noexcept { return size_; }
+    constexpr bool empty() const noexcept { return size_ == 0; }
+    constexpr T &operator[](std::size_t i) const noexcept { return data_[i]; }
+    constexpr T *begin() const noexcept { return data_; }
+    constexpr T *end() const noexcept { return data_ + size_; }
+    constexpr span first(std::size_t n) const noexcept { return {data_, n}; }
+    constexpr span subspan(std::size_t offset) const noexcept { return {data_ + offset, size_ - offset}; }
+
+private:
+    T *data_ = nullptr;
+    std::size_t size_ = 0;
+};
+#endif
+
+/* Throws std::system_error for negative errno results */
+inline int check(int result)
+{
+    if (result < 0)
+        throw std::system_error(-result, std::generic_category(), "bmi270");
+
+    return result;
+}
+
+/* Fixed point sample value: SI units scaled by 2^Frac */
+template <int Frac>
+struct Fixed
+{
+    int32_t raw;
+
+    constexpr double value() const noexcept { return static_cast<double>(raw) / (1 << Frac); }
+};
+
+/* Conversion of raw counts into T, scale = SI units per count */
+template <class T>
+struct SampleTraits
+{
+    static_assert(std::is_floating_point_v<T>, "use int16_t, a floating point type or Fixed<N>");
+
+    static constexpr T convert(int16_t raw, double scale) noexcept { return static_cast<T>(raw * scale); }
+};
+
+template <>
+struct SampleTraits<int16_t>
+{
+    static constexpr int16_t convert(int16_t raw, double) noexcept { return raw; }
+};
+
+template <int Frac>
+struct SampleTraits<Fixed<Frac>>
+{
+    static constexpr Fixed<Frac> convert(int16_t raw, double scale) noexcept
+    {
+        return {static_cast<int32_t>(raw * scale * (1 << Frac))};
+    }
+};
+
+/* Accelerometer (m/s^2) and gyroscope (rad/s) sample, raw counts for int16_t */
+template <class T = int16_t>
+struct Sample
+{
+    T acc[3];
+    T gyr[3];
+};
+
+/* Scale of one raw count in SI units */
+struct Scale
+{
+    double acc;
+    double gyr;
+
+    template <class T>
+    Sample<T> convert(const int16_t *acc, const int16_t *gyr) const noexcept
+    {
+        return {{SampleTraits<T>::convert(acc[0], this->acc), SampleTraits<T>::convert(acc[1], this->acc), SampleTraits<T>::convert(acc[2], this->acc)},
+                {SampleTraits<T>::convert(gyr[0], this->gyr), SampleTraits<T>::convert(gyr[1], this->gyr), SampleTraits<T>::convert(gyr[2], this->gyr)}};
+    }
+};
+
+/* FIFO frame parsed in place: payload pointers reference the FIFO buffer */
+class Frame
+{
+public:
+    explicit Frame(const bmi270_fifo_frame &frame) noexcept : frame_(frame) {}
+
+    uint8_t type() const noexcept { return frame_.type; }
+    bool has_acc() const noexcept { return frame_.acc != nullptr; }
+    bool has_gyr() const noexcept { return frame_.gyr != nullptr; }
+    const uint8_t *aux() const noexcept { return frame_.aux; }
+    uint32_t sensortime() const noexcept { return frame_.sensortime; }
+    const bmi270_fifo_frame &raw() const noexcept { return frame_; }
+
+    int16_t acc(int axis) const noexcept { return FIFO_AXIS(frame_.acc, axis); }
+    int16_t gyr(int axis) const noexcept { return FIFO_AXIS(frame_.gyr, axis); }
+
+    /* Accelerometer and gyroscope sample, only valid if has_acc() and has_gyr() */
+    template <class T = int16_t>
+    Sample<T> sample(const Scale &scale) const noexcept
+    {
+        const int16_t acc_raw[3] = {acc(0), acc(1), acc(2)};
+        const int16_t gyr_raw[3] = {gyr(0), gyr(1), gyr(2)};
+
+        return scale.convert<T>(acc_raw, gyr_raw);
+    }
+
+private:
+    bmi270_fifo_frame frame_;
+};
+
+/* Range over the frames of a FIFO buffer: for (const Frame &frame : FifoFrames(data, config)) */
+class FifoFrames
+{
+public:
+    class iterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = Frame;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Frame *;
+        using reference = const Frame &;
+
+        iterator() noexcept = default;
+        iterator(const uint8_t *data, std::size_t len, uint8_t config) noexcept : data_(data), len_(len), config_(config) { advance(); }
+
+        reference operator*() const noexcept { return frame_; }
+        pointer operator->() const noexcept { return &frame_; }
+        iterator &operator++() noexcept { advance(); return *this; }
+        bool operator==(const iterator &other) const noexcept { return data_ == other.data_; }
+        bool operator!=(const iterator &other) const noexcept { return data_ != other.data_; }
+
+    private:
+        void advance() noexcept
+        {
+            bmi270_fifo_frame raw;
+            uint16_t len = len_ > UINT16_MAX ? UINT16_MAX : static_cast<uint16_t>(len_);
+            int consumed;
+
+            // End of data, empty marker or a corrupt header: become the end iterator
+            if (data_ == nullptr || (consumed = parse_fifo_frame(data_, len, config_, &raw)) <= 0)
+            {
+                data_ = nullptr;
+                return;
+            }
+
+            frame_ = Frame(raw);
+            data_ += consumed;
+            len_ -= consumed;
+        }
+
+        const uint8_t *data_ = nullptr;
+        std::size_t len_ = 0;
+        uint8_t config_ = 0;
+        Frame frame_{bmi270_fifo_frame{}};
+    };
+
+    FifoFrames(span<const uint8_t> data, uint8_t fifo_config) noexcept : data_(data), config_(fifo_config) {}
+
+    iterator begin() const noexcept { return iterator(data_.data(), data_.size(), config_); }
+    iterator end() const noexcept { return iterator(); }
+
+private:
+    span<const uint8_t> data_;
+    uint8_t config_;
+};
+
+/* Move-only sensor handle, the I2C bus is closed with the handle */
+class Bmi270
+{
+public:
+    /* Open bus and load the config file, throws std::system_error */
+    explicit Bmi270(uint8_t i2c_addr = I2C_PRIM_ADDR, const char *bus = I2C_DEVICE) : sensor_()
+    {
+        sensor_.i2c_addr = i2c_addr;
+        sensor_.i2c_fd = -1;
+
+        // No handle without a working sensor: the bus is never left open
+        if (int result = bmi270_init_bus(&sensor_, bus); result < 0)
+        {
+            bmi270_close(&sensor_);
+            check(result);
+        }
+    }
+
+    /* Take over an initialized C sensor */
+    explicit Bmi270(const struct bmi270 &sensor) noexcept : sensor_(sensor) {}
+
+    Bmi270(const Bmi270 &) = delete;
+    Bmi270 &operator=(const Bmi270 &) = delete;
+
+    Bmi270(Bmi270 &&other) noexcept : sensor_(other.sensor_) { other.sensor_.owns_fd = 0; }
+
+    Bmi270 &operator=(Bmi270 &&other) noexcept
+    {
+        if (this != &other)
+        {
+            bmi270_close(&sensor_);
+            sensor_ = other.sensor_;
+            other.sensor_.owns_fd = 0;
+        }
+
+        return *this;
+    }
+
+    ~Bmi270() { bmi270_close(&sensor_); }
+
+    /* C API access for everything not wrapped here */
+    struct bmi270 *get() noexcept { return &sensor_; }
+    const struct bmi270 *get() const noexcept { return &sensor_; }
+
+    void set_mode(uint8_t mode) { check(::set_mode(&sensor_, mode)); }
+    void set_acc_range(uint8_t range) { check(::set_acc_range(&sensor_, range)); }
+    void set_gyr_range(uint8_t range) { check(::set_gyr_range(&sensor_, range)); }
+    void set_acc_odr(uint8_t odr) { check(::set_acc_odr(&sensor_, odr)); }
+    void set_gyr_odr(uint8_t odr) { check(::set_gyr_odr(&sensor_, odr)); }
+    void set_fifo_watermark(uint16_t bytes) { check(::set_fifo_watermark(&sensor_, bytes)); }
+
+    Scale scale() const noexcept { return {sensor_.acc_range / 32768.0, sensor_.gyr_range / 32768.0}; }
+
+    /* One acc + gyr sample from the data registers */
+    template <class T = int16_t>
+    Sample<T> sample()
+    {
+        int16_t acc[3], gyr[3];
+
+        check(get_acc_gyr_raw(&sensor_, acc, gyr));
+        return scale().convert<T>(acc, gyr);
+    }
+
+    /* Read the FIFO into buffer - returns the filled part, ends on a frame boundary only in header mode */
+    span<uint8_t> read_fifo(span<uint8_t> buffer)
+    {
+        uint16_t length;
+
+        check(get_fifo_length(&sensor_, &length));
+
+        if (length > buffer.size())
+            length = static_cast<uint16_t>(buffer.size());
+
+        check(::read_fifo(&sensor_, buffer.data(), length));
+        return buffer.first(length);
+    }
+
+    /* FIFO_CONFIG_1, needed to parse frames */
+    uint8_t fifo_config()
+    {
+        uint8_t config;
+
+        check(read_register(&sensor_, FIFO_CONFIG_1, &config));
+        return config;
+    }
+
+    /* Read the FIFO into scratch and convert its acc + gyr frames into out - returns the number of samples,
+       frames that do not fit into out stay in the FIFO */
+    template <class T = int16_t>
+    std::size_t read(span<Sample<T>> out, span<uint8_t> scratch)
+    {
+        const uint8_t config = fifo_config();
+        const std::size_t frame_size = (config & FIELD_MASK(FIFO_HEADER_EN) ? 1 : 0) +
+                                       (config & FIELD_MASK(FIFO_ACC_EN) ? 6 : 0) +
+                                       (config & FIELD_MASK(FIFO_GYR_EN) ? 6 : 0) +
+                                       (config & FIELD_MASK(FIFO_AUX_EN) ? AUX_DATA_LEN : 0);
+        const Scale s = scale();
+        std::size_t count = 0;
+
+        if (scratch.size() > out.size() * frame_size)
+            scratch = scratch.first(out.size() * frame_size);
+
+        for (const Frame &frame : FifoFrames(read_fifo(scratch), config))
+        {
+            if (count == out.size())
+                break;
+
+            if (frame.has_acc() && frame.has_gyr())
+                out[count++] = frame.sample<T>(s);
+        }
+
+        return count;
+    }
+
+private:
+    struct bmi270 sensor_;
+};
+
+} // namespace bmi
+
+#endif // BMI270_HPP
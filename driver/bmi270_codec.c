@@ -0,0 +1,286 @@
+#include <errno.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#include "bmi270_codec.h"
+
+/* ----------------------------------------------------
+                  HELPER FUNCTIONS
+-----------------------------------------------------*/
+
+static inline uint16_t zigzag(uint16_t value)
+{
+    return (uint16_t)(value << 1) ^ (uint16_t)((int16_t)value >> 15);
+}
+
+static inline uint16_t unzigzag(uint16_t value)
+{
+    return (value >> 1) ^ (uint16_t)-(value & 1);
+}
+
+static inline uint8_t bit_width(uint16_t value)
+{
+    return value ? 32 - __builtin_clz(value) : 0;
+}
+
+/* Zigzag residuals of both predictors for values [first, total), stride = channels */
+static void predict(const int16_t *samples, uint16_t *delta, uint16_t *linear, size_t first, size_t total, size_t stride)
+{
+    const uint16_t *x = (const uint16_t *)samples;
+    size_t k = first;
+
+    // Flat over the interleaved values: x[k - stride] is the same channel one sample earlier
+#if defined(__SSE2__)
+    for (; k + 8 <= total; k += 8)
+    {
+        __m128i x0 = _mm_loadu_si128((const __m128i *)(x + k));
+        __m128i x1 = _mm_loadu_si128((const __m128i *)(x + k - stride));
+        __m128i x2 = _mm_loadu_si128((const __m128i *)(x + k - 2 * stride));
+        __m128i d = _mm_sub_epi16(x0, x1);
+        __m128i l = _mm_sub_epi16(d, _mm_sub_epi16(x1, x2));
+
+        _mm_storeu_si128((__m128i *)(delta + k), _mm_xor_si128(_mm_slli_epi16(d, 1), _mm_srai_epi16(d, 15)));
+        _mm_storeu_si128((__m128i *)(linear + k), _mm_xor_si128(_mm_slli_epi16(l, 1), _mm_srai_epi16(l, 15)));
+    }
+#elif defined(__ARM_NEON)
+    for (; k + 8 <= total; k += 8)
+    {
+        int16x8_t x0 = vreinterpretq_s16_u16(vld1q_u16(x + k));
+        int16x8_t x1 = vreinterpretq_s16_u16(vld1q_u16(x + k - stride));
+        int16x8_t x2 = vreinterpretq_s16_u16(vld1q_u16(x + k - 2 * stride));
+        int16x8_t d = vsubq_s16(x0, x1);
+        int16x8_t l = vsubq_s16(d, vsubq_s16(x1, x2));
+
+        vst1q_u16(delta + k, vreinterpretq_u16_s16(veorq_s16(vshlq_n_s16(d, 1), vshrq_n_s16(d, 15))));
+        vst1q_u16(linear + k, vreinterpretq_u16_s16(veorq_s16(vshlq_n_s16(l, 1), vshrq_n_s16(l, 15))));
+    }
+#endif
+
+    for (; k < total; k++)
+    {
+        uint16_t d = x[k] - x[k - stride];
+
+        delta[k] = zigzag(d);
+        linear[k] = zigzag(d - (uint16_t)(x[k - stride] - x[k - 2 * stride]));
+    }
+}
+
+/* Undo the zigzag mapping in place */
+static void unzigzag_all(uint16_t *values, size_t total)
+{
+    size_t k = 0;
+
+#if defined(__SSE2__)
+    const __m128i one = _mm_set1_epi16(1);
+
+    for (; k + 8 <= total; k += 8)
+    {
+        __m128i z = _mm_loadu_si128((const __m128i *)(values + k));
+        __m128i sign = _mm_sub_epi16(_mm_setzero_si128(), _mm_and_si128(z, one));
+
+        _mm_storeu_si128((__m128i *)(values + k), _mm_xor_si128(_mm_srli_epi16(z, 1), sign));
+    }
+#elif defined(__ARM_NEON)
+    const uint16x8_t one = vdupq_n_u16(1);
+
+    for (; k + 8 <= total; k += 8)
+    {
+        uint16x8_t z = vld1q_u16(values + k);
+        uint16x8_t sign = vreinterpretq_u16_s16(vnegq_s16(vreinterpretq_s16_u16(vandq_u16(z, one))));
+
+        vst1q_u16(values + k, veorq_u16(vshrq_n_u16(z, 1), sign));
+    }
+#endif
+
+    for (; k < total; k++)
+    {
+        values[k] = unzigzag(values[k]);
+    }
+}
+
+static size_t packed_size(uint16_t count, uint8_t width)
+{
+    return ((size_t)(count - 1) * width + 7) / 8;
+}
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+size_t bmi270_codec_bound(uint16_t count, uint8_t channels)
+{
+    return CODEC_HEADER_SIZE + (size_t)channels * (CODEC_CHANNEL_SIZE + packed_size(count, 16));
+}
+
+int bmi270_codec_encode(struct bmi270_codec *codec, const int16_t *samples, uint16_t count, uint8_t channels, uint8_t *out, size_t size)
+{
+    size_t total = (size_t)count * channels, pos;
+    uint8_t pred[CODEC_MAX_CHANNELS], width[CODEC_MAX_CHANNELS];
+
+    if (count == 0 || count > CODEC_MAX_COUNT || channels == 0 || channels > CODEC_MAX_CHANNELS)
+        return -EINVAL;
+
+    // Second sample: no history for the linear predictor, both fall back to delta
+    if (count > 1)
+    {
+        for (size_t k = channels; k < 2 * (size_t)channels && k < total; k++)
+        {
+            uint16_t d = zigzag((uint16_t)samples[k] - (uint16_t)samples[k - channels]);
+
+            codec->residuals[CODEC_PRED_DELTA][k] = d;
+            codec->residuals[CODEC_PRED_LINEAR][k] = d;
+        }
+
+        predict(samples, codec->residuals[CODEC_PRED_DELTA], codec->residuals[CODEC_PRED_LINEAR], 2 * (size_t)channels, total, channels);
+    }
+
+    pos = CODEC_HEADER_SIZE + (size_t)channels * CODEC_CHANNEL_SIZE;
+
+    // Narrowest width per channel decides the predictor
+    for (uint8_t c = 0; c < channels; c++)
+    {
+        uint16_t any_delta = 0, any_linear = 0;
+
+        for (size_t k = channels + c; k < total; k += channels)
+        {
+            any_delta |= codec->residuals[CODEC_PRED_DELTA][k];
+            any_linear |= codec->residuals[CODEC_PRED_LINEAR][k];
+        }
+
+        pred[c] = bit_width(any_linear) < bit_width(any_delta) ? CODEC_PRED_LINEAR : CODEC_PRED_DELTA;
+        width[c] = bit_width(pred[c] == CODEC_PRED_LINEAR ? any_linear : any_delta);
+        pos += packed_size(count, width[c]);
+    }
+
+    if (pos > size)
+        return -ENOBUFS;
+
+    out[0] = CODEC_MAGIC;
+    out[1] = channels;
+    out[2] = count & FULL_MASK_8BIT;
+    out[3] = count >> 8;
+
+    pos = CODEC_HEADER_SIZE;
+
+    for (uint8_t c = 0; c < channels; c++)
+    {
+        out[pos++] = pred[c] << 5 | width[c];
+        out[pos++] = (uint16_t)samples[c] & FULL_MASK_8BIT;
+        out[pos++] = (uint16_t)samples[c] >> 8;
+    }
+
+    for (uint8_t c = 0; c < channels; c++)
+    {
+        const uint16_t *residuals = codec->residuals[pred[c]];
+        uint64_t bits = 0;
+        uint8_t used = 0;
+
+        // LSB first, every channel starts on a byte boundary
+        for (size_t k = channels + c; k < total; k += channels)
+        {
+            bits |= (uint64_t)residuals[k] << used;
+            used += width[c];
+
+            while (used >= 8)
+            {
+                out[pos++] = bits & FULL_MASK_8BIT;
+                bits >>= 8;
+                used -= 8;
+            }
+        }
+
+        if (used > 0)
+            out[pos++] = bits & FULL_MASK_8BIT;
+    }
+
+    return (int)pos;
+}
+
+int bmi270_codec_decode(struct bmi270_codec *codec, const uint8_t *in, size_t len, int16_t *samples, size_t max_values, uint16_t *count, uint8_t *channels)
+{
+    uint16_t *x = (uint16_t *)samples, *residuals = codec->residuals[0];
+    uint8_t num_channels, pred[CODEC_MAX_CHANNELS], width[CODEC_MAX_CHANNELS];
+    uint16_t num_samples;
+    size_t total, pos, end;
+
+    if (len < CODEC_HEADER_SIZE || in[0] != CODEC_MAGIC)
+        return -EBADMSG;
+
+    num_channels = in[1];
+    num_samples = in[2] | in[3] << 8;
+    total = (size_t)num_samples * num_channels;
+
+    if (num_channels == 0 || num_channels > CODEC_MAX_CHANNELS || num_samples == 0 || num_samples > CODEC_MAX_COUNT)
+        return -EBADMSG;
+
+    if (total > max_values)
+        return -ENOBUFS;
+
+    pos = CODEC_HEADER_SIZE;
+    end = pos + (size_t)num_channels * CODEC_CHANNEL_SIZE;
+
+    if (end > len)
+        return -EBADMSG;
+
+    for (uint8_t c = 0; c < num_channels; c++)
+    {
+        pred[c] = in[pos] >> 5;
+        width[c] = in[pos] & LSB_MASK_8BIT_5;
+        x[c] = in[pos + 1] | in[pos + 2] << 8;
+        pos += CODEC_CHANNEL_SIZE;
+
+        if (pred[c] > CODEC_PRED_LINEAR || width[c] > 16)
+            return -EBADMSG;
+
+        end += packed_size(num_samples, width[c]);
+    }
+
+    if (end > len)
+        return -EBADMSG;
+
+    for (uint8_t c = 0; c < num_channels; c++)
+    {
+        uint16_t mask = (uint16_t)((1u << width[c]) - 1);
+        uint64_t bits = 0;
+        uint8_t used = 0;
+
+        for (size_t k = num_channels + c; k < total; k += num_channels)
+        {
+            while (used < width[c])
+            {
+                bits |= (uint64_t)in[pos++] << used;
+                used += 8;
+            }
+
+            residuals[k] = bits & mask;
+            bits >>= width[c];
+            used -= width[c];
+        }
+    }
+
+    unzigzag_all(residuals + num_channels, total - num_channels);
+
+    // Integration carries a dependency from sample to sample: scalar per channel
+    for (uint8_t c = 0; c < num_channels; c++)
+    {
+        for (size_t k = num_channels + c; k < total; k += num_channels)
+        {
+            uint16_t prediction = x[k - num_channels];
+
+            if (pred[c] == CODEC_PRED_LINEAR && k >= 2 * (size_t)num_channels)
+                prediction += x[k - num_channels] - x[k - 2 * num_channels];
+
+            x[k] = prediction + residuals[k];
+        }
+    }
+
+    *count = num_samples;
+    *channels = num_channels;
+
+    return (int)end;
+}
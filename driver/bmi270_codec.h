@@ -0,0 +1,58 @@
+#pragma once
+
+#ifndef BMI270_CODEC_H
+#define BMI270_CODEC_H
+
+#include <stddef.h>
+
+#include "bmi270_defs.h"
+
+/* ----------------------------------------------------
+                    DEFINITIONS
+-----------------------------------------------------*/
+
+/*
+ * Lossless block codec for interleaved int16 sample channels (e.g. acc x, y, z,
+ * gyr x, y, z per sample). Each channel is predicted from its previous samples
+ * (delta or linear, whichever is smaller), the residuals are zigzag mapped and
+ * bit-packed at the narrowest width of the channel within the block. Prediction
+ * wraps around in 16 bit, so residuals never need more than 16 bits.
+ *
+ * Block layout (little endian):
+ *     magic (1), channels (1), count (2),
+ *     per channel: predictor << 5 | width (1), first sample (2),
+ *     per channel: count - 1 residuals, width bits each, byte aligned
+ *
+ * Encoding cost is linear in count * channels with no data dependent branches.
+ */
+
+#define CODEC_MAGIC         UINT8_C(0xB2)
+#define CODEC_MAX_CHANNELS  16
+#define CODEC_MAX_COUNT     256                // Samples per block
+#define CODEC_HEADER_SIZE   4
+#define CODEC_CHANNEL_SIZE  3                  // Channel header bytes
+
+// Predictors
+#define CODEC_PRED_DELTA    UINT8_C(0)         // x[n] - x[n-1]
+#define CODEC_PRED_LINEAR   UINT8_C(1)         // x[n] - (2 x[n-1] - x[n-2])
+
+struct bmi270_codec
+{
+    /* Zigzag residuals per predictor, interleaved like the input */
+    uint16_t residuals[2][CODEC_MAX_COUNT * CODEC_MAX_CHANNELS];
+};
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+/* Maximum encoded size of a block (bytes) */
+size_t bmi270_codec_bound(uint16_t count, uint8_t channels);
+
+/* Encode count samples of channels interleaved int16 values into out - returns the block size, -ENOBUFS if size is too small */
+int bmi270_codec_encode(struct bmi270_codec *codec, const int16_t *samples, uint16_t count, uint8_t channels, uint8_t *out, size_t size);
+
+/* Decode one block into samples (room for max_values) - returns the bytes consumed, -EBADMSG for a corrupt block */
+int bmi270_codec_decode(struct bmi270_codec *codec, const uint8_t *in, size_t len, int16_t *samples, size_t max_values, uint16_t *count, uint8_t *channels);
+
+#endif // BMI270_CODEC_H
@@ -18,17 +18,36 @@
 
 // General
 #define CHIP_ID_ADDRESS     UINT8_C(0x00)
+#define ERR_REG             UINT8_C(0x02)
+#define STATUS              UINT8_C(0x03)
 #define SENSORTIME_0        UINT8_C(0x18)
 #define SENSORTIME_1        UINT8_C(0x19)
 #define SENSORTIME_2        UINT8_C(0x1A)
+#define INT_STATUS_0        UINT8_C(0x1C)
+#define INT_STATUS_1        UINT8_C(0x1D)
 #define INTERNAL_STATUS     UINT8_C(0x21)
 #define DATA_REG            UINT8_C(0x0C)
+#define FIFO_LENGTH_0       UINT8_C(0x24)
+#define FIFO_LENGTH_1       UINT8_C(0x25)
+#define FIFO_DATA           UINT8_C(0x26)
+#define FIFO_WTM_0          UINT8_C(0x46)
+#define FIFO_WTM_1          UINT8_C(0x47)
 #define FIFO_CONFIG_0       UINT8_C(0x48)
 #define FIFO_CONFIG_1       UINT8_C(0x49)
+#define INT1_IO_CTRL        UINT8_C(0x53)
+#define INT2_IO_CTRL        UINT8_C(0x54)
+#define INT_LATCH           UINT8_C(0x55)
+#define INT1_MAP_FEAT       UINT8_C(0x56)
+#define INT2_MAP_FEAT       UINT8_C(0x57)
+#define INT_MAP_DATA        UINT8_C(0x58)
 #define INIT_CTRL           UINT8_C(0x59)
 #define INIT_ADDR_0         UINT8_C(0x5B)
 #define INIT_ADDR_1         UINT8_C(0x5C)
 #define INIT_DATA           UINT8_C(0x5E)
+#define GYR_CRT_CONF        UINT8_C(0x69)
+#define IF_CONF             UINT8_C(0x6B)
+#define ACC_SELF_TEST       UINT8_C(0x6D)
+#define GYR_SELF_TEST_AXES  UINT8_C(0x6E)
 #define CMD                 UINT8_C(0x7E)
 #define PWR_CONF            UINT8_C(0x7C)
 #define PWR_CTRL            UINT8_C(0x7D)
@@ -57,6 +76,19 @@
 #define TEMP_7_0            UINT8_C(0x22)
 #define TEMP_15_8           UINT8_C(0x23)
 
+// Auxiliary Interface
+#define AUX_DATA            UINT8_C(0x04)      // 0x04 - 0x0B (DATA_0 - DATA_7)
+#define AUX_CONF            UINT8_C(0x44)
+#define AUX_DEV_ID          UINT8_C(0x4B)
+#define AUX_IF_CONF         UINT8_C(0x4C)
+#define AUX_RD_ADDR         UINT8_C(0x4D)
+#define AUX_WR_ADDR         UINT8_C(0x4E)
+#define AUX_WR_DATA         UINT8_C(0x4F)
+
+// Feature Engine
+#define FEAT_PAGE           UINT8_C(0x2F)
+#define FEATURES_IN         UINT8_C(0x30)      // 0x30 - 0x3F (16 bytes per page)
+
 /* ----------------------------------------------------
                     DEFINITIONS
 -----------------------------------------------------*/
@@ -85,8 +117,47 @@
 #define LAST_3_BITS         UINT8_C(0xE0)      // 11100000
 
 
+// Log Levels
+#define BMI270_LOG_OFF      UINT8_C(0)
+#define BMI270_LOG_ERROR    UINT8_C(1)
+#define BMI270_LOG_WARN     UINT8_C(2)
+#define BMI270_LOG_INFO     UINT8_C(3)
+#define BMI270_LOG_DEBUG    UINT8_C(4)
+
 // BMI270
 #define BMI270_CHIP_ID      UINT8_C(0x24)
+#define SOFT_RESET          UINT8_C(0xB6)      // CMD
+#define FIFO_FLUSH          UINT8_C(0xB0)      // CMD
+#define G_TRIGGER           UINT8_C(0x02)      // CMD: gyroscope self-test / CRT
+#define CONFIG_CHUNK_SIZE   32
+#define CONFIG_NUM_CHUNKS   256
+#define CONFIG_FILE_SIZE    8192               // CONFIG_CHUNK_SIZE * CONFIG_NUM_CHUNKS
+#define CONFIG_VERIFY_SIZE  128                // Bytes per INIT_DATA read-back burst
+#define CONFIG_INIT_WAIT_MS 20                 // Max. time until INTERNAL_STATUS is valid
+#define CONFIG_FILE_VERSION UINT16_C(0x0148)   // Version the embedded config file reports (feature page 1)
+
+// Internal Status (INTERNAL_STATUS)
+#define STATUS_MSG_MASK     UINT8_C(0x0F)
+#define STATUS_NOT_INIT     UINT8_C(0x00)
+#define STATUS_INIT_OK      UINT8_C(0x01)
+#define STATUS_INIT_ERR     UINT8_C(0x02)      // Needs power cycle
+#define STATUS_DRV_ERR      UINT8_C(0x03)
+#define STATUS_SNS_STOP     UINT8_C(0x04)
+#define STATUS_NVM_ERR      UINT8_C(0x05)
+#define STATUS_STARTUP_ERR  UINT8_C(0x06)
+#define STATUS_COMPAT_ERR   UINT8_C(0x07)
+#define STATUS_REMAP_ERR    BIT_5              // Axes remap error
+#define STATUS_ODR_50HZ_ERR BIT_6              // Feature ODR below 50Hz
+
+// Error Register (ERR_REG)
+#define ERR_FATAL           BIT_0
+#define ERR_INTERNAL_MASK   UINT8_C(0x1E)      // Internal error code (bits 4:1)
+#define ERR_FIFO            BIT_6
+#define ERR_AUX             BIT_7
+
+// Bus Retries
+#define MAX_RETRIES         UINT8_C(3)
+#define RETRY_DELAY_US      50                 // Doubled on every retry
 
 // Device Modes
 #define LOW_POWER_MODE      UINT8_C(0)
@@ -105,6 +176,11 @@
 #define ACC_ODR_100         UINT8_C(0x08)      // 100Hz
 #define ACC_ODR_50          UINT8_C(0x07)      // 50Hz
 #define ACC_ODR_25          UINT8_C(0x06)      // 25Hz
+#define ACC_ODR_12_5        UINT8_C(0x05)      // 12.5Hz
+#define ACC_ODR_6_25        UINT8_C(0x04)      // 6.25Hz, undersampling only
+#define ACC_ODR_3_12        UINT8_C(0x03)      // 3.125Hz, undersampling only
+#define ACC_ODR_1_56        UINT8_C(0x02)      // 1.5625Hz, undersampling only
+#define ACC_ODR_0_78        UINT8_C(0x01)      // 0.78Hz, undersampling only
 #define ACC_BWP_OSR4        UINT8_C(0x00)      // OSR4
 #define ACC_BWP_OSR2        UINT8_C(0x01)      // OSR2
 #define ACC_BWP_NORMAL      UINT8_C(0x02)      // Normal
@@ -113,6 +189,110 @@
 #define ACC_BWP_RES32       UINT8_C(0x05)      // Reserved
 #define ACC_BWP_RES64       UINT8_C(0x06)      // Reserved
 #define ACC_BWP_RES128      UINT8_C(0x07)      // Reserved
+#define ACC_BWP_AVG1        UINT8_C(0x00)      // Undersampling: no averaging
+#define ACC_BWP_AVG2        UINT8_C(0x01)      // Undersampling: 2 samples averaged
+#define ACC_BWP_AVG4        UINT8_C(0x02)      // Undersampling: 4 samples averaged
+#define ACC_BWP_AVG8        UINT8_C(0x03)      // Undersampling: 8 samples averaged
+#define ACC_BWP_AVG16       UINT8_C(0x04)      // Undersampling: 16 samples averaged
+#define ACC_BWP_AVG32       UINT8_C(0x05)      // Undersampling: 32 samples averaged
+#define ACC_BWP_AVG64       UINT8_C(0x06)      // Undersampling: 64 samples averaged
+#define ACC_BWP_AVG128      UINT8_C(0x07)      // Undersampling: 128 samples averaged
+
+// Auxiliary Interface
+#define AUX_ODR_800         UINT8_C(0x0B)      // 800Hz
+#define AUX_ODR_400         UINT8_C(0x0A)      // 400Hz
+#define AUX_ODR_200         UINT8_C(0x09)      // 200Hz
+#define AUX_ODR_100         UINT8_C(0x08)      // 100Hz
+#define AUX_ODR_50          UINT8_C(0x07)      // 50Hz
+#define AUX_ODR_25          UINT8_C(0x06)      // 25Hz
+#define AUX_ODR_12_5        UINT8_C(0x05)      // 12.5Hz
+#define AUX_BURST_1         UINT8_C(0x00)      // 1 byte
+#define AUX_BURST_2         UINT8_C(0x01)      // 2 bytes
+#define AUX_BURST_6         UINT8_C(0x02)      // 6 bytes
+#define AUX_BURST_8         UINT8_C(0x03)      // 8 bytes
+#define AUX_MANUAL_EN       BIT_7
+#define AUX_FCU_WRITE_EN    BIT_6
+#define AUX_IF_EN           BIT_5              // IF_CONF
+#define AUX_BUSY            BIT_2              // STATUS
+#define AUX_DATA_LEN        UINT8_C(8)
+
+// Feature Engine
+#define FEAT_PAGE_SIZE      UINT8_C(16)
+#define FEAT_PAGE_OUT       UINT8_C(0)         // Feature outputs
+#define FEAT_PAGE_ANY_MOT   UINT8_C(1)
+#define FEAT_PAGE_NO_MOT    UINT8_C(2)
+#define FEAT_PAGE_SIG_MOT   UINT8_C(2)
+#define FEAT_PAGE_STEP_CNT  UINT8_C(6)
+#define FEAT_PAGE_WR_GEST   UINT8_C(7)
+#define FEAT_OFF_ANY_MOT    UINT8_C(0x0C)
+#define FEAT_OFF_NO_MOT     UINT8_C(0x00)
+#define FEAT_OFF_SIG_MOT    UINT8_C(0x04)
+#define FEAT_OFF_SIG_MOT_EN UINT8_C(0x0C)
+#define FEAT_OFF_STEP_CNT   UINT8_C(0x0E)
+#define FEAT_OFF_WR_GEST    UINT8_C(0x00)
+#define FEAT_OFF_STEP_OUT   UINT8_C(0x00)
+#define FEAT_OFF_ACT_OUT    UINT8_C(0x04)
+#define FEAT_OFF_GEST_OUT   UINT8_C(0x06)
+#define FEAT_PAGE_CONFIG_ID UINT8_C(1)
+#define FEAT_OFF_CONFIG_ID  UINT8_C(0x06)      // Config file version
+#define FEAT_AXIS_X         UINT8_C(0x01)
+#define FEAT_AXIS_Y         UINT8_C(0x02)
+#define FEAT_AXIS_Z         UINT8_C(0x04)
+#define FEAT_AXIS_ALL       UINT8_C(0x07)
+#define MOTION_DUR_MASK     UINT16_C(0x1FFF)   // 1 LSB = 20 ms
+#define MOTION_THRES_MASK   UINT16_C(0x07FF)   // 1 LSB = 0.48 mg
+#define MOTION_EN           UINT16_C(0x8000)
+#define STEP_WTM_MASK       UINT16_C(0x03FF)   // 1 LSB = 20 steps
+#define STEP_RESET          UINT16_C(0x0400)
+#define STEP_DETECTOR_EN    UINT16_C(0x0800)
+#define STEP_COUNTER_EN     UINT16_C(0x1000)
+#define STEP_ACTIVITY_EN    UINT16_C(0x2000)
+#define WR_GEST_EN          UINT8_C(0x10)
+#define WR_GEST_ARM_RIGHT   UINT8_C(0x20)
+
+// Feature Interrupts (INT_STATUS_0, INTx_MAP_FEAT)
+#define SIG_MOTION_INT      BIT_0
+#define STEP_COUNTER_INT    BIT_1
+#define ACTIVITY_INT        BIT_2
+#define WRIST_WEAR_WAKE_INT BIT_3
+#define WRIST_GESTURE_INT   BIT_4
+#define NO_MOTION_INT       BIT_5
+#define ANY_MOTION_INT      BIT_6
+
+// Interrupt Pins
+#define INT1                UINT8_C(1)
+#define INT2                UINT8_C(2)
+#define INT_ACTIVE_HIGH     BIT_1
+#define INT_OPEN_DRAIN      BIT_2
+#define INT_OUTPUT_EN       BIT_3
+
+// Data Interrupts (INT_MAP_DATA, per pin)
+#define FFULL_INT           BIT_0              // FIFO full
+#define FWM_INT             BIT_1              // FIFO watermark
+#define DRDY_INT            BIT_2              // Data ready
+#define ERR_INT             BIT_3              // Error
+
+// Data Interrupt Status (INT_STATUS_1, clear on read)
+#define FFULL_INT_STATUS    BIT_0
+#define FWM_INT_STATUS      BIT_1
+#define ERR_INT_STATUS      BIT_2
+#define AUX_DRDY_STATUS     BIT_5
+#define GYR_DRDY_STATUS     BIT_6
+#define ACC_DRDY_STATUS     BIT_7
+
+// Step Activity
+#define ACTIVITY_STILL      UINT8_C(0x00)
+#define ACTIVITY_WALKING    UINT8_C(0x01)
+#define ACTIVITY_RUNNING    UINT8_C(0x02)
+#define ACTIVITY_UNKNOWN    UINT8_C(0x03)
+
+// Wrist Gestures
+#define GESTURE_UNKNOWN     UINT8_C(0x00)
+#define GESTURE_ARM_DOWN    UINT8_C(0x01)
+#define GESTURE_PIVOT_UP    UINT8_C(0x02)
+#define GESTURE_WRIST_SHAKE UINT8_C(0x03)
+#define GESTURE_FLICK_IN    UINT8_C(0x04)
+#define GESTURE_FLICK_OUT   UINT8_C(0x05)
 
 // Gyroscope
 #define GYR_RANGE_2000      UINT8_C(0x00)      // +/- 2000dps,  16.4 LSB/dps
@@ -132,6 +312,96 @@
 #define GYR_BWP_OSR2        UINT8_C(0x01)      // OSR2
 #define GYR_BWP_NORMAL      UINT8_C(0x02)      // Normal
 
+// Self-Test
+#define ACC_ST_EN           BIT_0              // ACC_SELF_TEST
+#define ACC_ST_SIGN_POS     BIT_2              // ACC_SELF_TEST: positive excitation
+#define ACC_ST_AMP_HIGH     BIT_3              // ACC_SELF_TEST: high amplitude
+#define ACC_ST_CONF         UINT8_C(0xAC)      // ACC_CONF: 1600Hz, normal, performance
+#define ACC_ST_X_MIN_MG     16000              // Positive - negative excitation (mg)
+#define ACC_ST_Y_MAX_MG     -15000
+#define ACC_ST_Z_MIN_MG     10000
+#define ACC_ST_DELAY_US     50000              // Settling time per excitation
+#define FEAT_OFF_G_TRIG_1   UINT8_C(0x03)      // Feature page 1: g_trig_1 high byte
+#define G_TRIG_SELECT       BIT_0              // 1 = self-test, 0 = CRT
+#define G_TRIG_BLOCK        BIT_1              // Block further G_TRIGGER commands
+#define GYR_CRT_RUNNING     BIT_2              // GYR_CRT_CONF
+#define GYR_ST_DONE         BIT_0              // GYR_SELF_TEST_AXES
+#define GYR_ST_AXES_OK      UINT8_C(0x0E)      // GYR_SELF_TEST_AXES: x, y, z passed
+#define GYR_ST_TIMEOUT_MS   500
+
+// FIFO
+#define FIFO_SIZE           6144               // Bytes
+#define FIFO_READ_CHUNK     255                // Bytes per FIFO_DATA burst read
+#define FIFO_WTM_MASK       UINT16_C(0x1FFF)   // FIFO_WTM_1 holds bits 12:8
+#define FIFO_HEAD_MODE_MASK UINT8_C(0xC0)      // Frame header: fh_mode
+#define FIFO_HEAD_REGULAR   UINT8_C(0x80)      // Frame header: sensor data frame
+#define FIFO_HEAD_CONTROL   UINT8_C(0x40)      // Frame header: control frame
+#define FIFO_HEAD_AUX       BIT_4              // Regular frame: AUX data present
+#define FIFO_HEAD_GYR       BIT_3              // Regular frame: GYR data present
+#define FIFO_HEAD_ACC       BIT_2              // Regular frame: ACC data present
+#define FIFO_HEAD_SKIP      UINT8_C(0x40)      // Skip frame (FIFO overflow), 1 byte
+#define FIFO_HEAD_TIME      UINT8_C(0x44)      // Sensortime frame, 3 bytes
+#define FIFO_HEAD_CONFIG    UINT8_C(0x48)      // Input config changed frame, 1 byte
+#define FIFO_HEAD_DROP      UINT8_C(0x50)      // Sample drop frame, 1 byte
+#define FIFO_EMPTY          UINT8_C(0x80)      // Read beyond the FIFO fill level
+#define FIFO_TIME_SIZE      4                  // Sensortime frame (bytes)
+#define FIFO_SKIP_MAX       UINT8_C(0xFF)      // Skip frame: 255 or more frames lost
+#define SENSORTIME_MASK     UINT32_C(0xFFFFFF) // 24 bit, wraps after ~655 s
+#define FIFO_AXIS(p, axis)  ((int16_t)((p)[2 * (axis) + 1] << 8 | (p)[2 * (axis)]))
+
+// FIFO Frame Types
+#define FIFO_FRAME_DATA     UINT8_C(0)
+#define FIFO_FRAME_SKIP     UINT8_C(1)
+#define FIFO_FRAME_TIME     UINT8_C(2)
+#define FIFO_FRAME_CONFIG   UINT8_C(3)
+#define FIFO_FRAME_DROP     UINT8_C(4)
+
+struct bmi270_fifo_frame
+{
+    /* FIFO_FRAME_* */
+    uint8_t type;
+
+    /* Frame header (0 in headerless mode) */
+    uint8_t header;
+
+    /* Payload inside the FIFO buffer, NULL if the sensor is not in the frame (little endian x, y, z) */
+    const uint8_t *acc;
+    const uint8_t *gyr;
+    const uint8_t *aux;
+
+    /* FIFO_FRAME_TIME: sensortime (39.0625 us ticks, 24 bit) */
+    uint32_t sensortime;
+
+    /* FIFO_FRAME_SKIP: frames lost to overflow / FIFO_FRAME_DROP, FIFO_FRAME_CONFIG: payload byte */
+    uint8_t value;
+};
+
+// Sample Flags
+#define SAMPLE_VALID        UINT16_C(0x0001)
+#define SAMPLE_GAP          UINT16_C(0x0002)   // Samples were lost right before this one
+
+struct bmi270_sample
+{
+    /* Host timestamp (us, CLOCK_MONOTONIC) */
+    uint64_t timestamp_us;
+
+    /* Device index */
+    uint16_t device;
+
+    /* SAMPLE_* flags */
+    uint16_t flags;
+
+    /* Raw accelerometer data (x, y, z) */
+    int16_t acc[3];
+
+    /* Raw gyroscope data (x, y, z) */
+    int16_t gyr[3];
+};
+
+struct bmi270_stats;
+struct i2c_msg;
+
+typedef void (*bmi270_log_handler)(uint8_t level, const char *message, void *ctx);
 
 struct bmi270
 {
@@ -150,14 +420,54 @@ struct bmi270
     /* Accelerator Range */
     double acc_range;
 
-    /* Accelerator ODR */
-    int acc_odr;
+    /* Accelerator ODR (Hz) */
+    double acc_odr;
 
     /* Gyroscope Range */
     double gyr_range;
 
-    /* Gyroscope ODR */
-    int gyr_odr;
+    /* Gyroscope ODR (Hz) */
+    double gyr_odr;
+
+    /* Auxiliary Sensor I2C Address */
+    uint8_t aux_addr;
+
+    /* Auxiliary Sensor Burst Length (bytes) */
+    uint8_t aux_len;
+
+    /* Bus Statistics (NULL = instrumentation off) */
+    struct bmi270_stats *stats;
+
+    /* Bus Transfer (NULL = I2C_RDWR on i2c_fd), e.g. a simulated bus */
+    int (*transfer)(struct bmi270 *sensor, struct i2c_msg *msgs, int nmsgs);
+
+    /* Bus Transfer Context */
+    void *bus_ctx;
+
+    /* Last Error (negative errno, 0 = none) */
+    int last_error;
+
+    /* Register of the Last Error */
+    uint8_t last_error_reg;
+
+    /* Number of Errors */
+    uint32_t error_count;
+
+    /* Bus Retries per Failed Transaction (0 - MAX_RETRIES) */
+    uint8_t max_retries;
+
+    /* i2c_fd was opened by bmi270_init and is closed by bmi270_close */
+    uint8_t owns_fd;
+
+    /* Config File to Upload (NULL = embedded) and its CRC-32, see bmi270_set_config_file */
+    const uint8_t *config_file;
+    uint32_t config_crc;
+
+    /* Expected Config File Version of an already initialized sensor (0 = CONFIG_FILE_VERSION for the embedded file, always reload a custom one) */
+    uint16_t config_version;
+
+    /* Read back the config file after uploading it */
+    uint8_t config_verify;
 };
 
 #endif /* BMI270_DEFS_H */
\ No newline at end of file
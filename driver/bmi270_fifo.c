@@ -0,0 +1,337 @@
+#include <errno.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "bmi270_fifo.h"
+#include "bmi270_regs.h"
+#include "bmi270_stats.h"
+#include "bmi270_trace.h"
+
+/* ----------------------------------------------------
+                  HELPER FUNCTIONS
+-----------------------------------------------------*/
+
+/* Sensortime ticks (39.0625 us) per sample of an ODR code: 8 at 3200 Hz, doubling per step down */
+static uint32_t odr_ticks(uint8_t odr)
+{
+    return odr >= 0x01 && odr <= 0x0D ? UINT32_C(8) << (0x0D - odr) : 0;
+}
+
+static int load_config(struct bmi270_fifo *fifo)
+{
+    struct bmi270 *sensor = fifo->sensor;
+    uint8_t acc_odr, gyr_odr, aux_conf, odr = 0;
+    int result;
+
+    if ((result = read_register(sensor, FIFO_CONFIG_1, &fifo->config)) < 0 ||
+        (result = FIELD_READ(sensor, ACC_CONF_ODR, &acc_odr)) < 0 ||
+        (result = FIELD_READ(sensor, GYR_CONF_ODR, &gyr_odr)) < 0 ||
+        (result = read_register(sensor, AUX_CONF, &aux_conf)) < 0)
+        return result;
+
+    if (!(fifo->config & FIELD_MASK(FIFO_SENSORS_EN)))
+    {
+        bmi270_log(BMI270_LOG_ERROR, "0x%X --> No sensor stored in FIFO", sensor->i2c_addr);
+        return -EINVAL;
+    }
+
+    // Frames come at the rate of the fastest sensor in the FIFO
+    if (fifo->config & FIELD_MASK(FIFO_ACC_EN) && acc_odr > odr)
+        odr = acc_odr;
+
+    if (fifo->config & FIELD_MASK(FIFO_GYR_EN) && gyr_odr > odr)
+        odr = gyr_odr;
+
+    if (fifo->config & FIELD_MASK(FIFO_AUX_EN) && (aux_conf & LSB_MASK_8BIT) > odr)
+        odr = aux_conf & LSB_MASK_8BIT;
+
+    fifo->frame_ticks = odr_ticks(odr);
+    fifo->frame_size = (fifo->config & FIELD_MASK(FIFO_HEADER_EN) ? 1 : 0) +
+                       (fifo->config & FIELD_MASK(FIFO_ACC_EN) ? 6 : 0) +
+                       (fifo->config & FIELD_MASK(FIFO_GYR_EN) ? 6 : 0) +
+                       (fifo->config & FIELD_MASK(FIFO_AUX_EN) ? AUX_DATA_LEN : 0);
+    fifo->reload = 0;
+
+    return 0;
+}
+
+/* Mark the first sample of a batch, or the next one if the batch is empty */
+static void mark_batch_gap(struct bmi270_fifo *fifo, struct bmi270_sample *samples, int count)
+{
+    if (count == 0)
+    {
+        fifo->gap_pending = 1;
+        return;
+    }
+
+    if (!(samples[0].flags & SAMPLE_GAP))
+    {
+        samples[0].flags |= SAMPLE_GAP;
+        fifo->gaps++;
+    }
+}
+
+/* Bytes still in the sensor of the frame a failed read cut off at the end of data, counted as lost if it held data */
+static uint16_t cut_frame(struct bmi270_fifo *fifo, const uint8_t *data, uint16_t len)
+{
+    struct bmi270_fifo_frame frame;
+    uint8_t padded[1 + 12 + AUX_DATA_LEN] = {0};
+    uint16_t pos = 0;
+    int consumed;
+
+    while (pos < len && (consumed = parse_fifo_frame(data + pos, len - pos, fifo->config, &frame)) > 0)
+        pos += consumed;
+
+    // Parse errors are flagged by the parser, an empty frame has nothing behind it
+    if (pos == len || consumed < 0 || len - pos >= sizeof(padded))
+        return 0;
+
+    memcpy(padded, data + pos, len - pos);
+
+    if ((consumed = parse_fifo_frame(padded, sizeof(padded), fifo->config, &frame)) <= len - pos)
+        return 0;
+
+    if (frame.type == FIFO_FRAME_DATA)
+    {
+        fifo->lost++;
+        fifo->lost_since_time++;
+    }
+
+    return (uint16_t)(consumed - (len - pos));
+}
+
+/* Compare the frames received since the last sensortime frame with the elapsed sensortime */
+static void check_sensortime(struct bmi270_fifo *fifo, uint32_t sensortime, struct bmi270_sample *samples, int count)
+{
+    if (fifo->has_time && fifo->frame_ticks)
+    {
+        uint32_t elapsed = (sensortime - fifo->sensortime) & SENSORTIME_MASK;
+        uint32_t expected = (elapsed + fifo->frame_ticks / 2) / fifo->frame_ticks;
+        uint32_t seen = fifo->frames_since_time + fifo->lost_since_time;
+
+        if (expected > seen)
+        {
+            fifo->lost += expected - seen;
+            mark_batch_gap(fifo, samples, count);
+        }
+    }
+
+    fifo->sensortime = sensortime;
+    fifo->has_time = 1;
+    fifo->frames_since_time = 0;
+    fifo->lost_since_time = 0;
+}
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+int bmi270_fifo_init(struct bmi270_fifo *fifo, struct bmi270 *sensor, uint16_t device)
+{
+    int result;
+
+    memset(fifo, 0, offsetof(struct bmi270_fifo, buffer));
+    fifo->sensor = sensor;
+    fifo->device = device;
+
+    if ((result = FIELD_WRITE(sensor, FIFO_TIME_EN, 1)) < 0 ||
+        (result = load_config(fifo)) < 0)
+        return result;
+
+    if (!(fifo->config & FIELD_MASK(FIFO_HEADER_EN)))
+        bmi270_log(BMI270_LOG_WARN, "0x%X --> Headerless FIFO: losses are only detected from FIFO full, enable the FIFO header", sensor->i2c_addr);
+
+    return 0;
+}
+
+void bmi270_fifo_reset(struct bmi270_fifo *fifo)
+{
+    fifo->has_time = 0;
+    fifo->frames_since_time = 0;
+    fifo->lost_since_time = 0;
+    fifo->gap_pending = 0;
+    fifo->discard = 0;
+}
+
+int bmi270_fifo_parse(struct bmi270_fifo *fifo, const uint8_t *data, uint16_t len, struct bmi270_sample *samples, int max, uint64_t now_us)
+{
+    struct bmi270_fifo_frame frame;
+    uint32_t dropped = 0;
+    uint16_t pos = 0;
+    int consumed, count = 0;
+
+    while (pos < len && (consumed = parse_fifo_frame(data + pos, len - pos, fifo->config, &frame)) != 0)
+    {
+        // Resynchronizing inside a batch is guesswork: drop the rest
+        if (consumed < 0)
+        {
+            fifo->parse_errors++;
+            fifo->gap_pending = 1;
+            break;
+        }
+
+        pos += consumed;
+
+        switch (frame.type)
+        {
+        case FIFO_FRAME_DATA:
+            fifo->frames++;
+            fifo->frames_since_time++;
+
+            if (count == max)
+            {
+                dropped++;
+                break;
+            }
+
+            for (int i = 0; i < 3; i++)
+            {
+                if (frame.acc)
+                    fifo->acc[i] = FIFO_AXIS(frame.acc, i);
+
+                if (frame.gyr)
+                    fifo->gyr[i] = FIFO_AXIS(frame.gyr, i);
+            }
+
+            samples[count].device = fifo->device;
+            samples[count].flags = SAMPLE_VALID;
+            memcpy(samples[count].acc, fifo->acc, sizeof(fifo->acc));
+            memcpy(samples[count].gyr, fifo->gyr, sizeof(fifo->gyr));
+
+            if (fifo->gap_pending)
+            {
+                samples[count].flags |= SAMPLE_GAP;
+                fifo->gap_pending = 0;
+                fifo->gaps++;
+            }
+
+            count++;
+            break;
+
+        case FIFO_FRAME_SKIP:
+            fifo->skip_frames++;
+            fifo->lost += frame.value;
+            fifo->lost_since_time += frame.value;
+            fifo->gap_pending = 1;
+            break;
+
+        case FIFO_FRAME_DROP:
+            fifo->drop_frames++;
+            fifo->lost++;
+            fifo->lost_since_time++;
+            fifo->gap_pending = 1;
+            break;
+
+        case FIFO_FRAME_CONFIG:
+            // Frame period may change: no sensortime check across the change
+            fifo->config_frames++;
+            fifo->has_time = 0;
+            fifo->reload = 1;
+            break;
+
+        case FIFO_FRAME_TIME:
+            check_sensortime(fifo, frame.sensortime, samples, count);
+            break;
+        }
+    }
+
+    // Frames that did not fit are lost for the caller
+    if (dropped)
+    {
+        fifo->lost += dropped;
+        fifo->gap_pending = 1;
+    }
+
+    // Newest frame at now_us, older ones one frame period apart
+    for (int i = 0; i < count; i++)
+    {
+        samples[i].timestamp_us = now_us - (uint64_t)(count - 1 - i) * fifo->frame_ticks * 625 / 16;
+    }
+
+    return count;
+}
+
+int bmi270_fifo_read(struct bmi270_fifo *fifo, struct bmi270_sample *samples, int max, uint64_t now_us)
+{
+    struct bmi270 *sensor = fifo->sensor;
+    uint8_t status[FIFO_STATUS_LEN], err_reg;
+    uint32_t skip_frames = fifo->skip_frames;
+    uint16_t length, chunk, done, start;
+    int result, count;
+
+    if (max <= 0)
+        return -EINVAL;
+
+    if (fifo->reload && (result = load_config(fifo)) < 0)
+        return result;
+
+    bmi270_trace_begin(TRACE_READ, fifo->device);
+
+    // Interrupt status and fill level in one transaction
+    if ((result = read_register_block(sensor, INT_STATUS_1, status, FIFO_STATUS_LEN)) < 0)
+    {
+        bmi270_trace_end(TRACE_READ, fifo->device);
+        return result;
+    }
+
+    fifo->int_status = status[0];
+    fifo->reads++;
+    length = ((status[FIFO_LENGTH_1 - INT_STATUS_1] & 0x3F) << 8) | status[FIFO_LENGTH_0 - INT_STATUS_1];
+
+    if (fifo->int_status & FFULL_INT_STATUS)
+    {
+        fifo->overflows++;
+
+        // Without headers there are no skip frames to tell what was lost
+        if (!(fifo->config & FIELD_MASK(FIFO_HEADER_EN)))
+            fifo->gap_pending = 1;
+    }
+
+    // No more than fits into samples: a partially read frame is read again next time
+    if (length > (uint32_t)max * fifo->frame_size)
+        length = (uint16_t)((uint32_t)max * fifo->frame_size);
+    else if (fifo->config & FIELD_MASK(FIFO_HEADER_EN))
+        length += FIFO_TIME_SIZE;
+
+    // Burst by burst: after a failure the frames of the bursts before are already out of the sensor
+    for (done = 0; done < length; done += chunk)
+    {
+        chunk = length - done < FIFO_READ_CHUNK ? length - done : FIFO_READ_CHUNK;
+
+        if ((result = read_fifo(sensor, fifo->buffer + done, chunk)) < 0)
+            break;
+    }
+
+    bmi270_trace_end(TRACE_READ, fifo->device);
+
+    if (result < 0 && done == 0)
+        return result;
+
+    // The rest of a frame cut off by the last read comes first
+    start = fifo->discard < done ? fifo->discard : done;
+    fifo->discard -= start;
+
+    bmi270_trace_begin(TRACE_CONVERT, fifo->device);
+    count = bmi270_fifo_parse(fifo, fifo->buffer + start, done - start, samples, max, now_us ? now_us : bmi270_stats_now() / 1000);
+    bmi270_trace_end(TRACE_CONVERT, fifo->device);
+
+    // A later burst failed (left in last_error): the frames read so far are returned, a gap follows them
+    if (done < length)
+    {
+        fifo->discard = cut_frame(fifo, fifo->buffer + start, done - start);
+        fifo->gap_pending = 1;
+    }
+
+    // Only look at ERR_REG when something went wrong, it costs a transaction
+    if (fifo->skip_frames != skip_frames || (fifo->int_status & FFULL_INT_STATUS))
+    {
+        // The samples are already drained: a failed read is left in last_error, not returned
+        if (read_register(sensor, ERR_REG, &err_reg) == 0 && (err_reg & ERR_FIFO))
+        {
+            fifo->fifo_errors++;
+            bmi270_log(BMI270_LOG_WARN, "0x%X --> FIFO error (ERR_REG 0x%X)", sensor->i2c_addr, err_reg);
+        }
+    }
+
+    return count;
+}
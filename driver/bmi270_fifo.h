@@ -0,0 +1,108 @@
+#pragma once
+
+#ifndef BMI270_FIFO_H
+#define BMI270_FIFO_H
+
+#include "bmi270.h"
+
+/* ----------------------------------------------------
+                    DEFINITIONS
+-----------------------------------------------------*/
+
+/*
+ * Gap-aware FIFO reader: turns FIFO batches into samples and marks every place
+ * where samples were lost with SAMPLE_GAP on the first sample after the loss.
+ * Integrators must restart (not bridge) at a gap.
+ *
+ * Losses are detected from
+ *     - skip frames (FIFO overflow, header mode): number of frames lost
+ *     - sample drop frames (header mode)
+ *     - sensortime frames: frames expected from the elapsed sensortime versus
+ *       frames received, catches losses skip frames do not report
+ *     - FIFO full (INT_STATUS_1) and FIFO errors (ERR_REG)
+ *
+ * Overflow drops the oldest frames, so a loss found in a batch is placed in
+ * front of the batch. Timestamps are the host time at the end of the read,
+ * stepped back by the frame period for older frames of the batch.
+ */
+
+#define FIFO_STATUS_LEN     (FIFO_LENGTH_1 - INT_STATUS_1 + 1) // INT_STATUS_1 - FIFO_LENGTH_1 in one burst
+
+struct bmi270_fifo
+{
+    /* Sensor and the device index written into the samples */
+    struct bmi270 *sensor;
+    uint16_t device;
+
+    /* FIFO_CONFIG_1 */
+    uint8_t config;
+
+    /* Data frame size (bytes) */
+    uint8_t frame_size;
+
+    /* Sensortime ticks per frame, fastest sensor in the FIFO */
+    uint32_t frame_ticks;
+
+    /* Sensortime of the last sensortime frame, valid if has_time */
+    uint32_t sensortime;
+    uint8_t has_time;
+
+    /* Data frames and losses already counted since the last sensortime frame */
+    uint32_t frames_since_time;
+    uint32_t lost_since_time;
+
+    /* The next sample follows a gap */
+    uint8_t gap_pending;
+
+    /* Rest of a frame cut off by a failed read, still at the FIFO start: skipped by the next read */
+    uint16_t discard;
+
+    /* A config change frame was seen: reload FIFO_CONFIG_1 and ODRs before the next read */
+    uint8_t reload;
+
+    /* Last values per sensor, held in frames without that sensor */
+    int16_t acc[3];
+    int16_t gyr[3];
+
+    /* INT_STATUS_1 of the last read (clear on read, FWM_INT_STATUS / FFULL_INT_STATUS) */
+    uint8_t int_status;
+
+    /* FIFO reads and data frames */
+    uint64_t reads;
+    uint64_t frames;
+
+    /* Gaps marked and samples lost in them (lower bound for skip frames with FIFO_SKIP_MAX) */
+    uint32_t gaps;
+    uint64_t lost;
+
+    /* Skip, sample drop and config change frames */
+    uint32_t skip_frames;
+    uint32_t drop_frames;
+    uint32_t config_frames;
+
+    /* Reads that found the FIFO full, FIFO errors in ERR_REG and unparsable data */
+    uint32_t overflows;
+    uint32_t fifo_errors;
+    uint32_t parse_errors;
+
+    /* Read buffer: the whole FIFO and the sensortime frame behind it */
+    uint8_t buffer[FIFO_SIZE + FIFO_TIME_SIZE];
+};
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+/* Load FIFO_CONFIG_1 and ODRs and enable sensortime frames - set up the FIFO first */
+int bmi270_fifo_init(struct bmi270_fifo *fifo, struct bmi270 *sensor, uint16_t device);
+
+/* Read up to max samples out of the FIFO, now_us: host time after the read (0 = take it) - returns the number of samples */
+int bmi270_fifo_read(struct bmi270_fifo *fifo, struct bmi270_sample *samples, int max, uint64_t now_us);
+
+/* Parse an already read FIFO batch - returns the number of samples, data beyond max samples is dropped and marked as gap */
+int bmi270_fifo_parse(struct bmi270_fifo *fifo, const uint8_t *data, uint16_t len, struct bmi270_sample *samples, int max, uint64_t now_us);
+
+/* Forget the sensortime reference, e.g. after a FIFO flush (no gap is marked) */
+void bmi270_fifo_reset(struct bmi270_fifo *fifo);
+
+#endif // BMI270_FIFO_H
@@ -0,0 +1,223 @@
+#include <errno.h>
+#include <unistd.h>
+
+#include "bmi270_governor.h"
+#include "bmi270_regs.h"
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+void bmi270_governor_defaults(struct bmi270_governor_config *config)
+{
+    config->no_motion_duration = 250;      // 5 s
+    config->no_motion_threshold = 0xAA;    // ~82 mg
+    config->any_motion_duration = 4;       // 80 ms
+    config->any_motion_threshold = 0xAA;   // ~82 mg
+    config->min_active_us = 2000000;
+    config->min_idle_us = 0;
+    config->idle_mode = GOV_IDLE_LOW_POWER;
+    config->idle_acc_odr = ACC_ODR_50;
+    config->on_transition = NULL;
+    config->ctx = NULL;
+}
+
+/* Write the active profile: PWR_CTRL, ACC_CONF, GYR_CONF and PWR_CONF */
+static int write_active(struct bmi270_governor *gov)
+{
+    struct bmi270 *sensor = gov->sensor;
+    int result;
+
+    if ((result = write_register(sensor, PWR_CONF, FIELD_MASK(PWR_CONF_FIFO_RD))) < 0)
+        return result;
+
+    usleep(450);
+
+    if ((result = write_register(sensor, PWR_CTRL, gov->active_regs[0])) < 0 ||
+        (result = write_register(sensor, ACC_CONF, gov->active_regs[1])) < 0 ||
+        (result = write_register(sensor, GYR_CONF, gov->active_regs[2])) < 0 ||
+        (result = write_register(sensor, PWR_CONF, gov->active_regs[3])) < 0)
+        return result;
+
+    return 0;
+}
+
+static int enter_idle(struct bmi270_governor *gov, uint64_t now_us)
+{
+    struct bmi270 *sensor = gov->sensor;
+    uint8_t odr = gov->config.idle_acc_odr & LSB_MASK_8BIT;
+    uint8_t low_power = gov->config.idle_mode == GOV_IDLE_LOW_POWER;
+    int result;
+
+    // Configuration changes need advanced power save disabled
+    if ((result = write_register(sensor, PWR_CONF, FIELD_MASK(PWR_CONF_FIFO_RD))) < 0)
+        return result;
+
+    usleep(450);
+
+    // Accelerometer only, feature engine keeps running for any-motion
+    if ((result = write_register(sensor, PWR_CTRL, FIELD_MASK(PWR_CTRL_ACC_EN))) < 0 ||
+        (result = write_register(sensor, ACC_CONF, low_power ? FIELD_PREP(ACC_CONF_BWP, ACC_BWP_OSR2) | odr
+                                                               : FIELD_MASK(ACC_CONF_PERF) | FIELD_PREP(ACC_CONF_BWP, ACC_BWP_NORMAL) | odr)) < 0 ||
+        (result = write_register(sensor, PWR_CONF, FIELD_MASK(PWR_CONF_FIFO_RD) | (low_power ? FIELD_MASK(PWR_CONF_ADV_PS) : 0))) < 0)
+    {
+        // Not half-switched: stay active, the next feed tries again
+        if (write_active(gov) < 0)
+            bmi270_log(BMI270_LOG_ERROR, "0x%X --> Governor: idle switch failed, sensor left in a mixed configuration", sensor->i2c_addr);
+
+        return result;
+    }
+
+    sensor->acc_odr = ODR_HZ(odr);
+    sensor->gyr_odr = 0;
+
+    gov->state = GOV_IDLE;
+    gov->since_us = now_us;
+    gov->transitions++;
+
+    bmi270_log(BMI270_LOG_DEBUG, "0x%X --> Governor: idle", sensor->i2c_addr);
+
+    if (gov->config.on_transition)
+        gov->config.on_transition(sensor, GOV_IDLE, gov->config.ctx);
+
+    return 0;
+}
+
+static int enter_active(struct bmi270_governor *gov, uint64_t now_us)
+{
+    struct bmi270 *sensor = gov->sensor;
+    int result;
+
+    // A partial write stays idle, the next feed or wake writes the whole profile again
+    if ((result = write_active(gov)) < 0)
+        return result;
+
+    sensor->acc_odr = gov->active_acc_odr;
+    sensor->gyr_odr = gov->active_gyr_odr;
+
+    gov->state = GOV_ACTIVE;
+    gov->since_us = now_us;
+    gov->transitions++;
+
+    bmi270_log(BMI270_LOG_DEBUG, "0x%X --> Governor: active", sensor->i2c_addr);
+
+    if (gov->config.on_transition)
+        gov->config.on_transition(sensor, GOV_ACTIVE, gov->config.ctx);
+
+    return 0;
+}
+
+int bmi270_governor_init(struct bmi270_governor *gov, struct bmi270 *sensor, const struct bmi270_governor_config *config, uint64_t now_us)
+{
+    uint8_t int_status;
+    int result;
+
+    gov->sensor = sensor;
+    gov->config = *config;
+    gov->state = GOV_ACTIVE;
+    gov->pending = 0;
+    gov->since_us = now_us;
+    gov->transitions = 0;
+
+    // Idle in normal mode keeps the filter performance bit, which needs at least 12.5 Hz
+    if (config->idle_mode > GOV_IDLE_ACC_ONLY || config->idle_acc_odr < ACC_ODR_0_78 || config->idle_acc_odr > ACC_ODR_1600 ||
+        (config->idle_mode == GOV_IDLE_ACC_ONLY && config->idle_acc_odr < ACC_ODR_12_5))
+    {
+        bmi270_log(BMI270_LOG_ERROR, "0x%X --> Governor: invalid idle mode or ODR (below 12.5 Hz only in low power idle)", sensor->i2c_addr);
+        return bmi270_set_error(sensor, -EINVAL, ACC_CONF);
+    }
+
+    if ((result = read_register(sensor, PWR_CTRL, &gov->active_regs[0])) < 0 ||
+        (result = read_register(sensor, ACC_CONF, &gov->active_regs[1])) < 0 ||
+        (result = read_register(sensor, GYR_CONF, &gov->active_regs[2])) < 0 ||
+        (result = read_register(sensor, PWR_CONF, &gov->active_regs[3])) < 0)
+        return result;
+
+    gov->active_acc_odr = sensor->acc_odr;
+    gov->active_gyr_odr = sensor->gyr_odr;
+
+    // Motion detection runs on the accelerometer
+    if (!(gov->active_regs[0] & FIELD_MASK(PWR_CTRL_ACC_EN)))
+    {
+        bmi270_log(BMI270_LOG_ERROR, "0x%X --> Governor needs the accelerometer enabled", sensor->i2c_addr);
+        return bmi270_set_error(sensor, -EINVAL, PWR_CTRL);
+    }
+
+    if ((result = enable_no_motion(sensor, config->no_motion_duration, config->no_motion_threshold, FEAT_AXIS_ALL)) < 0 ||
+        (result = enable_any_motion(sensor, config->any_motion_duration, config->any_motion_threshold, FEAT_AXIS_ALL)) < 0)
+        return result;
+
+    // Clear stale motion interrupts
+    return read_register(sensor, INT_STATUS_0, &int_status);
+}
+
+int bmi270_governor_feed(struct bmi270_governor *gov, uint8_t int_status, uint64_t now_us)
+{
+    uint64_t dwell = now_us - gov->since_us;
+    int result;
+
+    gov->pending |= int_status & (ANY_MOTION_INT | NO_MOTION_INT);
+
+    if (gov->state == GOV_ACTIVE)
+    {
+        // Any motion after the no-motion event cancels it
+        if (gov->pending & ANY_MOTION_INT)
+            gov->pending &= ~(ANY_MOTION_INT | NO_MOTION_INT);
+
+        if ((gov->pending & NO_MOTION_INT) && dwell >= gov->config.min_active_us)
+        {
+            if ((result = enter_idle(gov, now_us)) < 0)
+                return result;
+
+            gov->pending = 0;
+        }
+    }
+    else
+    {
+        if (gov->pending & NO_MOTION_INT)
+            gov->pending &= ~NO_MOTION_INT;
+
+        if ((gov->pending & ANY_MOTION_INT) && dwell >= gov->config.min_idle_us)
+        {
+            if ((result = enter_active(gov, now_us)) < 0)
+                return result;
+
+            gov->pending = 0;
+        }
+    }
+
+    return gov->state;
+}
+
+int bmi270_governor_update(struct bmi270_governor *gov, uint64_t now_us)
+{
+    uint8_t int_status;
+    int result;
+
+    if ((result = read_register(gov->sensor, INT_STATUS_0, &int_status)) < 0)
+        return result;
+
+    return bmi270_governor_feed(gov, int_status, now_us);
+}
+
+int bmi270_governor_wake(struct bmi270_governor *gov, uint64_t now_us)
+{
+    gov->pending = 0;
+
+    if (gov->state == GOV_IDLE)
+        return enter_active(gov, now_us);
+
+    gov->since_us = now_us;
+    return 0;
+}
+
+int bmi270_governor_stop(struct bmi270_governor *gov, uint64_t now_us)
+{
+    int result;
+
+    if ((result = bmi270_governor_wake(gov, now_us)) < 0 ||
+        (result = disable_any_motion(gov->sensor)) < 0)
+        return result;
+
+    return disable_no_motion(gov->sensor);
+}
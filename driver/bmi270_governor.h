@@ -0,0 +1,103 @@
+#pragma once
+
+#ifndef BMI270_GOVERNOR_H
+#define BMI270_GOVERNOR_H
+
+#include "bmi270.h"
+
+/* ----------------------------------------------------
+                    DEFINITIONS
+-----------------------------------------------------*/
+
+// Governor States
+#define GOV_ACTIVE          UINT8_C(0)
+#define GOV_IDLE            UINT8_C(1)
+
+// Idle Modes
+#define GOV_IDLE_LOW_POWER  UINT8_C(0)         // Accelerometer undersampling, advanced power save
+#define GOV_IDLE_ACC_ONLY   UINT8_C(1)         // Accelerometer in normal mode, gyroscope off
+
+struct bmi270_governor_config
+{
+    /* Stationary time before going idle (on-chip no-motion, 20 ms/LSB) */
+    uint16_t no_motion_duration;
+
+    /* No-motion threshold (0.48 mg/LSB) */
+    uint16_t no_motion_threshold;
+
+    /* Motion time before waking up (on-chip any-motion, 20 ms/LSB) */
+    uint16_t any_motion_duration;
+
+    /* Any-motion threshold (0.48 mg/LSB) */
+    uint16_t any_motion_threshold;
+
+    /* Minimum time spent active before going idle again (hysteresis) */
+    uint32_t min_active_us;
+
+    /* Minimum time spent idle before waking up again (hysteresis) */
+    uint32_t min_idle_us;
+
+    /* GOV_IDLE_LOW_POWER or GOV_IDLE_ACC_ONLY */
+    uint8_t idle_mode;
+
+    /* Accelerometer ODR while idle (ACC_ODR_*, >= ACC_ODR_50 for the feature engine, >= ACC_ODR_12_5 with GOV_IDLE_ACC_ONLY) */
+    uint8_t idle_acc_odr;
+
+    /* Called after every transition with the new state (optional) */
+    void (*on_transition)(struct bmi270 *sensor, uint8_t state, void *ctx);
+
+    /* User context passed to on_transition */
+    void *ctx;
+};
+
+struct bmi270_governor
+{
+    /* Governed sensor */
+    struct bmi270 *sensor;
+
+    /* Configuration */
+    struct bmi270_governor_config config;
+
+    /* Current state: GOV_ACTIVE or GOV_IDLE */
+    uint8_t state;
+
+    /* Motion interrupts seen but not acted upon yet (INT_STATUS_0 is clear on read) */
+    uint8_t pending;
+
+    /* Time of the last transition */
+    uint64_t since_us;
+
+    /* Number of transitions */
+    uint32_t transitions;
+
+    /* Active configuration: PWR_CTRL, ACC_CONF, GYR_CONF, PWR_CONF */
+    uint8_t active_regs[4];
+
+    /* Active ODRs */
+    double active_acc_odr;
+    double active_gyr_odr;
+};
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+/* Fill config with defaults: idle after 5 s still, low power idle at 50 Hz */
+void bmi270_governor_defaults(struct bmi270_governor_config *config);
+
+/* Snapshot the current sensor configuration as active profile and enable any/no-motion */
+int bmi270_governor_init(struct bmi270_governor *gov, struct bmi270 *sensor, const struct bmi270_governor_config *config, uint64_t now_us);
+
+/* Poll INT_STATUS_0 and switch state if needed - returns the current state (GOV_*) or a negative errno */
+int bmi270_governor_update(struct bmi270_governor *gov, uint64_t now_us);
+
+/* Feed an already read INT_STATUS_0 value (e.g. from an interrupt handler) - returns like bmi270_governor_update */
+int bmi270_governor_feed(struct bmi270_governor *gov, uint8_t int_status, uint64_t now_us);
+
+/* Force active state */
+int bmi270_governor_wake(struct bmi270_governor *gov, uint64_t now_us);
+
+/* Restore the active profile and disable any/no-motion */
+int bmi270_governor_stop(struct bmi270_governor *gov, uint64_t now_us);
+
+#endif // BMI270_GOVERNOR_H
@@ -0,0 +1,392 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/gpio.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+#include "bmi270.h"
+#include "bmi270_loop.h"
+#include "bmi270_trace.h"
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+int bmi270_loop_init(struct bmi270_loop *loop)
+{
+    for (int i = 0; i < LOOP_MAX_SOURCES; i++)
+        loop->sources[i].fd = -1;
+
+    atomic_init(&loop->running, 0);
+    loop->wakeups = 0;
+
+    if ((loop->epoll_fd = epoll_create1(EPOLL_CLOEXEC)) < 0)
+        return -errno;
+
+    return 0;
+}
+
+static int add_source(struct bmi270_loop *loop, int fd, uint8_t type, uint8_t owned, uint32_t events, bmi270_loop_handler handler, void *ctx)
+{
+    struct epoll_event event = {.events = events};
+    struct bmi270_loop_source *source;
+    int id;
+
+    for (id = 0; id < LOOP_MAX_SOURCES; id++)
+    {
+        if (loop->sources[id].fd < 0)
+            break;
+    }
+
+    if (id == LOOP_MAX_SOURCES)
+        return -ENOSPC;
+
+    event.data.u32 = id;
+
+    if (epoll_ctl(loop->epoll_fd, EPOLL_CTL_ADD, fd, &event) < 0)
+        return -errno;
+
+    source = &loop->sources[id];
+    memset(source, 0, sizeof(*source));
+    source->fd = fd;
+    source->type = type;
+    source->owned = owned;
+    source->handler = handler;
+    source->ctx = ctx;
+
+    return id;
+}
+
+int bmi270_loop_add_fd(struct bmi270_loop *loop, int fd, uint32_t events, bmi270_loop_handler handler, void *ctx)
+{
+    return add_source(loop, fd, LOOP_SOURCE_FD, 0, events, handler, ctx);
+}
+
+int bmi270_loop_add_timer(struct bmi270_loop *loop, uint64_t period_ns, bmi270_loop_handler handler, void *ctx)
+{
+    struct itimerspec spec;
+    int fd, id;
+
+    if (period_ns == 0)
+        return -EINVAL;
+
+    if ((fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC)) < 0)
+        return -errno;
+
+    // Kernel-paced: no sleep quantization, no drift from handler run time
+    spec.it_interval.tv_sec = period_ns / 1000000000ULL;
+    spec.it_interval.tv_nsec = period_ns % 1000000000ULL;
+    spec.it_value = spec.it_interval;
+
+    if (timerfd_settime(fd, 0, &spec, NULL) < 0)
+    {
+        id = -errno;
+        close(fd);
+        return id;
+    }
+
+    if ((id = add_source(loop, fd, LOOP_SOURCE_TIMER, 1, EPOLLIN, handler, ctx)) < 0)
+        close(fd);
+
+    return id;
+}
+
+int bmi270_loop_add_gpio(struct bmi270_loop *loop, const char *chip, uint32_t line, bmi270_loop_handler handler, void *ctx)
+{
+    struct gpio_v2_line_request request;
+    int chip_fd, id;
+
+    if ((chip_fd = open(chip, O_RDWR | O_CLOEXEC)) < 0)
+    {
+        bmi270_log(BMI270_LOG_ERROR, "Could not open GPIO chip %s", chip);
+        return -errno;
+    }
+
+    memset(&request, 0, sizeof(request));
+    request.offsets[0] = line;
+    request.num_lines = 1;
+    request.config.flags = GPIO_V2_LINE_FLAG_INPUT | GPIO_V2_LINE_FLAG_EDGE_RISING;
+    request.event_buffer_size = 16;
+    strcpy(request.consumer, "bmi270");
+
+    if (ioctl(chip_fd, GPIO_V2_GET_LINE_IOCTL, &request) < 0)
+    {
+        id = -errno;
+        bmi270_log(BMI270_LOG_ERROR, "Could not request GPIO line %u on %s", line, chip);
+        close(chip_fd);
+        return id;
+    }
+
+    // The line fd stays valid without the chip fd
+    close(chip_fd);
+    fcntl(request.fd, F_SETFL, fcntl(request.fd, F_GETFL) | O_NONBLOCK);
+
+    if ((id = add_source(loop, request.fd, LOOP_SOURCE_GPIO, 1, EPOLLIN, handler, ctx)) < 0)
+        close(request.fd);
+
+    return id;
+}
+
+int bmi270_loop_add_sink(struct bmi270_loop *loop, int fd, uint8_t *buffer, size_t size)
+{
+    int type, id;
+    socklen_t type_len = sizeof(type);
+
+    if (fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) < 0)
+        return -errno;
+
+    // EPOLLOUT is armed only while data is pending
+    if ((id = add_source(loop, fd, LOOP_SOURCE_SINK, 0, 0, NULL, NULL)) < 0)
+        return id;
+
+    loop->sources[id].buffer = buffer;
+    loop->sources[id].size = size;
+    loop->sources[id].datagram = getsockopt(fd, SOL_SOCKET, SO_TYPE, &type, &type_len) == 0 && type == SOCK_DGRAM;
+
+    return id;
+}
+
+static void arm_sink(struct bmi270_loop *loop, int id, uint8_t armed)
+{
+    struct bmi270_loop_source *source = &loop->sources[id];
+    struct epoll_event event = {.events = armed ? EPOLLOUT : 0, .data.u32 = id};
+
+    if (source->armed == armed)
+        return;
+
+    if (epoll_ctl(loop->epoll_fd, EPOLL_CTL_MOD, source->fd, &event) == 0)
+        source->armed = armed;
+}
+
+static int queue_data(struct bmi270_loop_source *source, const void *data, size_t len)
+{
+    size_t needed = len + (source->datagram ? sizeof(uint16_t) : 0);
+
+    if (source->datagram && len > UINT16_MAX)
+        return -EMSGSIZE;
+
+    // Compact before giving up on space
+    if (source->size - source->len < needed && source->head > 0)
+    {
+        memmove(source->buffer, source->buffer + source->head, source->len - source->head);
+        source->len -= source->head;
+        source->head = 0;
+    }
+
+    if (source->size - source->len < needed)
+    {
+        source->dropped += len;
+        return -ENOBUFS;
+    }
+
+    if (source->datagram)
+    {
+        uint16_t record_len = (uint16_t)len;
+        memcpy(source->buffer + source->len, &record_len, sizeof(record_len));
+        source->len += sizeof(record_len);
+    }
+
+    memcpy(source->buffer + source->len, data, len);
+    source->len += len;
+
+    return 0;
+}
+
+static int flush_sink(struct bmi270_loop_source *source)
+{
+    while (source->head < source->len)
+    {
+        const uint8_t *data = source->buffer + source->head;
+        size_t len = source->len - source->head;
+        size_t skip = 0;
+        ssize_t written;
+
+        if (source->datagram)
+        {
+            uint16_t record_len;
+            memcpy(&record_len, data, sizeof(record_len));
+            data += sizeof(record_len);
+            skip = sizeof(record_len);
+            len = record_len;
+        }
+
+        bmi270_trace_begin(TRACE_SEND, (uint32_t)len);
+        written = send(source->fd, data, len, MSG_NOSIGNAL);
+        bmi270_trace_end(TRACE_SEND, (uint32_t)len);
+
+        if (written < 0)
+        {
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+                return 0;
+
+            // Drop the record on hard errors, the sink may come back
+            if (!source->datagram)
+                return -errno;
+
+            written = len;
+        }
+
+        source->head += skip + (source->datagram ? len : (size_t)written);
+    }
+
+    source->head = 0;
+    source->len = 0;
+
+    return 0;
+}
+
+int bmi270_loop_send(struct bmi270_loop *loop, int id, const void *data, size_t len)
+{
+    struct bmi270_loop_source *source;
+    ssize_t written = 0;
+
+    if (id < 0 || id >= LOOP_MAX_SOURCES || loop->sources[id].type != LOOP_SOURCE_SINK || loop->sources[id].fd < 0)
+        return -EINVAL;
+
+    source = &loop->sources[id];
+
+    // Fast path: nothing pending, write directly without copying
+    if (source->head == source->len)
+    {
+        bmi270_trace_begin(TRACE_SEND, (uint32_t)len);
+        written = send(source->fd, data, len, MSG_NOSIGNAL);
+        bmi270_trace_end(TRACE_SEND, (uint32_t)len);
+
+        if (written < 0)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+                return -errno;
+
+            written = 0;
+        }
+
+        if ((size_t)written == len || (source->datagram && written > 0))
+            return 0;
+    }
+
+    int result = queue_data(source, (const uint8_t *)data + written, len - written);
+
+    bmi270_trace_instant(TRACE_ENQUEUE, (uint32_t)(len - written));
+
+    arm_sink(loop, id, 1);
+
+    return result;
+}
+
+int bmi270_loop_remove(struct bmi270_loop *loop, int id)
+{
+    struct bmi270_loop_source *source;
+
+    if (id < 0 || id >= LOOP_MAX_SOURCES || loop->sources[id].fd < 0)
+        return -EINVAL;
+
+    source = &loop->sources[id];
+    epoll_ctl(loop->epoll_fd, EPOLL_CTL_DEL, source->fd, NULL);
+
+    if (source->owned)
+        close(source->fd);
+
+    source->fd = -1;
+
+    return 0;
+}
+
+static void dispatch(struct bmi270_loop *loop, int id, uint32_t events)
+{
+    struct bmi270_loop_source *source = &loop->sources[id];
+    uint64_t value = events;
+
+    switch (source->type)
+    {
+    case LOOP_SOURCE_TIMER:
+        if (read(source->fd, &value, sizeof(value)) != sizeof(value))
+            return;
+
+        bmi270_trace_instant(TRACE_READY, (uint32_t)id);
+        break;
+
+    case LOOP_SOURCE_GPIO:
+    {
+        struct gpio_v2_line_event event;
+
+        if (read(source->fd, &event, sizeof(event)) != sizeof(event))
+            return;
+
+        // The edge itself, not the wakeup: includes the interrupt latency
+        value = event.timestamp_ns;
+        bmi270_trace_at(TRACE_READY, TRACE_INSTANT, (uint32_t)id, value);
+        break;
+    }
+
+    case LOOP_SOURCE_SINK:
+        if (flush_sink(source) < 0 || source->head == source->len)
+            arm_sink(loop, id, 0);
+        return;
+    }
+
+    source->events++;
+
+    if (source->handler)
+        source->handler(loop, id, value, source->ctx);
+}
+
+int bmi270_loop_run_once(struct bmi270_loop *loop, int timeout_ms)
+{
+    struct epoll_event events[LOOP_MAX_EVENTS];
+    int count;
+
+    if ((count = epoll_wait(loop->epoll_fd, events, LOOP_MAX_EVENTS, timeout_ms)) < 0)
+        return errno == EINTR ? 0 : -errno;
+
+    if (count > 0)
+        loop->wakeups++;
+
+    for (int i = 0; i < count; i++)
+    {
+        int id = events[i].data.u32;
+
+        // A handler may have removed the source
+        if (loop->sources[id].fd >= 0)
+            dispatch(loop, id, events[i].events);
+    }
+
+    return count;
+}
+
+int bmi270_loop_run(struct bmi270_loop *loop)
+{
+    int result = 0;
+
+    atomic_store(&loop->running, 1);
+
+    while (atomic_load_explicit(&loop->running, memory_order_relaxed))
+    {
+        if ((result = bmi270_loop_run_once(loop, -1)) < 0)
+            break;
+    }
+
+    return result < 0 ? result : 0;
+}
+
+void bmi270_loop_stop(struct bmi270_loop *loop)
+{
+    atomic_store(&loop->running, 0);
+}
+
+void bmi270_loop_close(struct bmi270_loop *loop)
+{
+    for (int i = 0; i < LOOP_MAX_SOURCES; i++)
+    {
+        if (loop->sources[i].fd >= 0)
+            bmi270_loop_remove(loop, i);
+    }
+
+    close(loop->epoll_fd);
+    loop->epoll_fd = -1;
+}
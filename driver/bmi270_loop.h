@@ -0,0 +1,112 @@
+#pragma once
+
+#ifndef BMI270_LOOP_H
+#define BMI270_LOOP_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* ----------------------------------------------------
+                    DEFINITIONS
+-----------------------------------------------------*/
+
+#define LOOP_MAX_SOURCES    32                 // Sources per loop
+#define LOOP_MAX_EVENTS     16                 // Events per epoll_wait
+
+// Source Types
+#define LOOP_SOURCE_FD      UINT8_C(0)         // Plain fd, handler value: epoll events
+#define LOOP_SOURCE_TIMER   UINT8_C(1)         // timerfd, handler value: expirations
+#define LOOP_SOURCE_GPIO    UINT8_C(2)         // GPIO line edge, handler value: event timestamp (ns)
+#define LOOP_SOURCE_SINK    UINT8_C(3)         // Non-blocking socket written by bmi270_loop_send
+
+struct bmi270_loop;
+
+/* Called from bmi270_loop_run for every ready source */
+typedef void (*bmi270_loop_handler)(struct bmi270_loop *loop, int source, uint64_t value, void *ctx);
+
+struct bmi270_loop_source
+{
+    /* fd, -1 for free slots */
+    int fd;
+
+    /* LOOP_SOURCE_* */
+    uint8_t type;
+
+    /* fd is closed when the source is removed */
+    uint8_t owned;
+
+    /* Sink: datagram socket, pending data is kept as length-prefixed records */
+    uint8_t datagram;
+
+    /* Sink: EPOLLOUT is armed */
+    uint8_t armed;
+
+    /* Handler and user context */
+    bmi270_loop_handler handler;
+    void *ctx;
+
+    /* Sink: user-provided buffer for data the socket could not take yet */
+    uint8_t *buffer;
+    size_t size;
+    size_t head;
+    size_t len;
+
+    /* Dispatched events and sink bytes dropped because the buffer was full */
+    uint64_t events;
+    uint64_t dropped;
+};
+
+struct bmi270_loop
+{
+    /* epoll instance */
+    int epoll_fd;
+
+    /* bmi270_loop_run returns when cleared */
+    atomic_int running;
+
+    /* Sources, indexed by source id */
+    struct bmi270_loop_source sources[LOOP_MAX_SOURCES];
+
+    /* epoll_wait calls that returned events */
+    uint64_t wakeups;
+};
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+/* Create the epoll instance */
+int bmi270_loop_init(struct bmi270_loop *loop);
+
+/* Watch an fd for epoll events (EPOLLIN, ...) - returns the source id */
+int bmi270_loop_add_fd(struct bmi270_loop *loop, int fd, uint32_t events, bmi270_loop_handler handler, void *ctx);
+
+/* Call handler every period_ns, e.g. to poll sensors at their ODR - returns the source id */
+int bmi270_loop_add_timer(struct bmi270_loop *loop, uint64_t period_ns, bmi270_loop_handler handler, void *ctx);
+
+/* Call handler on rising edges of a GPIO line (e.g. "/dev/gpiochip0", INT1 wired to line 17) - returns the source id */
+int bmi270_loop_add_gpio(struct bmi270_loop *loop, const char *chip, uint32_t line, bmi270_loop_handler handler, void *ctx);
+
+/* Add a connected socket as sink, buffer holds data while the socket is busy - returns the source id */
+int bmi270_loop_add_sink(struct bmi270_loop *loop, int fd, uint8_t *buffer, size_t size);
+
+/* Send data to a sink without blocking - returns -ENOBUFS if the data was dropped */
+int bmi270_loop_send(struct bmi270_loop *loop, int source, const void *data, size_t len);
+
+/* Remove a source, closing fds created by the loop */
+int bmi270_loop_remove(struct bmi270_loop *loop, int source);
+
+/* Wait up to timeout_ms (-1 = forever) and dispatch ready sources - returns the number dispatched */
+int bmi270_loop_run_once(struct bmi270_loop *loop, int timeout_ms);
+
+/* Dispatch until bmi270_loop_stop is called */
+int bmi270_loop_run(struct bmi270_loop *loop);
+
+/* Make bmi270_loop_run return, safe from handlers and signal handlers */
+void bmi270_loop_stop(struct bmi270_loop *loop);
+
+/* Remove all sources and close the epoll instance */
+void bmi270_loop_close(struct bmi270_loop *loop);
+
+#endif // BMI270_LOOP_H
@@ -0,0 +1,324 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "bmi270_manager.h"
+#include "bmi270_stats.h"
+#include "bmi270_trace.h"
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+static void push_samples(struct bmi270_manager *manager, const struct bmi270_sample *samples, int count)
+{
+    pthread_mutex_lock(&manager->lock);
+
+    for (int i = 0; i < count; i++)
+    {
+        // Consumers want fresh data: overwrite the oldest sample when full
+        if (manager->head - manager->tail == MANAGER_QUEUE_SIZE)
+        {
+            manager->tail++;
+            manager->dropped++;
+        }
+
+        manager->queue[manager->head++ & (MANAGER_QUEUE_SIZE - 1)] = samples[i];
+    }
+
+    pthread_cond_broadcast(&manager->ready);
+    pthread_mutex_unlock(&manager->lock);
+}
+
+static void *bus_worker(void *arg)
+{
+    struct bmi270_bus *bus = arg;
+    struct bmi270_manager *manager = bus->manager;
+    struct bmi270_sample batch[MANAGER_MAX_DEVICES];
+    struct timespec next;
+
+    clock_gettime(CLOCK_MONOTONIC, &next);
+
+    while (atomic_load_explicit(&manager->running, memory_order_relaxed))
+    {
+        for (int i = 0; i < bus->num_devices; i++)
+        {
+            uint8_t device = bus->devices[i];
+            struct bmi270_sample *sample = &batch[i];
+            uint64_t now_us = bmi270_stats_now() / 1000;
+            int result = -1;
+
+            sample->timestamp_us = now_us;
+            sample->device = device;
+            sample->flags = 0;
+
+            // Recovery does a bounded amount of bus work, the other sensors on the bus keep streaming
+            if (bmi270_recovery_step(&manager->recovery[device], now_us) == RECOVERY_OK)
+            {
+                bmi270_trace_begin(TRACE_READ, device);
+                result = get_acc_gyr_raw(&manager->sensors[device], sample->acc, sample->gyr);
+                bmi270_trace_end(TRACE_READ, device);
+                bmi270_recovery_report(&manager->recovery[device], result, now_us);
+            }
+
+            if (result == 0)
+            {
+                sample->flags |= SAMPLE_VALID;
+            }
+            else
+            {
+                memset(sample->acc, 0, sizeof(sample->acc));
+                memset(sample->gyr, 0, sizeof(sample->gyr));
+            }
+        }
+
+        // One lock per bus cycle, not per sample
+        bmi270_trace_begin(TRACE_ENQUEUE, bus->num_devices);
+        push_samples(manager, batch, bus->num_devices);
+        bmi270_trace_end(TRACE_ENQUEUE, bus->num_devices);
+        atomic_fetch_add_explicit(&bus->cycles, 1, memory_order_relaxed);
+
+        next.tv_nsec += manager->period_ns;
+
+        while (next.tv_nsec >= 1000000000L)
+        {
+            next.tv_nsec -= 1000000000L;
+            next.tv_sec++;
+        }
+
+        // Missed deadline: restart the schedule instead of bursting to catch up
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+
+        if (now.tv_sec > next.tv_sec || (now.tv_sec == next.tv_sec && now.tv_nsec > next.tv_nsec))
+        {
+            atomic_fetch_add_explicit(&bus->overruns, 1, memory_order_relaxed);
+            next = now;
+            continue;
+        }
+
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+    }
+
+    return NULL;
+}
+
+int bmi270_manager_init(struct bmi270_manager *manager)
+{
+    pthread_condattr_t attr;
+    int result;
+
+    memset(manager->sensors, 0, sizeof(manager->sensors));
+    manager->num_devices = 0;
+    manager->num_buses = 0;
+    manager->period_ns = 0;
+    manager->head = 0;
+    manager->tail = 0;
+    manager->dropped = 0;
+    atomic_init(&manager->running, 0);
+
+    if ((result = pthread_mutex_init(&manager->lock, NULL)) != 0)
+        return -result;
+
+    // Timed waits use the same clock as the sample timestamps
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    result = pthread_cond_init(&manager->ready, &attr);
+    pthread_condattr_destroy(&attr);
+
+    if (result != 0)
+    {
+        pthread_mutex_destroy(&manager->lock);
+        return -result;
+    }
+
+    return 0;
+}
+
+static struct bmi270_bus *open_bus(struct bmi270_manager *manager, const char *bus_device)
+{
+    struct bmi270_bus *bus;
+
+    for (int i = 0; i < manager->num_buses; i++)
+    {
+        if (strcmp(manager->buses[i].device, bus_device) == 0)
+            return &manager->buses[i];
+    }
+
+    if (manager->num_buses == MANAGER_MAX_BUSES || strlen(bus_device) >= MANAGER_PATH_LEN)
+    {
+        errno = EINVAL;
+        return NULL;
+    }
+
+    bus = &manager->buses[manager->num_buses];
+
+    if ((bus->fd = open(bus_device, O_RDWR)) < 0)
+    {
+        bmi270_log(BMI270_LOG_ERROR, "Could not open I2C bus for %s", bus_device);
+        return NULL;
+    }
+
+    strcpy(bus->device, bus_device);
+    bus->num_devices = 0;
+    bus->manager = manager;
+    atomic_init(&bus->cycles, 0);
+    atomic_init(&bus->overruns, 0);
+
+    manager->num_buses++;
+
+    return bus;
+}
+
+int bmi270_manager_add(struct bmi270_manager *manager, const char *bus_device, uint8_t i2c_addr)
+{
+    struct bmi270_bus *bus;
+    struct bmi270 *sensor;
+    uint8_t num_buses = manager->num_buses;
+    int result;
+
+    if (manager->num_devices == MANAGER_MAX_DEVICES || atomic_load(&manager->running))
+        return -EINVAL;
+
+    if ((bus = open_bus(manager, bus_device)) == NULL)
+        return -errno;
+
+    sensor = &manager->sensors[manager->num_devices];
+    memset(sensor, 0, sizeof(*sensor));
+    sensor->i2c_addr = i2c_addr;
+
+    if ((result = bmi270_init_fd(sensor, bus->fd)) < 0)
+    {
+        // Do not keep a bus opened for this sensor only
+        if (manager->num_buses != num_buses)
+        {
+            close(bus->fd);
+            manager->num_buses = num_buses;
+        }
+
+        return result;
+    }
+
+    bus->devices[bus->num_devices++] = manager->num_devices;
+
+    return manager->num_devices++;
+}
+
+struct bmi270 *bmi270_manager_sensor(struct bmi270_manager *manager, uint8_t device)
+{
+    return device < manager->num_devices ? &manager->sensors[device] : NULL;
+}
+
+int bmi270_manager_start(struct bmi270_manager *manager, double rate_hz, const struct bmi270_recovery_config *config)
+{
+    struct bmi270_recovery_config defaults;
+    uint64_t now_us = bmi270_stats_now() / 1000;
+    int result;
+
+    if (rate_hz <= 0.0 || atomic_load(&manager->running))
+        return -EINVAL;
+
+    if (config == NULL)
+    {
+        bmi270_recovery_defaults(&defaults);
+        config = &defaults;
+    }
+
+    for (int i = 0; i < manager->num_devices; i++)
+    {
+        if ((result = bmi270_recovery_init(&manager->recovery[i], &manager->sensors[i], config, now_us)) < 0)
+            return result;
+    }
+
+    manager->period_ns = (uint64_t)(1e9 / rate_hz);
+    atomic_store(&manager->running, 1);
+
+    for (int i = 0; i < manager->num_buses; i++)
+    {
+        if ((result = pthread_create(&manager->buses[i].thread, NULL, bus_worker, &manager->buses[i])) != 0)
+        {
+            atomic_store(&manager->running, 0);
+
+            for (int j = 0; j < i; j++)
+                pthread_join(manager->buses[j].thread, NULL);
+
+            return -result;
+        }
+    }
+
+    return 0;
+}
+
+int bmi270_manager_read(struct bmi270_manager *manager, struct bmi270_sample *samples, int max, int timeout_ms)
+{
+    struct timespec deadline;
+    int count = 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    deadline.tv_sec += timeout_ms / 1000;
+    deadline.tv_nsec += (long)(timeout_ms % 1000) * 1000000L;
+
+    if (deadline.tv_nsec >= 1000000000L)
+    {
+        deadline.tv_nsec -= 1000000000L;
+        deadline.tv_sec++;
+    }
+
+    pthread_mutex_lock(&manager->lock);
+
+    while (manager->head == manager->tail && timeout_ms > 0)
+    {
+        if (pthread_cond_timedwait(&manager->ready, &manager->lock, &deadline) == ETIMEDOUT)
+            break;
+    }
+
+    while (count < max && manager->tail != manager->head)
+        samples[count++] = manager->queue[manager->tail++ & (MANAGER_QUEUE_SIZE - 1)];
+
+    pthread_mutex_unlock(&manager->lock);
+
+    return count;
+}
+
+struct bmi270_batch *bmi270_manager_read_batch(struct bmi270_manager *manager, struct bmi270_pool *pool, int timeout_ms)
+{
+    struct bmi270_batch *batch;
+
+    if ((batch = bmi270_pool_acquire(pool)) == NULL)
+        return NULL;
+
+    if ((batch->count = bmi270_manager_read(manager, batch->samples, batch->capacity, timeout_ms)) == 0)
+    {
+        bmi270_batch_unref(batch);
+        return NULL;
+    }
+
+    return batch;
+}
+
+void bmi270_manager_stop(struct bmi270_manager *manager)
+{
+    if (!atomic_exchange(&manager->running, 0))
+        return;
+
+    for (int i = 0; i < manager->num_buses; i++)
+        pthread_join(manager->buses[i].thread, NULL);
+}
+
+void bmi270_manager_close(struct bmi270_manager *manager)
+{
+    bmi270_manager_stop(manager);
+
+    for (int i = 0; i < manager->num_buses; i++)
+        close(manager->buses[i].fd);
+
+    manager->num_buses = 0;
+    manager->num_devices = 0;
+
+    pthread_cond_destroy(&manager->ready);
+    pthread_mutex_destroy(&manager->lock);
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#ifndef BMI270_MANAGER_H
+#define BMI270_MANAGER_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "bmi270.h"
+#include "bmi270_pool.h"
+#include "bmi270_recovery.h"
+
+/* ----------------------------------------------------
+                    DEFINITIONS
+-----------------------------------------------------*/
+
+#define MANAGER_MAX_BUSES   8                  // I2C buses per manager
+#define MANAGER_MAX_DEVICES 16                 // Sensors per manager (all buses)
+#define MANAGER_QUEUE_SIZE  4096               // Merged sample queue (power of two)
+#define MANAGER_PATH_LEN    32                 // I2C bus device path length
+
+struct bmi270_manager;
+
+struct bmi270_bus
+{
+    /* I2C bus device (e.g. "/dev/i2c-3") */
+    char device[MANAGER_PATH_LEN];
+
+    /* Bus fd, shared by all sensors on the bus */
+    int fd;
+
+    /* Sensors on the bus: indexes into the manager */
+    uint8_t num_devices;
+    uint8_t devices[MANAGER_MAX_DEVICES];
+
+    /* Worker thread */
+    pthread_t thread;
+    struct bmi270_manager *manager;
+
+    /* Completed read cycles and cycles that missed their deadline */
+    atomic_uint_fast64_t cycles;
+    atomic_uint_fast64_t overruns;
+};
+
+struct bmi270_manager
+{
+    /* Sensors and their recovery state machines */
+    struct bmi270 sensors[MANAGER_MAX_DEVICES];
+    struct bmi270_recovery recovery[MANAGER_MAX_DEVICES];
+    uint8_t num_devices;
+
+    /* Buses */
+    struct bmi270_bus buses[MANAGER_MAX_BUSES];
+    uint8_t num_buses;
+
+    /* Read period of every bus (ns) */
+    uint64_t period_ns;
+
+    /* Worker threads keep running while set */
+    atomic_int running;
+
+    /* Merged sample stream: ring buffer, the oldest samples are dropped when full */
+    pthread_mutex_t lock;
+    pthread_cond_t ready;
+    struct bmi270_sample queue[MANAGER_QUEUE_SIZE];
+    uint32_t head;
+    uint32_t tail;
+    uint64_t dropped;
+};
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+/* Initialize an empty manager - the struct is large, keep it static or on the heap */
+int bmi270_manager_init(struct bmi270_manager *manager);
+
+/* Add a sensor on an I2C bus device, opening the bus on first use - returns the device index */
+int bmi270_manager_add(struct bmi270_manager *manager, const char *bus_device, uint8_t i2c_addr);
+
+/* Get a sensor by device index, to configure it before bmi270_manager_start */
+struct bmi270 *bmi270_manager_sensor(struct bmi270_manager *manager, uint8_t device);
+
+/* Snapshot sensor configurations and start one worker thread per bus, reading every sensor at rate_hz */
+int bmi270_manager_start(struct bmi270_manager *manager, double rate_hz, const struct bmi270_recovery_config *config);
+
+/* Read up to max samples of all sensors in arrival order, waiting up to timeout_ms - returns the number read */
+int bmi270_manager_read(struct bmi270_manager *manager, struct bmi270_sample *samples, int max, int timeout_ms);
+
+/* Read samples into a batch from pool, shareable by several sinks - NULL on timeout or exhausted pool */
+struct bmi270_batch *bmi270_manager_read_batch(struct bmi270_manager *manager, struct bmi270_pool *pool, int timeout_ms);
+
+/* Stop and join the worker threads */
+void bmi270_manager_stop(struct bmi270_manager *manager);
+
+/* Stop the worker threads and close all buses */
+void bmi270_manager_close(struct bmi270_manager *manager);
+
+#endif // BMI270_MANAGER_H
@@ -0,0 +1,403 @@
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <netinet/in.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "bmi270_metrics.h"
+#include "bmi270_stats.h"
+
+/* One counter or gauge per device, value() returns 0 if the device has no such value */
+struct metric
+{
+    const char *name;
+    const char *type;
+    const char *help;
+    int (*value)(const struct bmi270_metrics_device *device, uint64_t *value);
+};
+
+/* ----------------------------------------------------
+                  HELPER FUNCTIONS
+-----------------------------------------------------*/
+
+#define COUNTER_VALUE(fn, field)                                                          \
+    static int fn(const struct bmi270_metrics_device *device, uint64_t *value)           \
+    {                                                                                     \
+        *value = atomic_load_explicit(&device->field, memory_order_relaxed);              \
+        return 1;                                                                         \
+    }
+
+COUNTER_VALUE(samples_value, samples)
+COUNTER_VALUE(read_failures_value, read_failures)
+COUNTER_VALUE(dropped_value, dropped)
+COUNTER_VALUE(config_reloads_value, config_reloads)
+COUNTER_VALUE(loops_value, loops)
+
+static uint64_t sum_ops(const atomic_uint_fast64_t *counters)
+{
+    uint64_t sum = 0;
+
+    for (int op = 0; op < STATS_NUM_OPS; op++)
+    {
+        sum += atomic_load_explicit(&counters[op], memory_order_relaxed);
+    }
+
+    return sum;
+}
+
+static int transactions_value(const struct bmi270_metrics_device *device, uint64_t *value)
+{
+    return device->sensor->stats ? (*value = sum_ops(device->sensor->stats->transactions), 1) : 0;
+}
+
+static int i2c_errors_value(const struct bmi270_metrics_device *device, uint64_t *value)
+{
+    // Without bus statistics the sensor still counts its failed transactions
+    *value = device->sensor->stats ? sum_ops(device->sensor->stats->errors) : device->sensor->error_count;
+    return 1;
+}
+
+static int retries_value(const struct bmi270_metrics_device *device, uint64_t *value)
+{
+    return device->sensor->stats ? (*value = atomic_load_explicit(&device->sensor->stats->retries, memory_order_relaxed), 1) : 0;
+}
+
+static int overruns_value(const struct bmi270_metrics_device *device, uint64_t *value)
+{
+    return device->sensor->stats ? (*value = atomic_load_explicit(&device->sensor->stats->loop_overruns, memory_order_relaxed), 1) : 0;
+}
+
+static int recoveries_value(const struct bmi270_metrics_device *device, uint64_t *value)
+{
+    return device->recovery ? (*value = device->recovery->recoveries, 1) : 0;
+}
+
+static int uploads_value(const struct bmi270_metrics_device *device, uint64_t *value)
+{
+    return device->recovery ? (*value = device->recovery->uploads, 1) : 0;
+}
+
+static int up_value(const struct bmi270_metrics_device *device, uint64_t *value)
+{
+    *value = device->recovery ? device->recovery->state == RECOVERY_OK : device->sensor->last_error == 0;
+    return 1;
+}
+
+static const struct metric metrics_table[] = {
+    {"bmi270_up", "gauge", "1 if the sensor is streaming", up_value},
+    {"bmi270_samples_total", "counter", "Samples delivered", samples_value},
+    {"bmi270_read_failures_total", "counter", "Sample reads that failed", read_failures_value},
+    {"bmi270_dropped_samples_total", "counter", "Samples dropped downstream (queue or network full)", dropped_value},
+    {"bmi270_config_reloads_total", "counter", "Configuration reloads", config_reloads_value},
+    {"bmi270_loops_total", "counter", "Acquisition loop iterations", loops_value},
+    {"bmi270_loop_overruns_total", "counter", "Acquisition loop iterations over their time budget", overruns_value},
+    {"bmi270_i2c_transactions_total", "counter", "I2C transactions", transactions_value},
+    {"bmi270_i2c_errors_total", "counter", "Failed I2C transactions", i2c_errors_value},
+    {"bmi270_i2c_retries_total", "counter", "Retried I2C transactions", retries_value},
+    {"bmi270_recoveries_total", "counter", "Completed sensor recoveries", recoveries_value},
+    {"bmi270_config_uploads_total", "counter", "Config file uploads by the recovery", uploads_value},
+};
+
+/* Close a connection, the sweep timer stops with the last one */
+static void remove_client(struct bmi270_metrics *metrics, int index)
+{
+    bmi270_loop_remove(metrics->loop, metrics->clients[index].source);
+    metrics->clients[index] = metrics->clients[--metrics->num_clients];
+
+    if (metrics->num_clients == 0 && metrics->sweep >= 0)
+    {
+        bmi270_loop_remove(metrics->loop, metrics->sweep);
+        metrics->sweep = -1;
+    }
+}
+
+static void on_sweep(struct bmi270_loop *loop, int source, uint64_t expirations, void *ctx)
+{
+    struct bmi270_metrics *metrics = ctx;
+    uint64_t now = bmi270_stats_now();
+
+    (void)loop;
+    (void)source;
+    (void)expirations;
+
+    // Backwards: removing moves the last client into the freed slot
+    for (int i = metrics->num_clients - 1; i >= 0; i--)
+    {
+        if (now - metrics->clients[i].since_ns >= (uint64_t)METRICS_TIMEOUT_MS * 1000000)
+            remove_client(metrics, i);
+    }
+}
+
+static void on_request(struct bmi270_loop *loop, int source, uint64_t events, void *ctx)
+{
+    struct bmi270_metrics *metrics = ctx;
+    int fd = loop->sources[source].fd;
+    char request[METRICS_REQUEST_LEN], header[128];
+    char *body = NULL;
+    size_t body_len = 0;
+    ssize_t received;
+    FILE *out;
+
+    (void)events;
+
+    // Any request gets the metrics, the method and path are not looked at
+    if ((received = recv(fd, request, sizeof(request), 0)) < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        return;
+
+    if (received > 0 && (out = open_memstream(&body, &body_len)))
+    {
+        bmi270_metrics_write(metrics, out);
+        fclose(out);
+
+        int header_len = snprintf(header, sizeof(header), "HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\nContent-Length: %zu\r\nConnection: close\r\n\r\n", body_len);
+
+        // A scrape fits the socket buffer, a client that does not read it gets a truncated answer
+        if (send(fd, header, header_len, MSG_NOSIGNAL | MSG_MORE) == header_len)
+            send(fd, body, body_len, MSG_NOSIGNAL);
+
+        free(body);
+        atomic_fetch_add_explicit(&metrics->scrapes, 1, memory_order_relaxed);
+    }
+
+    for (int i = 0; i < metrics->num_clients; i++)
+    {
+        if (metrics->clients[i].source == source)
+        {
+            remove_client(metrics, i);
+            return;
+        }
+    }
+
+    bmi270_loop_remove(loop, source);
+}
+
+static void on_connect(struct bmi270_loop *loop, int source, uint64_t events, void *ctx)
+{
+    struct bmi270_metrics *metrics = ctx;
+    int fd, id;
+
+    (void)events;
+
+    while ((fd = accept4(loop->sources[source].fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC)) >= 0)
+    {
+        // Idle connections must not take every loop source
+        if (metrics->num_clients == METRICS_MAX_CLIENTS || (id = bmi270_loop_add_fd(loop, fd, EPOLLIN, on_request, ctx)) < 0)
+        {
+            close(fd);
+            continue;
+        }
+
+        // Closed when the request is done or by the sweep
+        loop->sources[id].owned = 1;
+        metrics->clients[metrics->num_clients].source = id;
+        metrics->clients[metrics->num_clients].since_ns = bmi270_stats_now();
+        metrics->num_clients++;
+
+        if (metrics->sweep < 0)
+            metrics->sweep = bmi270_loop_add_timer(loop, (uint64_t)METRICS_SWEEP_MS * 1000000, on_sweep, metrics);
+    }
+}
+
+static int listen_socket(struct bmi270_metrics *metrics, struct bmi270_loop *loop, int fd, const struct sockaddr *address, socklen_t address_len)
+{
+    int id;
+
+    if (bind(fd, address, address_len) < 0 || listen(fd, 8) < 0)
+        id = -errno;
+    else
+        id = bmi270_loop_add_fd(loop, fd, EPOLLIN, on_connect, metrics);
+
+    if (id < 0)
+    {
+        close(fd);
+        return id;
+    }
+
+    loop->sources[id].owned = 1;
+    metrics->loop = loop;
+
+    return id;
+}
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+void bmi270_metrics_init(struct bmi270_metrics *metrics)
+{
+    memset(metrics, 0, sizeof(*metrics));
+    metrics->sweep = -1;
+}
+
+struct bmi270_metrics_device *bmi270_metrics_add(struct bmi270_metrics *metrics, const char *label, struct bmi270 *sensor, struct bmi270_recovery *recovery, uint64_t period_ns)
+{
+    struct bmi270_metrics_device *device;
+
+    if (metrics->num_devices == METRICS_MAX_DEVICES)
+        return NULL;
+
+    device = &metrics->devices[metrics->num_devices++];
+    memset(device, 0, sizeof(*device));
+    snprintf(device->label, sizeof(device->label), "%s", label);
+    device->sensor = sensor;
+    device->recovery = recovery;
+    device->period_ns = period_ns;
+
+    return device;
+}
+
+void bmi270_metrics_loop(struct bmi270_metrics_device *device, uint64_t now_ns)
+{
+    uint64_t last = device->last_loop_ns, deviation;
+    int bucket;
+
+    device->last_loop_ns = now_ns;
+    atomic_fetch_add_explicit(&device->loops, 1, memory_order_relaxed);
+
+    if (last == 0)
+        return;
+
+    deviation = now_ns - last > device->period_ns ? now_ns - last - device->period_ns : device->period_ns - (now_ns - last);
+    bucket = deviation ? 63 - __builtin_clzll(deviation) : 0;
+
+    if (bucket >= METRICS_NUM_BUCKETS)
+        bucket = METRICS_NUM_BUCKETS - 1;
+
+    atomic_fetch_add_explicit(&device->jitter[bucket], 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&device->jitter_sum, deviation, memory_order_relaxed);
+}
+
+uint64_t bmi270_metrics_jitter(const struct bmi270_metrics_device *device, double p)
+{
+    uint64_t counts[METRICS_NUM_BUCKETS];
+    uint64_t total = 0, rank, seen = 0;
+
+    for (int i = 0; i < METRICS_NUM_BUCKETS; i++)
+    {
+        counts[i] = atomic_load_explicit(&device->jitter[i], memory_order_relaxed);
+        total += counts[i];
+    }
+
+    if (total == 0)
+        return 0;
+
+    rank = (uint64_t)(p * (double)total);
+
+    if (rank >= total)
+        rank = total - 1;
+
+    for (int i = 0; i < METRICS_NUM_BUCKETS; i++)
+    {
+        seen += counts[i];
+
+        if (seen > rank)
+            return 2ULL << i;
+    }
+
+    return 2ULL << (METRICS_NUM_BUCKETS - 1);
+}
+
+/* Escape a label value for the text format: backslash, double quote and newline */
+static void escape_label(char *out, const char *label)
+{
+    for (; *label; label++)
+    {
+        if (*label == '\\' || *label == '"')
+            *out++ = '\\';
+
+        if (*label == '\n')
+        {
+            *out++ = '\\';
+            *out++ = 'n';
+        }
+        else
+            *out++ = *label;
+    }
+
+    *out = '\0';
+}
+
+void bmi270_metrics_write(struct bmi270_metrics *metrics, FILE *out)
+{
+    static const double quantiles[] = {0.5, 0.9, 0.99, 1.0};
+    char labels[METRICS_MAX_DEVICES][2 * METRICS_LABEL_LEN];
+    uint64_t value;
+
+    for (int i = 0; i < metrics->num_devices; i++)
+    {
+        escape_label(labels[i], metrics->devices[i].label);
+    }
+
+    for (size_t m = 0; m < sizeof(metrics_table) / sizeof(metrics_table[0]); m++)
+    {
+        const struct metric *metric = &metrics_table[m];
+
+        fprintf(out, "# HELP %s %s\n# TYPE %s %s\n", metric->name, metric->help, metric->name, metric->type);
+
+        for (int i = 0; i < metrics->num_devices; i++)
+        {
+            if (metric->value(&metrics->devices[i], &value))
+                fprintf(out, "%s{device=\"%s\"} %llu\n", metric->name, labels[i], (unsigned long long)value);
+        }
+    }
+
+    fprintf(out, "# HELP bmi270_loop_jitter_seconds Deviation of the loop interval from its period\n# TYPE bmi270_loop_jitter_seconds summary\n");
+
+    for (int i = 0; i < metrics->num_devices; i++)
+    {
+        const struct bmi270_metrics_device *device = &metrics->devices[i];
+        uint64_t count = 0;
+
+        for (int b = 0; b < METRICS_NUM_BUCKETS; b++)
+        {
+            count += atomic_load_explicit(&device->jitter[b], memory_order_relaxed);
+        }
+
+        for (size_t q = 0; q < sizeof(quantiles) / sizeof(quantiles[0]); q++)
+        {
+            fprintf(out, "bmi270_loop_jitter_seconds{device=\"%s\",quantile=\"%g\"} %.9f\n", labels[i], quantiles[q], bmi270_metrics_jitter(device, quantiles[q]) / 1e9);
+        }
+
+        fprintf(out, "bmi270_loop_jitter_seconds_sum{device=\"%s\"} %.9f\n", labels[i], atomic_load_explicit(&device->jitter_sum, memory_order_relaxed) / 1e9);
+        fprintf(out, "bmi270_loop_jitter_seconds_count{device=\"%s\"} %llu\n", labels[i], (unsigned long long)count);
+    }
+
+    fprintf(out, "# HELP bmi270_scrapes_total Metrics requests served\n# TYPE bmi270_scrapes_total counter\nbmi270_scrapes_total %llu\n",
+            (unsigned long long)atomic_load_explicit(&metrics->scrapes, memory_order_relaxed));
+}
+
+int bmi270_metrics_listen_tcp(struct bmi270_metrics *metrics, struct bmi270_loop *loop, uint16_t port)
+{
+    struct sockaddr_in address = {.sin_family = AF_INET, .sin_port = htons(port), .sin_addr.s_addr = htonl(INADDR_ANY)};
+    int fd, enable = 1;
+
+    if ((fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0)) < 0)
+        return -errno;
+
+    // Restarts must not wait for TIME_WAIT connections of the last scrape
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+
+    return listen_socket(metrics, loop, fd, (struct sockaddr *)&address, sizeof(address));
+}
+
+int bmi270_metrics_listen_unix(struct bmi270_metrics *metrics, struct bmi270_loop *loop, const char *path)
+{
+    struct sockaddr_un address = {.sun_family = AF_UNIX};
+    int fd;
+
+    if (strlen(path) >= sizeof(address.sun_path))
+        return -ENAMETOOLONG;
+
+    strcpy(address.sun_path, path);
+    unlink(path);
+
+    if ((fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0)) < 0)
+        return -errno;
+
+    return listen_socket(metrics, loop, fd, (struct sockaddr *)&address, sizeof(address));
+}
@@ -0,0 +1,146 @@
+#pragma once
+
+#ifndef BMI270_METRICS_H
+#define BMI270_METRICS_H
+
+#include <stdatomic.h>
+#include <stdio.h>
+
+#include "bmi270.h"
+#include "bmi270_loop.h"
+#include "bmi270_recovery.h"
+
+/* ----------------------------------------------------
+                    DEFINITIONS
+-----------------------------------------------------*/
+
+/*
+ * Prometheus text exposition of per-device counters. The acquisition path only
+ * does relaxed atomic increments, rendering reads the counters from the loop
+ * thread. Bus transactions, errors and retries come from the sensor's
+ * bmi270_stats (if attached), recoveries and config uploads from its recovery
+ * state machine (if given).
+ *
+ * The endpoint is a loop source: a TCP port or a Unix socket answering every
+ * request with the metrics, e.g.
+ *     curl http://localhost:9270/metrics
+ *     curl --unix-socket /run/bmi270.sock http://localhost/metrics
+ *
+ * Every connection takes a loop source until it is answered: at most
+ * METRICS_MAX_CLIENTS are open at once, further ones are closed right away, and
+ * a timer (only while clients are connected) closes those that sent no request
+ * within METRICS_TIMEOUT_MS.
+ */
+
+#define METRICS_MAX_DEVICES 16
+#define METRICS_LABEL_LEN   32
+#define METRICS_NUM_BUCKETS 32                 // Jitter histogram: bucket i counts [2^i, 2^(i+1)) ns
+#define METRICS_REQUEST_LEN 1024               // Request bytes read (and ignored) per connection
+#define METRICS_MAX_CLIENTS 4                  // Connections open at once
+#define METRICS_TIMEOUT_MS  5000               // Connections without a request are closed after this
+#define METRICS_SWEEP_MS    1000               // Check for idle connections this often
+
+struct bmi270_metrics_device
+{
+    /* Value of the device label */
+    char label[METRICS_LABEL_LEN];
+
+    /* Sensor (bus statistics, error count) and recovery (optional) */
+    struct bmi270 *sensor;
+    struct bmi270_recovery *recovery;
+
+    /* Nominal loop period (ns) */
+    uint64_t period_ns;
+
+    /* Samples delivered, failed reads and samples dropped downstream (queue or network full) */
+    atomic_uint_fast64_t samples;
+    atomic_uint_fast64_t read_failures;
+    atomic_uint_fast64_t dropped;
+
+    /* Configuration reloads (e.g. on SIGHUP) */
+    atomic_uint_fast64_t config_reloads;
+
+    /* Loop iterations, deviation of their interval from period_ns: histogram and sum (ns) */
+    atomic_uint_fast64_t loops;
+    atomic_uint_fast64_t jitter[METRICS_NUM_BUCKETS];
+    atomic_uint_fast64_t jitter_sum;
+
+    /* Time of the previous loop iteration (written by the acquisition thread only) */
+    uint64_t last_loop_ns;
+};
+
+struct bmi270_metrics_client
+{
+    /* Loop source of the connection and when it was accepted (bmi270_stats_now) */
+    int source;
+    uint64_t since_ns;
+};
+
+struct bmi270_metrics
+{
+    /* Devices */
+    struct bmi270_metrics_device devices[METRICS_MAX_DEVICES];
+    uint8_t num_devices;
+
+    /* Scrapes served */
+    atomic_uint_fast64_t scrapes;
+
+    /* Loop serving the endpoint */
+    struct bmi270_loop *loop;
+
+    /* Open connections and the timer closing idle ones (-1 = not running) */
+    struct bmi270_metrics_client clients[METRICS_MAX_CLIENTS];
+    uint8_t num_clients;
+    int sweep;
+};
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+/* Initialize an empty registry */
+void bmi270_metrics_init(struct bmi270_metrics *metrics);
+
+/* Add a device, recovery may be NULL - returns the device or NULL if full */
+struct bmi270_metrics_device *bmi270_metrics_add(struct bmi270_metrics *metrics, const char *label, struct bmi270 *sensor, struct bmi270_recovery *recovery, uint64_t period_ns);
+
+/* Count one delivered sample */
+static inline void bmi270_metrics_sample(struct bmi270_metrics_device *device)
+{
+    atomic_fetch_add_explicit(&device->samples, 1, memory_order_relaxed);
+}
+
+/* Count one failed read */
+static inline void bmi270_metrics_read_failure(struct bmi270_metrics_device *device)
+{
+    atomic_fetch_add_explicit(&device->read_failures, 1, memory_order_relaxed);
+}
+
+/* Count samples dropped downstream */
+static inline void bmi270_metrics_drop(struct bmi270_metrics_device *device, uint32_t count)
+{
+    atomic_fetch_add_explicit(&device->dropped, count, memory_order_relaxed);
+}
+
+/* Count one configuration reload */
+static inline void bmi270_metrics_reload(struct bmi270_metrics_device *device)
+{
+    atomic_fetch_add_explicit(&device->config_reloads, 1, memory_order_relaxed);
+}
+
+/* Record one loop iteration at now_ns, the interval to the previous one goes into the jitter histogram */
+void bmi270_metrics_loop(struct bmi270_metrics_device *device, uint64_t now_ns);
+
+/* Loop jitter percentile (0.0 - 1.0) in ns (upper bucket bound) */
+uint64_t bmi270_metrics_jitter(const struct bmi270_metrics_device *device, double p);
+
+/* Write all metrics in Prometheus text format */
+void bmi270_metrics_write(struct bmi270_metrics *metrics, FILE *out);
+
+/* Serve metrics over HTTP on a TCP port of all interfaces - returns the loop source id */
+int bmi270_metrics_listen_tcp(struct bmi270_metrics *metrics, struct bmi270_loop *loop, uint16_t port);
+
+/* Serve metrics over HTTP on a Unix socket (an existing socket file is replaced) - returns the loop source id */
+int bmi270_metrics_listen_unix(struct bmi270_metrics *metrics, struct bmi270_loop *loop, const char *path);
+
+#endif // BMI270_METRICS_H
@@ -0,0 +1,162 @@
+#include <errno.h>
+#include <math.h>
+#include <stdlib.h>
+
+#include "bmi270_pool.h"
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+void bmi270_pool_config(struct bmi270_pool_config *config, struct bmi270 *const *sensors, uint16_t num_sensors, uint32_t batch_period_us, uint32_t num_batches)
+{
+    double odr_hz = 0.0;
+
+    for (int i = 0; i < num_sensors; i++)
+    {
+        if (sensors[i]->acc_odr > odr_hz)
+            odr_hz = sensors[i]->acc_odr;
+
+        if (sensors[i]->gyr_odr > odr_hz)
+            odr_hz = sensors[i]->gyr_odr;
+    }
+
+    // Rounded up: fractional ODRs must not undercount the batch capacity
+    config->num_devices = num_sensors;
+    config->odr_hz = (uint32_t)ceil(odr_hz);
+    config->batch_period_us = batch_period_us;
+    config->num_batches = num_batches;
+}
+
+static uint32_t batch_capacity(const struct bmi270_pool_config *config)
+{
+    // Round up: a batch never splits a period's worth of samples
+    uint64_t per_device = ((uint64_t)config->odr_hz * config->batch_period_us + 999999) / 1000000;
+
+    if (per_device == 0)
+        per_device = 1;
+
+    return (uint32_t)(per_device * config->num_devices);
+}
+
+size_t bmi270_pool_arena_size(const struct bmi270_pool_config *config)
+{
+    return (size_t)config->num_batches * (sizeof(struct bmi270_batch) + batch_capacity(config) * sizeof(struct bmi270_sample));
+}
+
+int bmi270_pool_init(struct bmi270_pool *pool, const struct bmi270_pool_config *config, void *arena, size_t arena_size)
+{
+    size_t needed = bmi270_pool_arena_size(config);
+
+    if (config->num_batches == 0 || config->num_batches > POOL_MAX_BATCHES || config->num_devices == 0)
+        return -EINVAL;
+
+    pool->arena = NULL;
+
+    if (arena == NULL)
+    {
+        // Startup only: the steady state never allocates
+        if ((arena = pool->arena = malloc(needed)) == NULL)
+            return -ENOMEM;
+    }
+    else if (arena_size < needed)
+    {
+        return -ENOSPC;
+    }
+
+    // Batch headers first, samples after them: both naturally aligned
+    pool->batches = arena;
+    pool->samples = (struct bmi270_sample *)(pool->batches + config->num_batches);
+    pool->num_batches = config->num_batches;
+    pool->batch_capacity = batch_capacity(config);
+
+    for (uint32_t i = 0; i < pool->num_batches; i++)
+    {
+        struct bmi270_batch *batch = &pool->batches[i];
+
+        batch->pool = pool;
+        batch->index = i;
+        atomic_init(&batch->refs, 0);
+        batch->count = 0;
+        batch->capacity = pool->batch_capacity;
+        batch->seq = 0;
+        batch->samples = pool->samples + (size_t)i * pool->batch_capacity;
+
+        atomic_init(&pool->next[i], i + 1 < pool->num_batches ? i + 1 : POOL_NONE);
+    }
+
+    atomic_init(&pool->free_head, 0);
+    atomic_init(&pool->acquired, 0);
+    atomic_init(&pool->exhausted, 0);
+
+    return 0;
+}
+
+void bmi270_pool_destroy(struct bmi270_pool *pool)
+{
+    free(pool->arena);
+    pool->arena = NULL;
+    pool->batches = NULL;
+    pool->num_batches = 0;
+}
+
+struct bmi270_batch *bmi270_pool_acquire(struct bmi270_pool *pool)
+{
+    uint64_t head = atomic_load_explicit(&pool->free_head, memory_order_acquire);
+    uint64_t next;
+    uint32_t index;
+
+    // Treiber stack, the tag in the upper half rules out ABA
+    do
+    {
+        index = (uint32_t)head;
+
+        if (index == POOL_NONE)
+        {
+            atomic_fetch_add_explicit(&pool->exhausted, 1, memory_order_relaxed);
+            return NULL;
+        }
+
+        next = ((head >> 32) + 1) << 32 | atomic_load_explicit(&pool->next[index], memory_order_relaxed);
+    } while (!atomic_compare_exchange_weak_explicit(&pool->free_head, &head, next, memory_order_acquire, memory_order_acquire));
+
+    struct bmi270_batch *batch = &pool->batches[index];
+
+    atomic_store_explicit(&batch->refs, 1, memory_order_relaxed);
+    batch->count = 0;
+    batch->seq = atomic_fetch_add_explicit(&pool->acquired, 1, memory_order_relaxed);
+
+    return batch;
+}
+
+int bmi270_batch_push(struct bmi270_batch *batch, const struct bmi270_sample *sample)
+{
+    if (batch->count == batch->capacity)
+        return -ENOSPC;
+
+    batch->samples[batch->count++] = *sample;
+
+    return 0;
+}
+
+void bmi270_batch_ref(struct bmi270_batch *batch)
+{
+    atomic_fetch_add_explicit(&batch->refs, 1, memory_order_relaxed);
+}
+
+void bmi270_batch_unref(struct bmi270_batch *batch)
+{
+    struct bmi270_pool *pool = batch->pool;
+    uint64_t head, next;
+
+    if (atomic_fetch_sub_explicit(&batch->refs, 1, memory_order_acq_rel) != 1)
+        return;
+
+    head = atomic_load_explicit(&pool->free_head, memory_order_relaxed);
+
+    do
+    {
+        atomic_store_explicit(&pool->next[batch->index], (uint32_t)head, memory_order_relaxed);
+        next = ((head >> 32) + 1) << 32 | batch->index;
+    } while (!atomic_compare_exchange_weak_explicit(&pool->free_head, &head, next, memory_order_release, memory_order_relaxed));
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#ifndef BMI270_POOL_H
+#define BMI270_POOL_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+
+#include "bmi270.h"
+
+/* ----------------------------------------------------
+                    DEFINITIONS
+-----------------------------------------------------*/
+
+#define POOL_MAX_BATCHES    1024               // Batches per pool
+#define POOL_NONE           UINT32_C(0xFFFFFFFF)
+
+struct bmi270_pool;
+
+/* Fixed-capacity sample batch, shared by sinks through its reference count */
+struct bmi270_batch
+{
+    /* Owning pool and slot */
+    struct bmi270_pool *pool;
+    uint32_t index;
+
+    /* References held, returned to the pool at zero */
+    atomic_uint refs;
+
+    /* Samples in use / available */
+    uint32_t count;
+    uint32_t capacity;
+
+    /* Sequence number, assigned on acquire */
+    uint64_t seq;
+
+    /* Sample storage inside the pool arena */
+    struct bmi270_sample *samples;
+};
+
+struct bmi270_pool_config
+{
+    /* Sensors feeding the pool */
+    uint16_t num_devices;
+
+    /* Highest sample rate of one sensor (Hz, rounded up) */
+    uint32_t odr_hz;
+
+    /* Time covered by one batch (us) */
+    uint32_t batch_period_us;
+
+    /* Batches in flight: filled, queued and held by the slowest sink */
+    uint32_t num_batches;
+};
+
+struct bmi270_pool
+{
+    /* Batch headers and sample storage */
+    struct bmi270_batch *batches;
+    struct bmi270_sample *samples;
+
+    /* Arena allocated by bmi270_pool_init (NULL if provided by the caller) */
+    void *arena;
+
+    /* Free list: tagged head (tag << 32 | index), next index per batch */
+    atomic_uint_fast64_t free_head;
+    atomic_uint next[POOL_MAX_BATCHES];
+
+    uint32_t num_batches;
+    uint32_t batch_capacity;
+
+    /* Acquired batches, and acquires that found the pool empty */
+    atomic_uint_fast64_t acquired;
+    atomic_uint_fast64_t exhausted;
+};
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+/* Size a pool for the current ODRs of the sensors: batch_period_us per batch, num_batches in flight */
+void bmi270_pool_config(struct bmi270_pool_config *config, struct bmi270 *const *sensors, uint16_t num_sensors, uint32_t batch_period_us, uint32_t num_batches);
+
+/* Bytes of arena needed for config */
+size_t bmi270_pool_arena_size(const struct bmi270_pool_config *config);
+
+/* Initialize the pool in arena (arena_size >= bmi270_pool_arena_size), or allocate it once if arena is NULL */
+int bmi270_pool_init(struct bmi270_pool *pool, const struct bmi270_pool_config *config, void *arena, size_t arena_size);
+
+/* Free an arena allocated by bmi270_pool_init - all batches must be released */
+void bmi270_pool_destroy(struct bmi270_pool *pool);
+
+/* Take an empty batch holding one reference - NULL if the pool is exhausted (lock-free, no allocation) */
+struct bmi270_batch *bmi270_pool_acquire(struct bmi270_pool *pool);
+
+/* Append a sample - returns -ENOSPC if the batch is full */
+int bmi270_batch_push(struct bmi270_batch *batch, const struct bmi270_sample *sample);
+
+/* Add a reference, e.g. before handing the batch to another sink */
+void bmi270_batch_ref(struct bmi270_batch *batch);
+
+/* Drop a reference, the last one returns the batch to its pool */
+void bmi270_batch_unref(struct bmi270_batch *batch);
+
+#endif // BMI270_POOL_H
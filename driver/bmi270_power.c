@@ -0,0 +1,111 @@
+#include <errno.h>
+#include <unistd.h>
+
+#include "bmi270_power.h"
+#include "bmi270_regs.h"
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+void bmi270_power_defaults(struct bmi270_power_config *config)
+{
+    config->acc_odr = ACC_ODR_25;
+    config->averaging = ACC_BWP_AVG4;
+    config->adv_power_save = 1;
+    config->batch_us = 10000000;
+}
+
+uint32_t bmi270_power_batch_bytes(const struct bmi270_power_config *config)
+{
+    return (uint32_t)(config->batch_us / 1e6 * ODR_HZ(config->acc_odr)) * POWER_FRAME_ACC;
+}
+
+int bmi270_power_apply(struct bmi270 *sensor, const struct bmi270_power_config *config)
+{
+    struct bmi270_power_estimate estimate;
+    uint32_t batch = bmi270_power_batch_bytes(config);
+    uint8_t regs[4];
+    int result;
+
+    if (config->acc_odr < ACC_ODR_0_78 || config->acc_odr > ACC_ODR_400 || config->averaging > ACC_BWP_AVG128 ||
+        ODR_HZ(config->acc_odr) * (1u << config->averaging) > POWER_SAMPLE_HZ)
+    {
+        bmi270_log(BMI270_LOG_ERROR, "0x%X --> Low power: ODR 0.78 - 400 Hz and ODR x averaging <= %.0f Hz", sensor->i2c_addr, POWER_SAMPLE_HZ);
+        return -EINVAL;
+    }
+
+    if (batch > FIFO_SIZE)
+    {
+        bmi270_log(BMI270_LOG_ERROR, "0x%X --> Low power: a %u us batch (%u bytes) does not fit into the FIFO", sensor->i2c_addr, config->batch_us, batch);
+        return -EINVAL;
+    }
+
+    regs[0] = FIELD_MASK(PWR_CTRL_ACC_EN);
+    regs[1] = FIELD_PREP(ACC_CONF_BWP, config->averaging) | config->acc_odr;
+    regs[2] = 0;
+    regs[3] = FIELD_MASK(PWR_CONF_FIFO_RD) | (config->adv_power_save ? FIELD_MASK(PWR_CONF_ADV_PS) : 0);
+
+    // Configuration changes need advanced power save disabled
+    if ((result = write_register(sensor, PWR_CONF, FIELD_MASK(PWR_CONF_FIFO_RD))) < 0)
+        return result;
+
+    usleep(450);
+
+    // Acc-only FIFO, flushed: frames of the previous configuration would break up the batch
+    if ((result = write_register(sensor, PWR_CTRL, regs[0])) < 0 ||
+        (result = write_register(sensor, ACC_CONF, regs[1])) < 0 ||
+        (result = update_register(sensor, FIELD_REG(FIFO_SENSORS_EN), FIELD_MASK(FIFO_SENSORS_EN) | FIELD_MASK(FIFO_HEADER_EN),
+                                  FIELD_MASK(FIFO_ACC_EN) | FIELD_MASK(FIFO_HEADER_EN))) < 0 ||
+        (result = set_fifo_watermark(sensor, (uint16_t)batch)) < 0 ||
+        (result = write_register(sensor, CMD, FIFO_FLUSH)) < 0 ||
+        (result = write_register(sensor, PWR_CONF, regs[3])) < 0)
+        return result;
+
+    sensor->acc_odr = ODR_HZ(config->acc_odr);
+    sensor->gyr_odr = 0;
+
+    bmi270_power_model(regs, &estimate);
+    bmi270_log(BMI270_LOG_INFO, "0x%X --> Low power: %.2f Hz, %u samples averaged, %u byte batches, ~%.1f uA", sensor->i2c_addr,
+               ODR_HZ(config->acc_odr), 1u << config->averaging, batch, estimate.total_ua);
+    return 0;
+}
+
+void bmi270_power_model(const uint8_t regs[4], struct bmi270_power_estimate *estimate)
+{
+    uint8_t acc_odr = FIELD_GET(ACC_CONF_ODR, regs[1]);
+    double duty = 0.0;
+
+    if (regs[0] & FIELD_MASK(PWR_CTRL_ACC_EN))
+    {
+        duty = 1.0;
+
+        // Undersampling: on for the averaged samples only
+        if (!(regs[1] & FIELD_MASK(ACC_CONF_PERF)) && acc_odr > 0)
+            duty = ODR_HZ(acc_odr) * (1u << FIELD_GET(ACC_CONF_BWP, regs[1])) / POWER_SAMPLE_HZ;
+
+        if (duty > 1.0)
+            duty = 1.0;
+    }
+
+    estimate->acc_duty = duty;
+    estimate->acc_ua = POWER_ACC_UA * duty;
+    estimate->gyr_ua = !(regs[0] & FIELD_MASK(PWR_CTRL_GYR_EN)) ? 0.0 : regs[2] & FIELD_MASK(GYR_CONF_PERF) ? POWER_GYR_UA : POWER_GYR_OPT_UA;
+    estimate->base_ua = regs[3] & FIELD_MASK(PWR_CONF_ADV_PS) ? POWER_SUSPEND_UA : POWER_AWAKE_UA;
+    estimate->total_ua = estimate->acc_ua + estimate->gyr_ua + estimate->base_ua;
+}
+
+int bmi270_power_estimate(struct bmi270 *sensor, struct bmi270_power_estimate *estimate)
+{
+    uint8_t regs[4];
+    int result;
+
+    if ((result = read_register(sensor, PWR_CTRL, &regs[0])) < 0 ||
+        (result = read_register(sensor, ACC_CONF, &regs[1])) < 0 ||
+        (result = read_register(sensor, GYR_CONF, &regs[2])) < 0 ||
+        (result = read_register(sensor, PWR_CONF, &regs[3])) < 0)
+        return result;
+
+    bmi270_power_model(regs, estimate);
+    return 0;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#ifndef BMI270_POWER_H
+#define BMI270_POWER_H
+
+#include "bmi270.h"
+
+/* ----------------------------------------------------
+                    DEFINITIONS
+-----------------------------------------------------*/
+
+/*
+ * Duty-cycled acquisition: the accelerometer alone in undersampling mode
+ * (filter performance off) averages a few samples per output sample and
+ * sleeps in between, advanced power save stops the clocks between
+ * measurements and the FIFO collects batches of several seconds, so the host
+ * can sleep as long and read them in one burst.
+ *
+ * The current estimate is a model of datasheet typicals: each averaged sample
+ * costs the continuous accelerometer current for one sample period at
+ * POWER_SAMPLE_HZ, on top of the suspend or awake base current. Good for a
+ * battery budget, not a substitute for measuring the board.
+ */
+
+#define POWER_ACC_UA        180.0              // Accelerometer, continuous (uA)
+#define POWER_GYR_UA        485.0              // Gyroscope, filter performance mode (uA, full operation: 685 uA)
+#define POWER_GYR_OPT_UA    385.0              // Gyroscope, power optimized (uA)
+#define POWER_SUSPEND_UA    3.5                // Base current with advanced power save (uA)
+#define POWER_AWAKE_UA      20.0               // Base current without advanced power save (uA)
+#define POWER_SAMPLE_HZ     1600.0             // Averaged samples are taken at this rate
+
+#define POWER_FRAME_ACC     7                  // Header + acc frame (bytes)
+
+struct bmi270_power_config
+{
+    /* Accelerometer ODR (ACC_ODR_0_78 - ACC_ODR_400) */
+    uint8_t acc_odr;
+
+    /* Samples averaged per output sample (ACC_BWP_AVG1 - ACC_BWP_AVG128), ODR x averaging <= POWER_SAMPLE_HZ */
+    uint8_t averaging;
+
+    /* Advanced power save between measurements (0, 1) */
+    uint8_t adv_power_save;
+
+    /* FIFO batch the host sleeps for: watermark at this many us of frames (0 = no watermark) */
+    uint32_t batch_us;
+};
+
+struct bmi270_power_estimate
+{
+    /* Sensor current (uA) and its accelerometer, gyroscope and base shares */
+    double total_ua;
+    double acc_ua;
+    double gyr_ua;
+    double base_ua;
+
+    /* Accelerometer on-time fraction (1 = continuous) */
+    double acc_duty;
+};
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+/* Fill config with defaults: 25 Hz, 4 samples averaged, advanced power save, 10 s batches */
+void bmi270_power_defaults(struct bmi270_power_config *config);
+
+/* Switch to the low power profile: accelerometer only, undersampling, header mode acc-only FIFO flushed, watermark set */
+int bmi270_power_apply(struct bmi270 *sensor, const struct bmi270_power_config *config);
+
+/* FIFO bytes of one batch (header mode frames) */
+uint32_t bmi270_power_batch_bytes(const struct bmi270_power_config *config);
+
+/* Estimate the current draw from PWR_CTRL, ACC_CONF, GYR_CONF and PWR_CONF values */
+void bmi270_power_model(const uint8_t regs[4], struct bmi270_power_estimate *estimate);
+
+/* Estimate the current draw of the sensor's configured mode (reads the registers) */
+int bmi270_power_estimate(struct bmi270 *sensor, struct bmi270_power_estimate *estimate);
+
+#endif // BMI270_POWER_H
@@ -0,0 +1,281 @@
+#include <stddef.h>
+
+#include "bmi270_recovery.h"
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+static const uint8_t snapshot_regs[RECOVERY_NUM_REGS] = {
+    ACC_CONF, ACC_RANGE, GYR_CONF, GYR_RANGE, FIFO_CONFIG_0, FIFO_CONFIG_1, INT1_IO_CTRL, INT_MAP_DATA, PWR_CTRL, PWR_CONF};
+
+void bmi270_recovery_defaults(struct bmi270_recovery_config *config)
+{
+    config->error_threshold = 3;
+    config->max_retries = 1;
+    config->chunks_per_step = 8;
+    config->backoff_min_us = 1000;
+    config->backoff_max_us = 1000000;
+    config->health_interval_us = 1000000;
+    config->restore = NULL;
+    config->ctx = NULL;
+}
+
+int bmi270_recovery_init(struct bmi270_recovery *rec, struct bmi270 *sensor, const struct bmi270_recovery_config *config, uint64_t now_us)
+{
+    rec->sensor = sensor;
+    rec->config = *config;
+    rec->state = RECOVERY_OK;
+    rec->consecutive_errors = 0;
+    rec->chunk = 0;
+    rec->backoff_us = config->backoff_min_us;
+    rec->next_us = now_us + config->health_interval_us;
+    rec->recoveries = 0;
+    rec->uploads = 0;
+    rec->failed_uploads = 0;
+
+    if (rec->config.chunks_per_step == 0)
+        rec->config.chunks_per_step = 1;
+
+    sensor->max_retries = config->max_retries;
+
+    return bmi270_recovery_snapshot(rec);
+}
+
+int bmi270_recovery_snapshot(struct bmi270_recovery *rec)
+{
+    uint8_t values[RECOVERY_NUM_REGS];
+    int result;
+
+    // PWR_CTRL and PWR_CONF last: sensors start after their configuration is back
+    for (int i = 0; i < RECOVERY_NUM_REGS; i++)
+    {
+        rec->regs[i] = snapshot_regs[i];
+
+        if ((result = read_register(rec->sensor, rec->regs[i], &values[i])) < 0)
+            return result;
+    }
+
+    // A failed read keeps the previous snapshot whole
+    for (int i = 0; i < RECOVERY_NUM_REGS; i++)
+    {
+        rec->values[i] = values[i];
+    }
+
+    return 0;
+}
+
+static void enter(struct bmi270_recovery *rec, uint8_t state, uint64_t next_us)
+{
+    rec->state = state;
+    rec->next_us = next_us;
+}
+
+static void backoff(struct bmi270_recovery *rec, uint64_t now_us)
+{
+    enter(rec, RECOVERY_BACKOFF, now_us + rec->backoff_us);
+
+    rec->backoff_us *= 2;
+
+    if (rec->backoff_us > rec->config.backoff_max_us)
+        rec->backoff_us = rec->config.backoff_max_us;
+}
+
+void bmi270_recovery_report(struct bmi270_recovery *rec, int result, uint64_t now_us)
+{
+    if (rec->state != RECOVERY_OK)
+        return;
+
+    if (result >= 0)
+    {
+        rec->consecutive_errors = 0;
+        return;
+    }
+
+    if (++rec->consecutive_errors >= rec->config.error_threshold)
+    {
+        bmi270_log(BMI270_LOG_WARN, "0x%X --> %d failed reads, recovering", rec->sensor->i2c_addr, rec->consecutive_errors);
+
+        // No retries while recovering: every step stays one transaction per action
+        rec->sensor->max_retries = 0;
+        rec->backoff_us = rec->config.backoff_min_us;
+        enter(rec, RECOVERY_PROBE, now_us);
+    }
+}
+
+static void probe(struct bmi270_recovery *rec, uint64_t now_us)
+{
+    struct bmi270 *sensor = rec->sensor;
+    uint8_t chip_id, status;
+
+    if (read_register(sensor, CHIP_ID_ADDRESS, &chip_id) < 0 || chip_id != BMI270_CHIP_ID)
+    {
+        backoff(rec, now_us);
+        return;
+    }
+
+    if (read_register(sensor, INTERNAL_STATUS, &status) < 0)
+    {
+        backoff(rec, now_us);
+        return;
+    }
+
+    sensor->internal_status = status;
+
+    if ((status & STATUS_MSG_MASK) == STATUS_INIT_OK)
+    {
+        // Bus glitch only, the configuration survived
+        enter(rec, RECOVERY_RESTORE, now_us);
+    }
+    else if ((status & STATUS_MSG_MASK) == STATUS_NOT_INIT)
+    {
+        // Power loss or soft reset: config file is gone
+        if (load_config_start(sensor) < 0)
+        {
+            backoff(rec, now_us);
+            return;
+        }
+
+        rec->chunk = 0;
+        rec->uploads++;
+        enter(rec, RECOVERY_UPLOAD, now_us);
+    }
+    else
+    {
+        // Initialization error: only a soft reset allows a new upload
+        if (write_register(sensor, CMD, SOFT_RESET) < 0)
+        {
+            backoff(rec, now_us);
+            return;
+        }
+
+        if (rec->failed_uploads++ == 0)
+        {
+            enter(rec, RECOVERY_RESET, now_us + 2000);
+            return;
+        }
+
+        // Again: every cycle uploads the whole config file, back off like on bus errors (at least the reset time)
+        bmi270_log(BMI270_LOG_WARN, "0x%X --> Initialization error %u times in a row, backing off %u us", sensor->i2c_addr, rec->failed_uploads, rec->backoff_us);
+        backoff(rec, now_us);
+
+        if (rec->next_us < now_us + 2000)
+            rec->next_us = now_us + 2000;
+    }
+}
+
+static void upload(struct bmi270_recovery *rec, uint64_t now_us)
+{
+    for (uint16_t i = 0; i < rec->config.chunks_per_step && rec->chunk < CONFIG_NUM_CHUNKS; i++)
+    {
+        if (load_config_chunk(rec->sensor, rec->chunk) < 0)
+        {
+            backoff(rec, now_us);
+            return;
+        }
+
+        rec->chunk++;
+    }
+
+    if (rec->chunk < CONFIG_NUM_CHUNKS)
+        return;
+
+    if (load_config_finish(rec->sensor) < 0)
+    {
+        backoff(rec, now_us);
+        return;
+    }
+
+    enter(rec, RECOVERY_INIT_WAIT, now_us + 20000);
+}
+
+static void restore(struct bmi270_recovery *rec, uint64_t now_us)
+{
+    struct bmi270 *sensor = rec->sensor;
+
+    for (int i = 0; i < RECOVERY_NUM_REGS; i++)
+    {
+        if (write_register(sensor, rec->regs[i], rec->values[i]) < 0)
+        {
+            backoff(rec, now_us);
+            return;
+        }
+    }
+
+    if (rec->config.restore && rec->config.restore(sensor, rec->config.ctx) < 0)
+    {
+        backoff(rec, now_us);
+        return;
+    }
+
+    sensor->max_retries = rec->config.max_retries;
+    rec->consecutive_errors = 0;
+    rec->backoff_us = rec->config.backoff_min_us;
+    rec->failed_uploads = 0;
+    rec->recoveries++;
+    enter(rec, RECOVERY_OK, now_us + rec->config.health_interval_us);
+
+    bmi270_log(BMI270_LOG_INFO, "0x%X --> Recovered (%u recoveries, %u config uploads)", sensor->i2c_addr, rec->recoveries, rec->uploads);
+}
+
+static void health_check(struct bmi270_recovery *rec, uint64_t now_us)
+{
+    struct bmi270 *sensor = rec->sensor;
+    uint8_t status;
+
+    rec->next_us = now_us + rec->config.health_interval_us;
+
+    if (read_register(sensor, INTERNAL_STATUS, &status) < 0)
+    {
+        bmi270_recovery_report(rec, -1, now_us);
+        return;
+    }
+
+    // A reset sensor streams zeros without any bus error
+    if ((status & STATUS_MSG_MASK) != STATUS_INIT_OK)
+    {
+        bmi270_log(BMI270_LOG_WARN, "0x%X --> Sensor lost its configuration (INTERNAL_STATUS: 0x%X), recovering", sensor->i2c_addr, status);
+        sensor->max_retries = 0;
+        rec->backoff_us = rec->config.backoff_min_us;
+        enter(rec, RECOVERY_PROBE, now_us);
+    }
+}
+
+uint8_t bmi270_recovery_step(struct bmi270_recovery *rec, uint64_t now_us)
+{
+    switch (rec->state)
+    {
+    case (RECOVERY_OK):
+        if (rec->config.health_interval_us && now_us >= rec->next_us)
+            health_check(rec, now_us);
+        break;
+    case (RECOVERY_BACKOFF):
+        if (now_us >= rec->next_us)
+            enter(rec, RECOVERY_PROBE, now_us);
+        break;
+    case (RECOVERY_PROBE):
+        probe(rec, now_us);
+        break;
+    case (RECOVERY_RESET):
+        if (now_us >= rec->next_us)
+            enter(rec, RECOVERY_PROBE, now_us);
+        break;
+    case (RECOVERY_UPLOAD):
+        upload(rec, now_us);
+        break;
+    case (RECOVERY_INIT_WAIT):
+        if (now_us >= rec->next_us)
+            enter(rec, RECOVERY_PROBE, now_us);
+        break;
+    case (RECOVERY_RESTORE):
+        restore(rec, now_us);
+        break;
+    }
+
+    return rec->state;
+}
+
+int bmi270_recovery_ready(const struct bmi270_recovery *rec)
+{
+    return rec->state == RECOVERY_OK;
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#ifndef BMI270_RECOVERY_H
+#define BMI270_RECOVERY_H
+
+#include "bmi270.h"
+
+/* ----------------------------------------------------
+                    DEFINITIONS
+-----------------------------------------------------*/
+
+// Recovery States
+#define RECOVERY_OK         UINT8_C(0)         // Streaming
+#define RECOVERY_BACKOFF    UINT8_C(1)         // Waiting before the next probe
+#define RECOVERY_PROBE      UINT8_C(2)         // Checking CHIP_ID and INTERNAL_STATUS
+#define RECOVERY_RESET      UINT8_C(3)         // Soft reset issued, waiting for the sensor
+#define RECOVERY_UPLOAD     UINT8_C(4)         // Config file upload in progress
+#define RECOVERY_INIT_WAIT  UINT8_C(5)         // Waiting for the feature engine to start
+#define RECOVERY_RESTORE    UINT8_C(6)         // Writing back the sensor configuration
+
+// Restored Configuration Registers
+#define RECOVERY_NUM_REGS   10
+
+struct bmi270_recovery_config
+{
+    /* Consecutive failed reads before the sensor is probed */
+    uint8_t error_threshold;
+
+    /* Bus retries per failed transaction while streaming (0 - MAX_RETRIES) */
+    uint8_t max_retries;
+
+    /* Config file chunks uploaded per bmi270_recovery_step call */
+    uint16_t chunks_per_step;
+
+    /* Backoff between failed probes, doubled up to backoff_max_us */
+    uint32_t backoff_min_us;
+    uint32_t backoff_max_us;
+
+    /* Interval of INTERNAL_STATUS checks while streaming (0 = off) */
+    uint32_t health_interval_us;
+
+    /* Called after the register snapshot was written back, to restore anything else (optional) */
+    int (*restore)(struct bmi270 *sensor, void *ctx);
+
+    /* User context passed to restore */
+    void *ctx;
+};
+
+struct bmi270_recovery
+{
+    /* Supervised sensor */
+    struct bmi270 *sensor;
+
+    /* Configuration */
+    struct bmi270_recovery_config config;
+
+    /* Current state: RECOVERY_* */
+    uint8_t state;
+
+    /* Consecutive failed reads */
+    uint8_t consecutive_errors;
+
+    /* Next config file chunk to upload */
+    uint16_t chunk;
+
+    /* Current backoff */
+    uint32_t backoff_us;
+
+    /* Time of the next action in BACKOFF, RESET and INIT_WAIT, or of the next health check */
+    uint64_t next_us;
+
+    /* Completed recoveries and config file re-uploads */
+    uint32_t recoveries;
+    uint32_t uploads;
+
+    /* Initialization errors since the last completed recovery: from the second one on, soft resets back off */
+    uint32_t failed_uploads;
+
+    /* Configuration snapshot: register addresses and values */
+    uint8_t regs[RECOVERY_NUM_REGS];
+    uint8_t values[RECOVERY_NUM_REGS];
+};
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+/* Fill config with defaults: probe after 3 failed reads, 8 chunks per step, 1 ms - 1 s backoff */
+void bmi270_recovery_defaults(struct bmi270_recovery_config *config);
+
+/* Snapshot the current sensor configuration - call after configuring the sensor */
+int bmi270_recovery_init(struct bmi270_recovery *rec, struct bmi270 *sensor, const struct bmi270_recovery_config *config, uint64_t now_us);
+
+/* Snapshot the sensor configuration again, e.g. after it was changed while streaming */
+int bmi270_recovery_snapshot(struct bmi270_recovery *rec);
+
+/* Report the result of a data read, starts recovery after error_threshold consecutive failures */
+void bmi270_recovery_report(struct bmi270_recovery *rec, int result, uint64_t now_us);
+
+/* Advance the state machine by a bounded amount of bus work - returns the current state */
+uint8_t bmi270_recovery_step(struct bmi270_recovery *rec, uint64_t now_us);
+
+/* Returns 1 if the sensor can be read */
+int bmi270_recovery_ready(const struct bmi270_recovery *rec);
+
+#endif // BMI270_RECOVERY_H
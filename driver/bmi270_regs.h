@@ -0,0 +1,122 @@
+#pragma once
+
+#ifndef BMI270_REGS_H
+#define BMI270_REGS_H
+
+#include "bmi270.h"
+
+/* ----------------------------------------------------
+                  REGISTER FIELDS
+-----------------------------------------------------*/
+
+/*
+ * A field is described by its register, bit position and width:
+ *
+ *     #define ACC_CONF_ODR        ACC_CONF, 0, 4
+ *
+ * The FIELD_* macros take a field name and expand to constant expressions, so
+ * reads and updates compile down to a shift and a mask. FIELD_WRITE rejects
+ * constant values that do not fit the field at compile time.
+ */
+
+// PWR_CTRL
+#define PWR_CTRL_AUX_EN     PWR_CTRL, 0, 1
+#define PWR_CTRL_GYR_EN     PWR_CTRL, 1, 1
+#define PWR_CTRL_ACC_EN     PWR_CTRL, 2, 1
+#define PWR_CTRL_TEMP_EN    PWR_CTRL, 3, 1
+
+// PWR_CONF
+#define PWR_CONF_ADV_PS     PWR_CONF, 0, 1     // Advanced power save
+#define PWR_CONF_FIFO_RD    PWR_CONF, 1, 1     // FIFO readable in advanced power save
+#define PWR_CONF_FUP_EN     PWR_CONF, 2, 1     // Fast power up
+
+// ACC_CONF / ACC_RANGE
+#define ACC_CONF_ODR        ACC_CONF, 0, 4
+#define ACC_CONF_BWP        ACC_CONF, 4, 3
+#define ACC_CONF_PERF       ACC_CONF, 7, 1     // Filter performance
+#define ACC_RANGE_SEL       ACC_RANGE, 0, 2
+
+// GYR_CONF / GYR_RANGE
+#define GYR_CONF_ODR        GYR_CONF, 0, 4
+#define GYR_CONF_BWP        GYR_CONF, 4, 2
+#define GYR_CONF_NOISE      GYR_CONF, 6, 1     // Noise performance
+#define GYR_CONF_PERF       GYR_CONF, 7, 1     // Filter performance
+#define GYR_RANGE_SEL       GYR_RANGE, 0, 3
+
+// FIFO_CONFIG_0
+#define FIFO_STOP_ON_FULL   FIFO_CONFIG_0, 0, 1
+#define FIFO_TIME_EN        FIFO_CONFIG_0, 1, 1 // Sensortime frame after the last data frame
+
+// FIFO_CONFIG_1
+#define FIFO_HEADER_EN      FIFO_CONFIG_1, 4, 1
+#define FIFO_AUX_EN         FIFO_CONFIG_1, 5, 1
+#define FIFO_ACC_EN         FIFO_CONFIG_1, 6, 1
+#define FIFO_GYR_EN         FIFO_CONFIG_1, 7, 1
+#define FIFO_SENSORS_EN     FIFO_CONFIG_1, 5, 3
+
+/* ----------------------------------------------------
+                  FIELD ACCESSORS
+-----------------------------------------------------*/
+
+// Indirection: the field name must expand to its three parts before they are picked
+#define FIELD_REG(field)            FIELD_REG_(field)
+#define FIELD_POS(field)            FIELD_POS_(field)
+#define FIELD_MAX(field)            FIELD_MAX_(field)
+#define FIELD_MASK(field)           FIELD_MASK_(field)
+#define FIELD_PREP(field, value)    FIELD_PREP_(field, value)
+#define FIELD_GET(field, reg_value) FIELD_GET_(field, reg_value)
+#define FIELD_CHECK(field, value)   FIELD_CHECK_(field, value)
+
+#define FIELD_REG_(reg, pos, width)         (reg)
+#define FIELD_POS_(reg, pos, width)         (pos)
+#define FIELD_MAX_(reg, pos, width)         ((uint8_t)((1u << (width)) - 1))
+#define FIELD_MASK_(reg, pos, width)        ((uint8_t)(((1u << (width)) - 1) << (pos)))
+#define FIELD_PREP_(reg, pos, width, value) ((uint8_t)(((unsigned)(value) << (pos)) & (((1u << (width)) - 1) << (pos))))
+#define FIELD_GET_(reg, pos, width, value)  ((uint8_t)(((unsigned)(value) >> (pos)) & ((1u << (width)) - 1)))
+
+// Constant value that fits the field, a compile error otherwise
+#define FIELD_CHECK_(reg, pos, width, value) \
+    ((value) + 0 * sizeof(struct { _Static_assert((unsigned)(value) <= (1u << (width)) - 1, "value does not fit register field"); int ok; }))
+
+/* Read-modify-write of one field with a compile-time checked constant */
+#define FIELD_WRITE(sensor, field, value)   FIELD_WRITE_(sensor, field, value)
+#define FIELD_WRITE_(sensor, reg, pos, width, value) \
+    field_update((sensor), reg, pos, width, FIELD_CHECK_(reg, pos, width, value))
+
+/* Read-modify-write of one field with a run-time value (masked to the field width) */
+#define FIELD_UPDATE(sensor, field, value)  field_update((sensor), field, (value))
+
+/* Read one field into *value */
+#define FIELD_READ(sensor, field, value)    field_read((sensor), field, (value))
+
+static inline int field_update(struct bmi270 *sensor, uint8_t reg, uint8_t pos, uint8_t width, uint8_t value)
+{
+    return update_register(sensor, reg, FIELD_MASK_(reg, pos, width), FIELD_PREP_(reg, pos, width, value));
+}
+
+static inline int field_read(struct bmi270 *sensor, uint8_t reg, uint8_t pos, uint8_t width, uint8_t *value)
+{
+    uint8_t reg_value;
+    int result;
+
+    if ((result = read_register(sensor, reg, &reg_value)) < 0)
+        return result;
+
+    *value = FIELD_GET_(reg, pos, width, reg_value);
+    return 0;
+}
+
+/* ----------------------------------------------------
+                  FIELD ENCODINGS
+-----------------------------------------------------*/
+
+/* ACC/GYR ODR code (ACC_ODR_* / GYR_ODR_*) to Hz, 0x0D = 3200 Hz halving per step */
+#define ODR_HZ(odr)         (3200.0 / (double)(1u << (0x0D - (odr))))
+
+/* ACC_RANGE_* to g */
+#define ACC_RANGE_G(r)      (2u << (r))
+
+/* GYR_RANGE_* to dps */
+#define GYR_RANGE_DPS(r)    (2000u >> (r))
+
+#endif // BMI270_REGS_H
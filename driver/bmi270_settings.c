@@ -0,0 +1,438 @@
+#include <arpa/inet.h>
+#include <ctype.h>
+#include <errno.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "bmi270_settings.h"
+
+/* Name of a register code in the settings file */
+struct setting_name
+{
+    const char *name;
+    uint8_t value;
+};
+
+/* Device key stored in one uint8_t field */
+struct device_key
+{
+    const char *key;
+    size_t offset;
+    const struct setting_name *names;
+};
+
+static const struct setting_name modes[] = {
+    {"low_power", LOW_POWER_MODE}, {"normal", NORMAL_MODE}, {"performance", PERFORMANCE_MODE}, {NULL, 0}};
+
+static const struct setting_name acc_ranges[] = {
+    {"2g", ACC_RANGE_2G}, {"4g", ACC_RANGE_4G}, {"8g", ACC_RANGE_8G}, {"16g", ACC_RANGE_16G}, {NULL, 0}};
+
+static const struct setting_name gyr_ranges[] = {
+    {"2000", GYR_RANGE_2000}, {"1000", GYR_RANGE_1000}, {"500", GYR_RANGE_500}, {"250", GYR_RANGE_250}, {"125", GYR_RANGE_125}, {NULL, 0}};
+
+static const struct setting_name acc_odrs[] = {
+    {"0.78", ACC_ODR_0_78}, {"1.56", ACC_ODR_1_56}, {"3.12", ACC_ODR_3_12}, {"6.25", ACC_ODR_6_25}, {"12.5", ACC_ODR_12_5}, {"25", ACC_ODR_25}, {"50", ACC_ODR_50}, {"100", ACC_ODR_100}, {"200", ACC_ODR_200},
+    {"400", ACC_ODR_400}, {"800", ACC_ODR_800}, {"1600", ACC_ODR_1600}, {NULL, 0}};
+
+static const struct setting_name gyr_odrs[] = {
+    {"25", GYR_ODR_25}, {"50", GYR_ODR_50}, {"100", GYR_ODR_100}, {"200", GYR_ODR_200},
+    {"400", GYR_ODR_400}, {"800", GYR_ODR_800}, {"1600", GYR_ODR_1600}, {"3200", GYR_ODR_3200}, {NULL, 0}};
+
+static const struct setting_name acc_bwps[] = {
+    {"osr4", ACC_BWP_OSR4}, {"osr2", ACC_BWP_OSR2}, {"normal", ACC_BWP_NORMAL}, {"cic", ACC_BWP_CIC},
+    {"avg1", ACC_BWP_AVG1}, {"avg2", ACC_BWP_AVG2}, {"avg4", ACC_BWP_AVG4}, {"avg8", ACC_BWP_AVG8},
+    {"avg16", ACC_BWP_AVG16}, {"avg32", ACC_BWP_AVG32}, {"avg64", ACC_BWP_AVG64}, {"avg128", ACC_BWP_AVG128}, {NULL, 0}};
+
+static const struct setting_name gyr_bwps[] = {
+    {"osr4", GYR_BWP_OSR4}, {"osr2", GYR_BWP_OSR2}, {"normal", GYR_BWP_NORMAL}, {NULL, 0}};
+
+static const struct setting_name switches[] = {
+    {"on", 1}, {"off", 0}, {"yes", 1}, {"no", 0}, {"true", 1}, {"false", 0}, {"1", 1}, {"0", 0}, {NULL, 0}};
+
+static const struct device_key device_keys[] = {
+    {"mode", offsetof(struct bmi270_device_settings, mode), modes},
+    {"acc_range", offsetof(struct bmi270_device_settings, acc_range), acc_ranges},
+    {"gyr_range", offsetof(struct bmi270_device_settings, gyr_range), gyr_ranges},
+    {"acc_odr", offsetof(struct bmi270_device_settings, acc_odr), acc_odrs},
+    {"gyr_odr", offsetof(struct bmi270_device_settings, gyr_odr), gyr_odrs},
+    {"acc_bwp", offsetof(struct bmi270_device_settings, acc_bwp), acc_bwps},
+    {"gyr_bwp", offsetof(struct bmi270_device_settings, gyr_bwp), gyr_bwps},
+    {"acc_filter_perf", offsetof(struct bmi270_device_settings, acc_filter_perf), switches},
+    {"gyr_noise_perf", offsetof(struct bmi270_device_settings, gyr_noise_perf), switches},
+    {"gyr_filter_perf", offsetof(struct bmi270_device_settings, gyr_filter_perf), switches},
+    {"fifo_header", offsetof(struct bmi270_device_settings, fifo_header), switches},
+};
+
+/* ----------------------------------------------------
+                  HELPER FUNCTIONS
+-----------------------------------------------------*/
+
+static int lookup(const struct setting_name *names, const char *name, uint8_t *value)
+{
+    for (; names->name; names++)
+    {
+        if (strcasecmp(names->name, name) == 0)
+        {
+            *value = names->value;
+            return 0;
+        }
+    }
+
+    return -EINVAL;
+}
+
+/* Whole string as an unsigned number (decimal or 0x hex) no larger than max */
+static int parse_number(const char *value, unsigned long max, unsigned long *number)
+{
+    char *end;
+
+    errno = 0;
+    *number = strtoul(value, &end, 0);
+
+    return *value && !*end && !errno && *number <= max && value[0] != '-' ? 0 : -EINVAL;
+}
+
+static int parse_double(const char *value, double min, double max, double *number)
+{
+    char *end;
+
+    *number = strtod(value, &end);
+
+    return *value && !*end && *number >= min && *number <= max ? 0 : -EINVAL;
+}
+
+static int copy_string(char *dest, size_t size, const char *value)
+{
+    if (strlen(value) >= size)
+        return -EINVAL;
+
+    strcpy(dest, value);
+    return 0;
+}
+
+static int set_device(struct bmi270_device_settings *device, const char *key, const char *value)
+{
+    unsigned long number;
+
+    if (strcmp(key, "bus") == 0)
+        return copy_string(device->bus, sizeof(device->bus), value);
+
+    if (strcmp(key, "addr") == 0)
+    {
+        if (parse_number(value, 0x7F, &number) < 0)
+            return -EINVAL;
+
+        device->addr = (uint8_t)number;
+        return 0;
+    }
+
+    if (strcmp(key, "fifo_watermark") == 0)
+    {
+        if (parse_number(value, FIFO_SIZE, &number) < 0)
+            return -EINVAL;
+
+        device->fifo_watermark = (uint16_t)number;
+        return 0;
+    }
+
+    for (size_t i = 0; i < sizeof(device_keys) / sizeof(device_keys[0]); i++)
+    {
+        if (strcmp(key, device_keys[i].key) == 0)
+            return lookup(device_keys[i].names, value, (uint8_t *)device + device_keys[i].offset);
+    }
+
+    return -EINVAL;
+}
+
+static int set_daemon(struct bmi270_settings *settings, const char *key, const char *value)
+{
+    unsigned long number;
+    struct in_addr address;
+    const char *port;
+
+    if (strcmp(key, "rate") == 0)
+        return parse_double(value, 0.1, 3200.0, &settings->rate);
+
+    if (strcmp(key, "stats_interval") == 0)
+        return parse_double(value, 0.0, 86400.0, &settings->stats_interval);
+
+    if (strcmp(key, "trace_file") == 0)
+        return copy_string(settings->trace_file, sizeof(settings->trace_file), value);
+
+    if (strcmp(key, "batch") == 0)
+    {
+        if (parse_number(value, SETTINGS_MAX_BATCH, &number) < 0)
+            return -EINVAL;
+
+        settings->batch = (uint16_t)number;
+        return 0;
+    }
+
+    if (strcmp(key, "metrics_port") == 0)
+    {
+        if (parse_number(value, UINT16_MAX, &number) < 0)
+            return -EINVAL;
+
+        settings->metrics_port = (uint16_t)number;
+        return 0;
+    }
+
+    // <address>[:<port>]
+    if (strcmp(key, "receiver") == 0)
+    {
+        char host[SETTINGS_NAME_LEN];
+        size_t len = (port = strchr(value, ':')) ? (size_t)(port - value) : strlen(value);
+
+        if (len >= sizeof(host))
+            return -EINVAL;
+
+        memcpy(host, value, len);
+        host[len] = '\0';
+
+        if (inet_pton(AF_INET, host, &address) != 1 || (port && (parse_number(port + 1, UINT16_MAX, &number) < 0 || number == 0)))
+            return -EINVAL;
+
+        strcpy(settings->receiver, host);
+
+        if (port)
+            settings->receiver_port = (uint16_t)number;
+
+        return 0;
+    }
+
+    return -EINVAL;
+}
+
+/* Strip leading and trailing white space in place */
+static char *trim(char *text)
+{
+    char *end;
+
+    while (isspace((unsigned char)*text))
+        text++;
+
+    end = text + strlen(text);
+
+    while (end > text && isspace((unsigned char)end[-1]))
+        end--;
+
+    *end = '\0';
+    return text;
+}
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+void bmi270_settings_defaults(struct bmi270_settings *settings)
+{
+    memset(settings, 0, sizeof(*settings));
+    settings->rate = 200.0;
+    strcpy(settings->receiver, "192.168.1.2");
+    settings->receiver_port = 8000;
+    settings->stats_interval = 10.0;
+    settings->metrics_port = 9270;
+}
+
+void bmi270_device_settings_defaults(struct bmi270_device_settings *device, const char *name)
+{
+    memset(device, 0, sizeof(*device));
+    snprintf(device->name, sizeof(device->name), "%s", name);
+    snprintf(device->bus, sizeof(device->bus), "%s", I2C_DEVICE);
+    device->addr = I2C_PRIM_ADDR;
+    device->mode = PERFORMANCE_MODE;
+    device->acc_range = ACC_RANGE_2G;
+    device->gyr_range = GYR_RANGE_1000;
+    device->acc_odr = ACC_ODR_200;
+    device->gyr_odr = GYR_ODR_200;
+    device->acc_bwp = ACC_BWP_OSR4;
+    device->gyr_bwp = GYR_BWP_OSR4;
+    device->acc_filter_perf = 1;
+    device->gyr_noise_perf = 1;
+    device->gyr_filter_perf = 1;
+}
+
+struct bmi270_device_settings *bmi270_settings_add(struct bmi270_settings *settings, const char *name)
+{
+    struct bmi270_device_settings *device;
+
+    if (settings->num_devices == SETTINGS_MAX_DEVICES || !*name || strlen(name) >= SETTINGS_NAME_LEN)
+        return NULL;
+
+    device = &settings->devices[settings->num_devices++];
+    bmi270_device_settings_defaults(device, name);
+
+    return device;
+}
+
+struct bmi270_device_settings *bmi270_settings_find(struct bmi270_settings *settings, const char *name)
+{
+    for (int i = 0; i < settings->num_devices; i++)
+    {
+        if (strcmp(settings->devices[i].name, name) == 0)
+            return &settings->devices[i];
+    }
+
+    return NULL;
+}
+
+int bmi270_settings_set(struct bmi270_settings *settings, struct bmi270_device_settings *device, const char *key, const char *value)
+{
+    const char *dot;
+
+    if (device)
+        return set_device(device, key, value);
+
+    // <device>.<key>: a device named on the command line only is added
+    if ((dot = strchr(key, '.')))
+    {
+        char name[SETTINGS_NAME_LEN];
+
+        if ((size_t)(dot - key) >= sizeof(name))
+            return -EINVAL;
+
+        memcpy(name, key, dot - key);
+        name[dot - key] = '\0';
+
+        if (!(device = bmi270_settings_find(settings, name)) && !(device = bmi270_settings_add(settings, name)))
+            return -EINVAL;
+
+        return set_device(device, dot + 1, value);
+    }
+
+    return set_daemon(settings, key, value);
+}
+
+int bmi270_settings_parse(struct bmi270_settings *settings, const char *assignment)
+{
+    char line[SETTINGS_LINE_LEN], *equals;
+    int result;
+
+    if (copy_string(line, sizeof(line), assignment) < 0 || !(equals = strchr(line, '=')))
+        return -EINVAL;
+
+    *equals = '\0';
+
+    if ((result = bmi270_settings_set(settings, NULL, trim(line), trim(equals + 1))) < 0)
+        bmi270_log(BMI270_LOG_ERROR, "Invalid setting: %s", assignment);
+
+    return result;
+}
+
+int bmi270_settings_load(struct bmi270_settings *settings, const char *path)
+{
+    struct bmi270_settings loaded = *settings;
+    struct bmi270_device_settings *device = NULL;
+    char buffer[SETTINGS_LINE_LEN], *line, *equals;
+    int line_number = 0, result = 0;
+    FILE *file;
+
+    if (!(file = fopen(path, "r")))
+    {
+        result = -errno;
+        bmi270_log(BMI270_LOG_ERROR, "Could not open settings %s", path);
+        return result;
+    }
+
+    while (result == 0 && fgets(buffer, sizeof(buffer), file))
+    {
+        line_number++;
+
+        // Comments run to the end of the line
+        buffer[strcspn(buffer, "#;")] = '\0';
+        line = trim(buffer);
+
+        if (!*line)
+            continue;
+
+        // [device <name>] or [daemon]
+        if (line[0] == '[' && line[strlen(line) - 1] == ']')
+        {
+            line[strlen(line) - 1] = '\0';
+            line = trim(line + 1);
+
+            if (strcmp(line, "daemon") == 0)
+            {
+                device = NULL;
+                continue;
+            }
+
+            if (strncmp(line, "device", 6) == 0 && isspace((unsigned char)line[6]))
+            {
+                line = trim(line + 6);
+
+                if ((device = bmi270_settings_find(&loaded, line)) || (device = bmi270_settings_add(&loaded, line)))
+                    continue;
+            }
+
+            bmi270_log(BMI270_LOG_ERROR, "%s:%d --> Invalid section or too many devices", path, line_number);
+            result = -EINVAL;
+        }
+        else if (!(equals = strchr(line, '=')))
+        {
+            bmi270_log(BMI270_LOG_ERROR, "%s:%d --> Expected key = value", path, line_number);
+            result = -EINVAL;
+        }
+        else
+        {
+            *equals = '\0';
+
+            if ((result = bmi270_settings_set(&loaded, device, trim(line), trim(equals + 1))) < 0)
+                bmi270_log(BMI270_LOG_ERROR, "%s:%d --> Invalid value for %s", path, line_number, trim(line));
+        }
+    }
+
+    fclose(file);
+
+    if (result == 0)
+        *settings = loaded;
+
+    return result;
+}
+
+int bmi270_settings_apply(struct bmi270 *sensor, const struct bmi270_device_settings *old, const struct bmi270_device_settings *settings)
+{
+    // The mode writes whole ACC_CONF and GYR_CONF values: everything after it is written again
+    int all = !old || old->mode != settings->mode;
+    int result, count = 0;
+
+#define APPLY(field, call)                                    \
+    if (all || old->field != settings->field)                 \
+    {                                                         \
+        if ((result = (call)) < 0)                            \
+            return result;                                    \
+        count++;                                              \
+    }
+
+    APPLY(mode, set_mode(sensor, settings->mode))
+    APPLY(acc_range, set_acc_range(sensor, settings->acc_range))
+    APPLY(gyr_range, set_gyr_range(sensor, settings->gyr_range))
+
+    // Filter performance off before an ODR below 12.5 Hz, on only after leaving it: the sensor rejects the mix
+    if (!settings->acc_filter_perf)
+        APPLY(acc_filter_perf, disable_acc_filter_perf(sensor))
+
+    APPLY(acc_odr, set_acc_odr(sensor, settings->acc_odr))
+    APPLY(gyr_odr, set_gyr_odr(sensor, settings->gyr_odr))
+    APPLY(acc_bwp, set_acc_bwp(sensor, settings->acc_bwp))
+    APPLY(gyr_bwp, set_gyr_bwp(sensor, settings->gyr_bwp))
+
+    if (settings->acc_filter_perf)
+        APPLY(acc_filter_perf, enable_acc_filter_perf(sensor))
+
+    APPLY(gyr_noise_perf, settings->gyr_noise_perf ? enable_gyr_noise_perf(sensor) : disable_gyr_noise_perf(sensor))
+    APPLY(gyr_filter_perf, settings->gyr_filter_perf ? enable_gyr_filter_perf(sensor) : disable_gyr_filter_perf(sensor))
+    APPLY(fifo_header, settings->fifo_header ? enable_fifo_header(sensor) : disable_fifo_header(sensor))
+    APPLY(fifo_watermark, set_fifo_watermark(sensor, settings->fifo_watermark))
+
+#undef APPLY
+
+    // Register reads only, no FIFO: not part of the settings
+    if (!old && (result = enable_data_streaming(sensor)) < 0)
+        return result;
+
+    return count;
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+#ifndef BMI270_SETTINGS_H
+#define BMI270_SETTINGS_H
+
+#include "bmi270.h"
+
+/* ----------------------------------------------------
+                    DEFINITIONS
+-----------------------------------------------------*/
+
+/*
+ * Runtime settings of a streaming daemon, read from an INI-style file:
+ *
+ *     # Comment
+ *     rate = 200                  (Hz)
+ *     receiver = 192.168.1.2:8000
+ *
+ *     [device upper]
+ *     bus = /dev/i2c-1
+ *     addr = 0x68
+ *     gyr_odr = 400
+ *
+ * Keys before the first section are daemon keys, device sections start from
+ * bmi270_device_settings_defaults. The same key = value pairs can be given on
+ * the command line, device keys as <device>.<key> = value.
+ *
+ * Reloading compares old and new device settings and only writes the
+ * registers whose setting changed, the sensor keeps streaming.
+ */
+
+#define SETTINGS_MAX_DEVICES 8
+#define SETTINGS_MAX_BATCH  64                 // Samples per compressed datagram
+#define SETTINGS_NAME_LEN   32
+#define SETTINGS_PATH_LEN   64
+#define SETTINGS_LINE_LEN   256
+
+struct bmi270_device_settings
+{
+    /* Name (metrics label, section name) */
+    char name[SETTINGS_NAME_LEN];
+
+    /* Bus device and address */
+    char bus[SETTINGS_PATH_LEN];
+    uint8_t addr;
+
+    /* Power mode (*_MODE), written first: it resets ACC_CONF and GYR_CONF */
+    uint8_t mode;
+
+    /* ACC_RANGE_*, GYR_RANGE_*, *_ODR_* and *_BWP_* codes */
+    uint8_t acc_range;
+    uint8_t gyr_range;
+    uint8_t acc_odr;
+    uint8_t gyr_odr;
+    uint8_t acc_bwp;
+    uint8_t gyr_bwp;
+
+    /* Filter and noise performance modes (0, 1) */
+    uint8_t acc_filter_perf;
+    uint8_t gyr_noise_perf;
+    uint8_t gyr_filter_perf;
+
+    /* FIFO header mode (0, 1) and watermark (bytes) */
+    uint8_t fifo_header;
+    uint16_t fifo_watermark;
+};
+
+struct bmi270_settings
+{
+    /* Acquisition rate (Hz) */
+    double rate;
+
+    /* UDP receiver (dotted IPv4 address) and port */
+    char receiver[SETTINGS_NAME_LEN];
+    uint16_t receiver_port;
+
+    /* Samples per compressed datagram (0 = uncompressed int32 datagrams) */
+    uint16_t batch;
+
+    /* Bus statistics interval (s, 0 = off), metrics port (0 = off), Chrome trace written on exit ("" = off) */
+    double stats_interval;
+    uint16_t metrics_port;
+    char trace_file[SETTINGS_PATH_LEN];
+
+    /* Devices */
+    struct bmi270_device_settings devices[SETTINGS_MAX_DEVICES];
+    uint8_t num_devices;
+};
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+/* Default daemon settings without devices */
+void bmi270_settings_defaults(struct bmi270_settings *settings);
+
+/* Default device settings: performance mode, 2g, 1000dps, 200Hz, OSR4, performance filters, headerless FIFO */
+void bmi270_device_settings_defaults(struct bmi270_device_settings *device, const char *name);
+
+/* Add a device with default settings - returns the device or NULL if full */
+struct bmi270_device_settings *bmi270_settings_add(struct bmi270_settings *settings, const char *name);
+
+/* Find a device by name - returns NULL if not found */
+struct bmi270_device_settings *bmi270_settings_find(struct bmi270_settings *settings, const char *name);
+
+/* Set one key: daemon key, or device key with a device (or "<device>.<key>" without) - returns -EINVAL if unknown or invalid */
+int bmi270_settings_set(struct bmi270_settings *settings, struct bmi270_device_settings *device, const char *key, const char *value);
+
+/* Set one "key=value" (e.g. from the command line), device keys as "<device>.<key>=value" */
+int bmi270_settings_parse(struct bmi270_settings *settings, const char *assignment);
+
+/* Read settings from a file on top of the current ones - returns a negative errno, settings are unchanged on error */
+int bmi270_settings_load(struct bmi270_settings *settings, const char *path);
+
+/* Write device settings to the sensor, only the ones that differ from old (NULL = all) - returns the number of settings written */
+int bmi270_settings_apply(struct bmi270 *sensor, const struct bmi270_device_settings *old, const struct bmi270_device_settings *settings);
+
+#endif // BMI270_SETTINGS_H
@@ -0,0 +1,359 @@
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#include "bmi270_spectrum.h"
+
+#define PI 3.14159265358979323846
+
+/* ----------------------------------------------------
+                  HELPER FUNCTIONS
+-----------------------------------------------------*/
+
+/* Radix-2 stages on bit-reversed input */
+static void butterflies(const struct bmi270_spectrum *spectrum, float *re, float *im)
+{
+    uint16_t n = spectrum->config.size;
+
+    for (uint16_t m = 1; m < n; m <<= 1)
+    {
+        const float *w_re = spectrum->twiddle_re + m - 1;
+        const float *w_im = spectrum->twiddle_im + m - 1;
+
+        for (uint16_t start = 0; start < n; start += 2 * m)
+        {
+            float *a_re = re + start, *a_im = im + start;
+            float *b_re = a_re + m, *b_im = a_im + m;
+            uint16_t j = 0;
+
+#if defined(__SSE2__)
+            for (; j + 4 <= m; j += 4)
+            {
+                __m128 wr = _mm_loadu_ps(w_re + j), wi = _mm_loadu_ps(w_im + j);
+                __m128 br = _mm_loadu_ps(b_re + j), bi = _mm_loadu_ps(b_im + j);
+                __m128 ar = _mm_loadu_ps(a_re + j), ai = _mm_loadu_ps(a_im + j);
+                __m128 tr = _mm_sub_ps(_mm_mul_ps(wr, br), _mm_mul_ps(wi, bi));
+                __m128 ti = _mm_add_ps(_mm_mul_ps(wr, bi), _mm_mul_ps(wi, br));
+
+                _mm_storeu_ps(b_re + j, _mm_sub_ps(ar, tr));
+                _mm_storeu_ps(b_im + j, _mm_sub_ps(ai, ti));
+                _mm_storeu_ps(a_re + j, _mm_add_ps(ar, tr));
+                _mm_storeu_ps(a_im + j, _mm_add_ps(ai, ti));
+            }
+#elif defined(__ARM_NEON)
+            for (; j + 4 <= m; j += 4)
+            {
+                float32x4_t wr = vld1q_f32(w_re + j), wi = vld1q_f32(w_im + j);
+                float32x4_t br = vld1q_f32(b_re + j), bi = vld1q_f32(b_im + j);
+                float32x4_t ar = vld1q_f32(a_re + j), ai = vld1q_f32(a_im + j);
+                float32x4_t tr = vmlsq_f32(vmulq_f32(wr, br), wi, bi);
+                float32x4_t ti = vmlaq_f32(vmulq_f32(wr, bi), wi, br);
+
+                vst1q_f32(b_re + j, vsubq_f32(ar, tr));
+                vst1q_f32(b_im + j, vsubq_f32(ai, ti));
+                vst1q_f32(a_re + j, vaddq_f32(ar, tr));
+                vst1q_f32(a_im + j, vaddq_f32(ai, ti));
+            }
+#endif
+            // First stages (m < 4) and the scalar build
+            for (; j < m; j++)
+            {
+                float tr = w_re[j] * b_re[j] - w_im[j] * b_im[j];
+                float ti = w_re[j] * b_im[j] + w_im[j] * b_re[j];
+
+                b_re[j] = a_re[j] - tr;
+                b_im[j] = a_im[j] - ti;
+                a_re[j] += tr;
+                a_im[j] += ti;
+            }
+        }
+    }
+}
+
+/* Windowed axis of the last size samples without its mean, written in bit-reversed order */
+static void load_axis(struct bmi270_spectrum *spectrum, int axis, float *out)
+{
+    uint16_t n = spectrum->config.size, oldest = spectrum->pos;
+    const float *ring = spectrum->ring[axis];
+    float mean = 0.0f;
+
+    for (uint16_t i = 0; i < n; i++)
+    {
+        mean += ring[i];
+    }
+
+    mean /= n;
+
+    for (uint16_t i = 0; i < n; i++)
+    {
+        out[spectrum->bitrev[i]] = spectrum->window[i] * (ring[(oldest + i) & (n - 1)] - mean);
+    }
+}
+
+static void transform_frame(struct bmi270_spectrum *spectrum)
+{
+    uint16_t n = spectrum->config.size, half = n / 2;
+    float *re = spectrum->re, *im = spectrum->im;
+
+    // x and y in one transform: X = (Z[k] + Z*[n-k]) / 2, Y = (Z[k] - Z*[n-k]) / 2i
+    load_axis(spectrum, 0, re);
+    load_axis(spectrum, 1, im);
+    butterflies(spectrum, re, im);
+
+    for (uint16_t k = 0; k <= half; k++)
+    {
+        uint16_t r = (n - k) & (n - 1);
+        float x_re = 0.5f * (re[k] + re[r]), x_im = 0.5f * (im[k] - im[r]);
+        float y_re = 0.5f * (im[k] + im[r]), y_im = 0.5f * (re[r] - re[k]);
+
+        spectrum->power[0][k] += x_re * x_re + x_im * x_im;
+        spectrum->power[1][k] += y_re * y_re + y_im * y_im;
+    }
+
+    load_axis(spectrum, 2, re);
+    memset(im, 0, n * sizeof(*im));
+    butterflies(spectrum, re, im);
+
+    for (uint16_t k = 0; k <= half; k++)
+    {
+        spectrum->power[2][k] += re[k] * re[k] + im[k] * im[k];
+    }
+
+    spectrum->frames++;
+    spectrum->total_frames++;
+}
+
+/* Keep the largest peaks sorted by amplitude */
+static void insert_peak(struct bmi270_spectrum_peak *peaks, int num_peaks, float freq_hz, float amplitude)
+{
+    int i = num_peaks - 1;
+
+    if (amplitude <= peaks[i].amplitude)
+        return;
+
+    for (; i > 0 && peaks[i - 1].amplitude < amplitude; i--)
+    {
+        peaks[i] = peaks[i - 1];
+    }
+
+    peaks[i].freq_hz = freq_hz;
+    peaks[i].amplitude = amplitude;
+}
+
+static void build_report(struct bmi270_spectrum *spectrum, uint64_t timestamp_us, struct bmi270_spectrum_report *report)
+{
+    const struct bmi270_spectrum_config *config = &spectrum->config;
+    uint16_t n = config->size, half = n / 2;
+    float resolution = spectrum->sample_rate / n;
+
+    // One-sided power per bin: the bins of an axis sum up to its mean square (Parseval)
+    float scale = 2.0f / ((float)n * spectrum->window_power * spectrum->frames);
+
+    memset(report, 0, sizeof(*report));
+    report->timestamp_us = timestamp_us;
+    report->frames = spectrum->frames;
+    report->flags = spectrum->flags;
+    report->resolution_hz = resolution;
+
+    for (int axis = 0; axis < SPECTRUM_AXES; axis++)
+    {
+        const float *power = spectrum->power[axis];
+        double total = 0.0;
+
+        for (uint16_t k = 1; k <= half; k++)
+        {
+            float p = power[k] * (k == half ? 0.5f : 1.0f) * scale;
+
+            total += p;
+
+            for (int b = 0; b < config->num_bands; b++)
+            {
+                if (k * resolution >= config->bands[b].low_hz && k * resolution <= config->bands[b].high_hz)
+                    report->band_rms[axis][b] += p;
+            }
+        }
+
+        report->rms[axis] = sqrtf((float)total);
+
+        for (int b = 0; b < config->num_bands; b++)
+        {
+            report->band_rms[axis][b] = sqrtf(report->band_rms[axis][b]);
+        }
+
+        for (uint16_t k = 2; k < half && config->num_peaks; k++)
+        {
+            if (power[k] <= power[k - 1] || power[k] < power[k + 1])
+                continue;
+
+            // Parabola through the log power of the peak and its neighbors
+            float l = logf(power[k - 1] + 1e-30f), c = logf(power[k]), r = logf(power[k + 1] + 1e-30f);
+            float denom = l - 2.0f * c + r;
+            float delta = denom < 0.0f ? 0.5f * (l - r) / denom : 0.0f;
+            float peak = c - 0.25f * (l - r) * delta;
+
+            // Sine amplitude: |X| = A * window_sum / 2
+            insert_peak(report->peaks[axis], config->num_peaks, (k + delta) * resolution,
+                        2.0f * sqrtf(expf(peak) / spectrum->frames) / spectrum->window_sum);
+        }
+    }
+
+    memset(spectrum->power, 0, sizeof(spectrum->power));
+    spectrum->frames = 0;
+    spectrum->flags = 0;
+    spectrum->reports++;
+}
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+void bmi270_spectrum_defaults(struct bmi270_spectrum_config *config)
+{
+    memset(config, 0, sizeof(*config));
+    config->source = SPECTRUM_ACC;
+    config->size = 1024;
+    config->hop = 512;
+    config->frames_per_report = 8;
+    config->num_peaks = SPECTRUM_MAX_PEAKS;
+}
+
+int bmi270_spectrum_init(struct bmi270_spectrum *spectrum, struct bmi270 *sensor, const struct bmi270_spectrum_config *config)
+{
+    uint16_t n = config->size;
+    double odr = config->source == SPECTRUM_GYR ? sensor->gyr_odr : sensor->acc_odr;
+    int bits = 0;
+
+    if (n < SPECTRUM_MIN_SIZE || n > SPECTRUM_MAX_SIZE || (n & (n - 1)) || config->hop == 0 || config->hop > n ||
+        config->frames_per_report == 0 || config->num_bands > SPECTRUM_MAX_BANDS || config->num_peaks > SPECTRUM_MAX_PEAKS || odr <= 0.0)
+    {
+        bmi270_log(BMI270_LOG_ERROR, "0x%X --> Invalid spectrum configuration", sensor->i2c_addr);
+        return -EINVAL;
+    }
+
+    memset(spectrum, 0, sizeof(*spectrum));
+    spectrum->sensor = sensor;
+    spectrum->config = *config;
+    spectrum->sample_rate = (float)odr;
+
+    while ((1u << bits) < n)
+        bits++;
+
+    for (uint16_t i = 0; i < n; i++)
+    {
+        uint16_t reversed = 0;
+
+        for (int b = 0; b < bits; b++)
+        {
+            reversed |= ((i >> b) & 1) << (bits - 1 - b);
+        }
+
+        spectrum->bitrev[i] = reversed;
+
+        // Periodic Hann window
+        spectrum->window[i] = (float)(0.5 - 0.5 * cos(2.0 * PI * i / n));
+        spectrum->window_sum += spectrum->window[i];
+        spectrum->window_power += spectrum->window[i] * spectrum->window[i];
+    }
+
+    // Stage with butterflies m apart: exp(-i pi j / m), j < m, contiguous for vector loads
+    for (uint16_t m = 1; m < n; m <<= 1)
+    {
+        for (uint16_t j = 0; j < m; j++)
+        {
+            spectrum->twiddle_re[m - 1 + j] = (float)cos(PI * j / m);
+            spectrum->twiddle_im[m - 1 + j] = (float)-sin(PI * j / m);
+        }
+    }
+
+    return 0;
+}
+
+void bmi270_spectrum_reset(struct bmi270_spectrum *spectrum)
+{
+    spectrum->pos = 0;
+    spectrum->fill = 0;
+    spectrum->since_frame = 0;
+    spectrum->frames = 0;
+    memset(spectrum->power, 0, sizeof(spectrum->power));
+}
+
+int bmi270_spectrum_push(struct bmi270_spectrum *spectrum, const struct bmi270_sample *samples, int count, struct bmi270_spectrum_report *report)
+{
+    const struct bmi270_spectrum_config *config = &spectrum->config;
+    uint16_t n = config->size;
+    int reports = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        const struct bmi270_sample *sample = &samples[i];
+        double values[SPECTRUM_AXES];
+
+        // No frame spans lost samples
+        if (!(sample->flags & SAMPLE_VALID) || (sample->flags & SAMPLE_GAP))
+        {
+            spectrum->fill = 0;
+            spectrum->since_frame = 0;
+            spectrum->flags |= SAMPLE_GAP;
+            spectrum->gaps++;
+
+            if (!(sample->flags & SAMPLE_VALID))
+                continue;
+        }
+
+        if (config->source == SPECTRUM_GYR)
+            convert_gyr_raw(spectrum->sensor, sample->gyr, values);
+        else
+            convert_acc_raw(spectrum->sensor, sample->acc, values);
+
+        for (int axis = 0; axis < SPECTRUM_AXES; axis++)
+        {
+            spectrum->ring[axis][spectrum->pos] = (float)values[axis];
+        }
+
+        spectrum->pos = (spectrum->pos + 1) & (n - 1);
+        spectrum->since_frame++;
+
+        if (spectrum->fill < n)
+            spectrum->fill++;
+
+        if (spectrum->fill < n || spectrum->since_frame < config->hop)
+            continue;
+
+        transform_frame(spectrum);
+        spectrum->since_frame = 0;
+
+        if (spectrum->frames == config->frames_per_report)
+        {
+            build_report(spectrum, sample->timestamp_us, report);
+            reports++;
+        }
+    }
+
+    return reports;
+}
+
+void bmi270_spectrum_fft(const struct bmi270_spectrum *spectrum, float *re, float *im)
+{
+    for (uint16_t i = 0; i < spectrum->config.size; i++)
+    {
+        uint16_t j = spectrum->bitrev[i];
+
+        if (j > i)
+        {
+            float t = re[i];
+            re[i] = re[j];
+            re[j] = t;
+            t = im[i];
+            im[i] = im[j];
+            im[j] = t;
+        }
+    }
+
+    butterflies(spectrum, re, im);
+}
@@ -0,0 +1,145 @@
+#pragma once
+
+#ifndef BMI270_SPECTRUM_H
+#define BMI270_SPECTRUM_H
+
+#include "bmi270.h"
+
+/* ----------------------------------------------------
+                    DEFINITIONS
+-----------------------------------------------------*/
+
+/*
+ * Vibration spectrum of the accelerometer (or gyroscope) x, y and z axes:
+ * samples (e.g. FIFO batches) go into a ring, every hop samples the last size
+ * samples are windowed (Hann, mean removed) and transformed, and the power
+ * spectra of frames_per_report frames are averaged (Welch). Each report holds
+ * per axis the RMS, the RMS of configured bands and the largest peaks, a few
+ * hundred bytes instead of the raw stream.
+ *
+ * The FFT is an iterative radix-2 transform planned at init: window, bit
+ * reversal and twiddles per stage are tables, the butterflies of the larger
+ * stages run four at a time with SSE or NEON. x and y share one complex
+ * transform (x real, y imaginary), z takes a second one.
+ *
+ * A gap (SAMPLE_GAP, invalid sample) restarts the ring: no frame spans it.
+ */
+
+#define SPECTRUM_MAX_SIZE   4096               // FFT points (power of two)
+#define SPECTRUM_MIN_SIZE   16
+#define SPECTRUM_AXES       3
+#define SPECTRUM_MAX_BANDS  8
+#define SPECTRUM_MAX_PEAKS  4
+
+// Sources
+#define SPECTRUM_ACC        UINT8_C(0)         // m/s^2
+#define SPECTRUM_GYR        UINT8_C(1)         // rad/s
+
+struct bmi270_spectrum_band
+{
+    /* Frequency range (Hz), both ends included */
+    float low_hz;
+    float high_hz;
+};
+
+struct bmi270_spectrum_config
+{
+    /* SPECTRUM_ACC or SPECTRUM_GYR */
+    uint8_t source;
+
+    /* FFT points and samples between frames (size / 2 = 50 % overlap) */
+    uint16_t size;
+    uint16_t hop;
+
+    /* Frames averaged per report */
+    uint16_t frames_per_report;
+
+    /* Bands reported as RMS */
+    struct bmi270_spectrum_band bands[SPECTRUM_MAX_BANDS];
+    uint8_t num_bands;
+
+    /* Largest peaks reported per axis */
+    uint8_t num_peaks;
+};
+
+struct bmi270_spectrum_peak
+{
+    /* Interpolated frequency (Hz) and sine amplitude (source unit) */
+    float freq_hz;
+    float amplitude;
+};
+
+struct bmi270_spectrum_report
+{
+    /* Host timestamp of the last sample (us) */
+    uint64_t timestamp_us;
+
+    /* Averaged frames, SAMPLE_GAP if samples were lost since the last report */
+    uint16_t frames;
+    uint16_t flags;
+
+    /* Frequency resolution (Hz) */
+    float resolution_hz;
+
+    /* RMS without DC, per band and the largest peaks (amplitude 0 = none) per axis */
+    float rms[SPECTRUM_AXES];
+    float band_rms[SPECTRUM_AXES][SPECTRUM_MAX_BANDS];
+    struct bmi270_spectrum_peak peaks[SPECTRUM_AXES][SPECTRUM_MAX_PEAKS];
+};
+
+struct bmi270_spectrum
+{
+    /* Sensor (data scale, ODR), configuration and sample rate (Hz) */
+    struct bmi270 *sensor;
+    struct bmi270_spectrum_config config;
+    float sample_rate;
+
+    /* Plan: window, its sum and power, bit reversal, twiddles of stage m at m - 1 */
+    float window[SPECTRUM_MAX_SIZE];
+    float window_sum;
+    float window_power;
+    uint16_t bitrev[SPECTRUM_MAX_SIZE];
+    float twiddle_re[SPECTRUM_MAX_SIZE];
+    float twiddle_im[SPECTRUM_MAX_SIZE];
+
+    /* Sample ring per axis, next write position, valid samples and samples since the last frame */
+    float ring[SPECTRUM_AXES][SPECTRUM_MAX_SIZE];
+    uint16_t pos;
+    uint16_t fill;
+    uint16_t since_frame;
+
+    /* Transform buffers */
+    float re[SPECTRUM_MAX_SIZE];
+    float im[SPECTRUM_MAX_SIZE];
+
+    /* Summed |X|^2 of the frames of the current report */
+    float power[SPECTRUM_AXES][SPECTRUM_MAX_SIZE / 2 + 1];
+    uint16_t frames;
+    uint16_t flags;
+
+    /* Counters */
+    uint64_t total_frames;
+    uint64_t reports;
+    uint64_t gaps;
+};
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+/* Fill config with defaults: acc, 1024 points, 50 % overlap, 8 frames per report, 4 peaks, no bands */
+void bmi270_spectrum_defaults(struct bmi270_spectrum_config *config);
+
+/* Plan the transform at the sensor's current ODR - the struct is large, keep it static or on the heap */
+int bmi270_spectrum_init(struct bmi270_spectrum *spectrum, struct bmi270 *sensor, const struct bmi270_spectrum_config *config);
+
+/* Drop buffered samples and the partial average */
+void bmi270_spectrum_reset(struct bmi270_spectrum *spectrum);
+
+/* Add samples of one sensor - returns the number of reports completed, report holds the last one */
+int bmi270_spectrum_push(struct bmi270_spectrum *spectrum, const struct bmi270_sample *samples, int count, struct bmi270_spectrum_report *report);
+
+/* Transform size points of re/im in place with the spectrum's plan (exposed for benchmarks) */
+void bmi270_spectrum_fft(const struct bmi270_spectrum *spectrum, float *re, float *im);
+
+#endif // BMI270_SPECTRUM_H
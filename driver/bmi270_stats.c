@@ -0,0 +1,136 @@
+#include "bmi270_stats.h"
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+static const char *op_names[STATS_NUM_OPS] = {"read", "read_block", "write", "write_block"};
+
+void bmi270_stats_reset(struct bmi270_stats *stats)
+{
+    for (int op = 0; op < STATS_NUM_OPS; op++)
+    {
+        atomic_store_explicit(&stats->transactions[op], 0, memory_order_relaxed);
+        atomic_store_explicit(&stats->bytes[op], 0, memory_order_relaxed);
+        atomic_store_explicit(&stats->errors[op], 0, memory_order_relaxed);
+        atomic_store_explicit(&stats->latency_sum[op], 0, memory_order_relaxed);
+
+        for (int i = 0; i < STATS_NUM_BUCKETS; i++)
+        {
+            atomic_store_explicit(&stats->latency[op][i], 0, memory_order_relaxed);
+        }
+    }
+
+    atomic_store_explicit(&stats->retries, 0, memory_order_relaxed);
+    atomic_store_explicit(&stats->loops, 0, memory_order_relaxed);
+    atomic_store_explicit(&stats->loop_overruns, 0, memory_order_relaxed);
+    stats->last_dump = bmi270_stats_now();
+}
+
+void bmi270_stats_attach(struct bmi270 *sensor, struct bmi270_stats *stats)
+{
+    if (stats)
+        bmi270_stats_reset(stats);
+
+    sensor->stats = stats;
+}
+
+void bmi270_stats_record(struct bmi270_stats *stats, uint8_t op, uint32_t bytes, uint64_t latency, int error)
+{
+    int bucket = latency ? 63 - __builtin_clzll(latency) : 0;
+
+    if (bucket >= STATS_NUM_BUCKETS)
+        bucket = STATS_NUM_BUCKETS - 1;
+
+    atomic_fetch_add_explicit(&stats->transactions[op], 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&stats->latency_sum[op], latency, memory_order_relaxed);
+    atomic_fetch_add_explicit(&stats->latency[op][bucket], 1, memory_order_relaxed);
+
+    if (error)
+        atomic_fetch_add_explicit(&stats->errors[op], 1, memory_order_relaxed);
+    else
+        atomic_fetch_add_explicit(&stats->bytes[op], bytes, memory_order_relaxed);
+}
+
+void bmi270_stats_retry(struct bmi270_stats *stats)
+{
+    atomic_fetch_add_explicit(&stats->retries, 1, memory_order_relaxed);
+}
+
+void bmi270_stats_loop(struct bmi270_stats *stats, uint64_t elapsed, uint64_t budget)
+{
+    atomic_fetch_add_explicit(&stats->loops, 1, memory_order_relaxed);
+
+    if (elapsed > budget)
+        atomic_fetch_add_explicit(&stats->loop_overruns, 1, memory_order_relaxed);
+}
+
+uint64_t bmi270_stats_percentile(const struct bmi270_stats *stats, uint8_t op, double p)
+{
+    uint64_t counts[STATS_NUM_BUCKETS];
+    uint64_t total = 0;
+    uint64_t rank, seen = 0;
+
+    // Buckets may move while copying, the snapshot is good enough for percentiles
+    for (int i = 0; i < STATS_NUM_BUCKETS; i++)
+    {
+        counts[i] = atomic_load_explicit(&stats->latency[op][i], memory_order_relaxed);
+        total += counts[i];
+    }
+
+    if (total == 0)
+        return 0;
+
+    rank = (uint64_t)(p * (double)total);
+
+    if (rank >= total)
+        rank = total - 1;
+
+    for (int i = 0; i < STATS_NUM_BUCKETS; i++)
+    {
+        seen += counts[i];
+
+        if (seen > rank)
+            return 2ULL << i;
+    }
+
+    return 2ULL << (STATS_NUM_BUCKETS - 1);
+}
+
+void bmi270_stats_dump(const struct bmi270_stats *stats, FILE *out, const char *label)
+{
+    fprintf(out, "%s --> loops: %llu, overruns: %llu, retries: %llu\n", label,
+            (unsigned long long)atomic_load_explicit(&stats->loops, memory_order_relaxed),
+            (unsigned long long)atomic_load_explicit(&stats->loop_overruns, memory_order_relaxed),
+            (unsigned long long)atomic_load_explicit(&stats->retries, memory_order_relaxed));
+
+    for (uint8_t op = 0; op < STATS_NUM_OPS; op++)
+    {
+        uint64_t count = atomic_load_explicit(&stats->transactions[op], memory_order_relaxed);
+
+        if (count == 0)
+            continue;
+
+        fprintf(out, "%s --> %-11s n: %llu, bytes: %llu, errors: %llu, avg: %.1f us, p50: %.1f us, p99: %.1f us, max: %.1f us\n", label, op_names[op],
+                (unsigned long long)count,
+                (unsigned long long)atomic_load_explicit(&stats->bytes[op], memory_order_relaxed),
+                (unsigned long long)atomic_load_explicit(&stats->errors[op], memory_order_relaxed),
+                (double)atomic_load_explicit(&stats->latency_sum[op], memory_order_relaxed) / (double)count / 1000.0,
+                bmi270_stats_percentile(stats, op, 0.50) / 1000.0,
+                bmi270_stats_percentile(stats, op, 0.99) / 1000.0,
+                bmi270_stats_percentile(stats, op, 1.0) / 1000.0);
+    }
+}
+
+int bmi270_stats_dump_periodic(struct bmi270_stats *stats, FILE *out, const char *label, uint64_t interval)
+{
+    uint64_t now = bmi270_stats_now();
+
+    if (now - stats->last_dump < interval)
+        return 0;
+
+    stats->last_dump = now;
+    bmi270_stats_dump(stats, out, label);
+
+    return 1;
+}
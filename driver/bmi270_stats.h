@@ -0,0 +1,94 @@
+#pragma once
+
+#ifndef BMI270_STATS_H
+#define BMI270_STATS_H
+
+#include <stdatomic.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "bmi270_defs.h"
+
+/* ----------------------------------------------------
+                    DEFINITIONS
+-----------------------------------------------------*/
+
+// Operation Types
+#define STATS_OP_READ       UINT8_C(0)         // read_register
+#define STATS_OP_READ_BLK   UINT8_C(1)         // read_register_block
+#define STATS_OP_WRITE      UINT8_C(2)         // write_register
+#define STATS_OP_WRITE_BLK  UINT8_C(3)         // write_register_block
+#define STATS_NUM_OPS       4
+
+// Latency Histogram: bucket i counts latencies in [2^i, 2^(i+1)) ns
+#define STATS_NUM_BUCKETS   32
+
+struct bmi270_stats
+{
+    /* Transactions per operation type */
+    atomic_uint_fast64_t transactions[STATS_NUM_OPS];
+
+    /* Payload bytes per operation type */
+    atomic_uint_fast64_t bytes[STATS_NUM_OPS];
+
+    /* Failed transactions per operation type */
+    atomic_uint_fast64_t errors[STATS_NUM_OPS];
+
+    /* Retried transactions */
+    atomic_uint_fast64_t retries;
+
+    /* Acquisition loop iterations */
+    atomic_uint_fast64_t loops;
+
+    /* Acquisition loop iterations exceeding their time budget */
+    atomic_uint_fast64_t loop_overruns;
+
+    /* Sum of latencies per operation type (ns) */
+    atomic_uint_fast64_t latency_sum[STATS_NUM_OPS];
+
+    /* Latency histogram per operation type */
+    atomic_uint_fast64_t latency[STATS_NUM_OPS][STATS_NUM_BUCKETS];
+
+    /* Time of the last periodic dump (ns) */
+    uint64_t last_dump;
+};
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+/* Monotonic time in ns */
+static inline uint64_t bmi270_stats_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/* Reset all counters */
+void bmi270_stats_reset(struct bmi270_stats *stats);
+
+/* Reset stats and attach them to sensor (NULL detaches, instrumentation off) */
+void bmi270_stats_attach(struct bmi270 *sensor, struct bmi270_stats *stats);
+
+/* Record one bus transaction */
+void bmi270_stats_record(struct bmi270_stats *stats, uint8_t op, uint32_t bytes, uint64_t latency, int error);
+
+/* Record one retried transaction */
+void bmi270_stats_retry(struct bmi270_stats *stats);
+
+/* Record one acquisition loop iteration, counts an overrun if elapsed > budget (ns) */
+void bmi270_stats_loop(struct bmi270_stats *stats, uint64_t elapsed, uint64_t budget);
+
+/* Latency percentile (0.0 - 1.0) of operation type in ns (upper bucket bound) */
+uint64_t bmi270_stats_percentile(const struct bmi270_stats *stats, uint8_t op, double p);
+
+/* Print counters and latency percentiles */
+void bmi270_stats_dump(const struct bmi270_stats *stats, FILE *out, const char *label);
+
+/* Print counters every interval ns - returns 1 if dumped */
+int bmi270_stats_dump_periodic(struct bmi270_stats *stats, FILE *out, const char *label, uint64_t interval);
+
+#endif // BMI270_STATS_H
@@ -0,0 +1,131 @@
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+
+#include "bmi270_strapdown.h"
+
+/* ----------------------------------------------------
+                  HELPER FUNCTIONS
+-----------------------------------------------------*/
+
+/* out += scale * (a x b) */
+static void add_cross(double *out, double scale, const double *a, const double *b)
+{
+    out[0] += scale * (a[1] * b[2] - a[2] * b[1]);
+    out[1] += scale * (a[2] * b[0] - a[0] * b[2]);
+    out[2] += scale * (a[0] * b[1] - a[1] * b[0]);
+}
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+int bmi270_strapdown_init(struct bmi270_strapdown *sd, struct bmi270 *sensor, double output_rate)
+{
+    if (sensor->gyr_odr <= 0.0 || output_rate <= 0.0 || output_rate > sensor->gyr_odr)
+    {
+        bmi270_log(BMI270_LOG_ERROR, "0x%X --> Strapdown output rate must be above 0 and at most the GYR ODR (%.0f Hz)", sensor->i2c_addr, sensor->gyr_odr);
+        return -EINVAL;
+    }
+
+    memset(sd, 0, sizeof(*sd));
+    sd->sensor = sensor;
+    sd->dt = 1.0 / sensor->gyr_odr;
+    sd->samples_per_output = (uint16_t)lround(sensor->gyr_odr / output_rate);
+
+    return 0;
+}
+
+void bmi270_strapdown_reset(struct bmi270_strapdown *sd)
+{
+    memset(sd->alpha, 0, sizeof(sd->alpha));
+    memset(sd->beta, 0, sizeof(sd->beta));
+    memset(sd->upsilon, 0, sizeof(sd->upsilon));
+    memset(sd->sculling, 0, sizeof(sd->sculling));
+    memset(sd->last_dtheta, 0, sizeof(sd->last_dtheta));
+    memset(sd->last_dv, 0, sizeof(sd->last_dv));
+    sd->count = 0;
+    sd->flags = 0;
+}
+
+int bmi270_strapdown_update(struct bmi270_strapdown *sd, const double *gyr, const double *acc, uint16_t flags, uint64_t timestamp_us, struct bmi270_strapdown_output *out)
+{
+    double dtheta[3], dv[3], alpha[3], upsilon[3];
+
+    // No linear fit across lost samples
+    if (flags & SAMPLE_GAP)
+    {
+        memset(sd->last_dtheta, 0, sizeof(sd->last_dtheta));
+        memset(sd->last_dv, 0, sizeof(sd->last_dv));
+        sd->flags |= STRAPDOWN_GAP;
+    }
+
+    for (int i = 0; i < 3; i++)
+    {
+        dtheta[i] = gyr[i] * sd->dt;
+        dv[i] = acc[i] * sd->dt;
+
+        // alpha_k-1 + dtheta_k-1 / 6 and upsilon_k-1 + dv_k-1 / 6
+        alpha[i] = sd->alpha[i] + sd->last_dtheta[i] / 6.0;
+        upsilon[i] = sd->upsilon[i] + sd->last_dv[i] / 6.0;
+    }
+
+    add_cross(sd->beta, 0.5, alpha, dtheta);
+    add_cross(sd->sculling, 0.5, alpha, dv);
+    add_cross(sd->sculling, 0.5, upsilon, dtheta);
+
+    for (int i = 0; i < 3; i++)
+    {
+        sd->alpha[i] += dtheta[i];
+        sd->upsilon[i] += dv[i];
+        sd->last_dtheta[i] = dtheta[i];
+        sd->last_dv[i] = dv[i];
+    }
+
+    if (++sd->count < sd->samples_per_output)
+        return 0;
+
+    out->timestamp_us = timestamp_us;
+    out->dt = sd->count * sd->dt;
+    out->count = sd->count;
+    out->flags = sd->flags;
+
+    for (int i = 0; i < 3; i++)
+    {
+        out->delta_angle[i] = sd->alpha[i] + sd->beta[i];
+        out->delta_velocity[i] = sd->upsilon[i] + sd->sculling[i];
+    }
+
+    // Rotation compensation: the velocity increments were sensed in a turning frame
+    add_cross(out->delta_velocity, 0.5, sd->alpha, sd->upsilon);
+
+    // The rate fit carries over into the next interval, the sums do not
+    memset(sd->alpha, 0, sizeof(sd->alpha));
+    memset(sd->beta, 0, sizeof(sd->beta));
+    memset(sd->upsilon, 0, sizeof(sd->upsilon));
+    memset(sd->sculling, 0, sizeof(sd->sculling));
+    sd->count = 0;
+    sd->flags = 0;
+    sd->outputs++;
+
+    return 1;
+}
+
+int bmi270_strapdown_update_sample(struct bmi270_strapdown *sd, const struct bmi270_sample *sample, struct bmi270_strapdown_output *out)
+{
+    double gyr[3], acc[3];
+
+    // A failed read is a lost sample: the next valid one starts a new rate fit
+    if (!(sample->flags & SAMPLE_VALID))
+    {
+        memset(sd->last_dtheta, 0, sizeof(sd->last_dtheta));
+        memset(sd->last_dv, 0, sizeof(sd->last_dv));
+        sd->flags |= STRAPDOWN_GAP;
+        return 0;
+    }
+
+    convert_gyr_raw(sd->sensor, sample->gyr, gyr);
+    convert_acc_raw(sd->sensor, sample->acc, acc);
+
+    return bmi270_strapdown_update(sd, gyr, acc, sample->flags, sample->timestamp_us, out);
+}
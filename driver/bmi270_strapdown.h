@@ -0,0 +1,95 @@
+#pragma once
+
+#ifndef BMI270_STRAPDOWN_H
+#define BMI270_STRAPDOWN_H
+
+#include "bmi270.h"
+
+/* ----------------------------------------------------
+                    DEFINITIONS
+-----------------------------------------------------*/
+
+/*
+ * Strapdown pre-integration: angular rate and acceleration are integrated at
+ * the gyro ODR, delta-angle and delta-velocity are emitted once per output
+ * interval. Within the interval (Savage, "Strapdown Inertial Navigation
+ * Integration Algorithm Design"):
+ *
+ *     alpha    = sum dtheta_k                                  (angle increments)
+ *     beta    += 1/2 (alpha_k-1 + dtheta_k-1 / 6) x dtheta_k   (coning)
+ *     upsilon  = sum dv_k                                      (velocity increments)
+ *     scul    += 1/2 ((alpha_k-1 + dtheta_k-1 / 6) x dv_k
+ *                   + (upsilon_k-1 + dv_k-1 / 6) x dtheta_k)   (sculling)
+ *
+ *     delta_angle    = alpha + beta
+ *     delta_velocity = upsilon + 1/2 alpha x upsilon + scul    (body frame at interval start)
+ *
+ * The dtheta_k-1 / 6 terms fit a linear rate across two samples, so samples
+ * lost in between (SAMPLE_GAP) restart that fit and flag the output.
+ */
+
+#define STRAPDOWN_GAP       SAMPLE_GAP         // Output flag: samples were lost inside the interval
+
+struct bmi270_strapdown_output
+{
+    /* Host timestamp of the last integrated sample (us) */
+    uint64_t timestamp_us;
+
+    /* Rotation vector over the interval (rad) */
+    double delta_angle[3];
+
+    /* Velocity change over the interval, in the body frame at its start (m/s, gravity included) */
+    double delta_velocity[3];
+
+    /* Interval length (s) and integrated samples */
+    double dt;
+    uint16_t count;
+
+    /* STRAPDOWN_* flags */
+    uint16_t flags;
+};
+
+struct bmi270_strapdown
+{
+    /* Sensor (scales of the raw data, ODR) */
+    struct bmi270 *sensor;
+
+    /* Sample period (s) and samples per output */
+    double dt;
+    uint16_t samples_per_output;
+
+    /* Interval accumulators */
+    double alpha[3];
+    double beta[3];
+    double upsilon[3];
+    double sculling[3];
+
+    /* Increments of the previous sample, zero at a gap */
+    double last_dtheta[3];
+    double last_dv[3];
+
+    /* Samples and flags of the current interval */
+    uint16_t count;
+    uint16_t flags;
+
+    /* Emitted outputs */
+    uint64_t outputs;
+};
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+/* Integrate at the sensor's gyro ODR, emitting output_rate Hz (rounded to whole samples per output) */
+int bmi270_strapdown_init(struct bmi270_strapdown *sd, struct bmi270 *sensor, double output_rate);
+
+/* Start a new interval, e.g. after the sensor was reconfigured */
+void bmi270_strapdown_reset(struct bmi270_strapdown *sd);
+
+/* Integrate one sample of get_gyr (rad/s) and get_acc (m/s^2) - returns 1 if out was filled */
+int bmi270_strapdown_update(struct bmi270_strapdown *sd, const double *gyr, const double *acc, uint16_t flags, uint64_t timestamp_us, struct bmi270_strapdown_output *out);
+
+/* Integrate one raw sample (FIFO reader or manager) - returns 1 if out was filled */
+int bmi270_strapdown_update_sample(struct bmi270_strapdown *sd, const struct bmi270_sample *sample, struct bmi270_strapdown_output *out);
+
+#endif // BMI270_STRAPDOWN_H
@@ -0,0 +1,174 @@
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "bmi270_trace.h"
+
+atomic_int bmi270_trace_enabled;
+_Thread_local struct bmi270_trace_buffer *bmi270_trace_local;
+
+// Registered buffers, slots are never released
+static struct bmi270_trace_buffer *buffers[TRACE_MAX_THREADS];
+static atomic_int num_buffers;
+
+static const char *point_names[TRACE_NUM_POINTS] = {"ready", "read", "convert", "enqueue", "send"};
+
+/* ----------------------------------------------------
+                  HELPER FUNCTIONS
+-----------------------------------------------------*/
+
+/* Copy the valid part of a ring that its thread may still be writing - returns the number of events */
+static size_t snapshot(struct bmi270_trace_buffer *buffer, struct bmi270_trace_event *events)
+{
+    uint_fast64_t head = atomic_load_explicit(&buffer->head, memory_order_acquire);
+    uint_fast64_t first = head > TRACE_BUFFER_SIZE ? head - TRACE_BUFFER_SIZE : 0;
+    uint_fast64_t valid;
+
+    for (uint_fast64_t i = first; i < head; i++)
+    {
+        events[i - first] = buffer->events[i & (TRACE_BUFFER_SIZE - 1)];
+    }
+
+    // Slots the writer reached meanwhile (and the one it may be writing) are torn
+    atomic_thread_fence(memory_order_acquire);
+    valid = atomic_load_explicit(&buffer->head, memory_order_relaxed) + 1;
+    valid = valid > TRACE_BUFFER_SIZE ? valid - TRACE_BUFFER_SIZE : 0;
+
+    if (valid <= first)
+        return head - first;
+
+    if (valid >= head)
+        return 0;
+
+    memmove(events, events + (valid - first), (head - valid) * sizeof(*events));
+    return head - valid;
+}
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+struct bmi270_trace_buffer *bmi270_trace_register(void)
+{
+    struct bmi270_trace_buffer *buffer;
+    int slot;
+
+    if (atomic_load_explicit(&num_buffers, memory_order_relaxed) >= TRACE_MAX_THREADS)
+        return NULL;
+
+    // Once per thread, off the hot path after the first event
+    if (!(buffer = calloc(1, sizeof(*buffer))))
+        return NULL;
+
+    if ((slot = atomic_fetch_add(&num_buffers, 1)) >= TRACE_MAX_THREADS)
+    {
+        free(buffer);
+        return NULL;
+    }
+
+    buffer->tid = (int)syscall(SYS_gettid);
+    snprintf(buffer->name, sizeof(buffer->name), "thread %d", buffer->tid);
+    atomic_init(&buffer->head, 0);
+
+    __atomic_store_n(&buffers[slot], buffer, __ATOMIC_RELEASE);
+    bmi270_trace_local = buffer;
+
+    return buffer;
+}
+
+void bmi270_trace_enable(int enable)
+{
+    atomic_store(&bmi270_trace_enabled, enable ? 1 : 0);
+}
+
+void bmi270_trace_name(const char *name)
+{
+    struct bmi270_trace_buffer *buffer = bmi270_trace_local;
+
+    if (buffer || (buffer = bmi270_trace_register()))
+        snprintf(buffer->name, sizeof(buffer->name), "%s", name);
+}
+
+void bmi270_trace_clear(void)
+{
+    int count = atomic_load(&num_buffers);
+
+    for (int i = 0; i < count && i < TRACE_MAX_THREADS; i++)
+    {
+        struct bmi270_trace_buffer *buffer = __atomic_load_n(&buffers[i], __ATOMIC_ACQUIRE);
+
+        if (buffer)
+            atomic_store(&buffer->head, 0);
+    }
+}
+
+int bmi270_trace_export(FILE *out)
+{
+    struct bmi270_trace_event *events;
+    int count = atomic_load(&num_buffers), written = 0;
+    int pid = (int)getpid();
+
+    if (!(events = malloc(TRACE_BUFFER_SIZE * sizeof(*events))))
+        return -ENOMEM;
+
+    fprintf(out, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    fprintf(out, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"args\":{\"name\":\"bmi270\"}}", pid);
+
+    for (int i = 0; i < count && i < TRACE_MAX_THREADS; i++)
+    {
+        struct bmi270_trace_buffer *buffer = __atomic_load_n(&buffers[i], __ATOMIC_ACQUIRE);
+        size_t num_events;
+        int depth = 0;
+
+        // Registered but not published yet
+        if (!buffer)
+            continue;
+
+        num_events = snapshot(buffer, events);
+
+        fprintf(out, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":\"%s\"}}", pid, buffer->tid, buffer->name);
+
+        for (size_t k = 0; k < num_events; k++)
+        {
+            const struct bmi270_trace_event *event = &events[k];
+
+            // Spans whose begin was overwritten would confuse the viewers
+            if (event->phase == TRACE_END && depth == 0)
+                continue;
+
+            depth += event->phase == TRACE_BEGIN ? 1 : event->phase == TRACE_END ? -1 : 0;
+
+            fprintf(out, ",\n{\"name\":\"%s\",\"cat\":\"bmi270\",\"ph\":\"%c\",%s\"ts\":%llu.%03u,\"pid\":%d,\"tid\":%d,\"args\":{\"arg\":%u}}",
+                    event->point < TRACE_NUM_POINTS ? point_names[event->point] : "unknown", event->phase,
+                    event->phase == TRACE_INSTANT ? "\"s\":\"t\"," : "",
+                    (unsigned long long)(event->ts_ns / 1000), (unsigned)(event->ts_ns % 1000), pid, buffer->tid, event->arg);
+
+            written++;
+        }
+    }
+
+    fprintf(out, "\n]}\n");
+    free(events);
+
+    return written;
+}
+
+int bmi270_trace_export_file(const char *path)
+{
+    FILE *out = fopen(path, "w");
+    int result;
+
+    if (!out)
+        return -errno;
+
+    result = bmi270_trace_export(out);
+
+    if (fclose(out) != 0 && result >= 0)
+        result = -errno;
+
+    return result;
+}
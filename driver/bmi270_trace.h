@@ -0,0 +1,155 @@
+#pragma once
+
+#ifndef BMI270_TRACE_H
+#define BMI270_TRACE_H
+
+#include <stdatomic.h>
+#include <stdio.h>
+
+#include "bmi270_defs.h"
+#include "bmi270_stats.h"
+
+#ifdef BMI270_TRACE_USDT
+#include <sys/sdt.h>
+#endif
+
+/* ----------------------------------------------------
+                    DEFINITIONS
+-----------------------------------------------------*/
+
+/*
+ * Pipeline tracing: every thread records into its own ring of events, written
+ * only by that thread (no locks, no atomics beyond publishing the head), and
+ * the rings are exported as Chrome trace JSON, which Perfetto and
+ * chrome://tracing open directly. A disabled tracepoint costs one relaxed load.
+ *
+ * Built with -DBMI270_TRACE_USDT (make USDT=1) every tracepoint is also a USDT
+ * probe bmi270:trace(point, phase, arg, ts_ns) for perf, bpftrace or SystemTap,
+ * independent of bmi270_trace_enable.
+ */
+
+// Tracepoints
+#define TRACE_READY         UINT8_C(0)         // Data ready: interrupt edge or ODR tick
+#define TRACE_READ          UINT8_C(1)         // Bus read of a sample or FIFO batch
+#define TRACE_CONVERT       UINT8_C(2)         // Raw data to samples / packets
+#define TRACE_ENQUEUE       UINT8_C(3)         // Hand-off to a queue or send buffer
+#define TRACE_SEND          UINT8_C(4)         // Network send
+#define TRACE_NUM_POINTS    5
+
+// Phases (Chrome trace "ph")
+#define TRACE_BEGIN         UINT8_C('B')
+#define TRACE_END           UINT8_C('E')
+#define TRACE_INSTANT       UINT8_C('i')
+
+#define TRACE_BUFFER_SIZE   8192               // Events per thread (power of two), the oldest are overwritten
+#define TRACE_MAX_THREADS   32
+#define TRACE_NAME_LEN      16
+
+struct bmi270_trace_event
+{
+    /* CLOCK_MONOTONIC (ns) */
+    uint64_t ts_ns;
+
+    /* Tracepoint argument: device, source or byte count */
+    uint32_t arg;
+
+    /* TRACE_* point and phase */
+    uint8_t point;
+    uint8_t phase;
+};
+
+struct bmi270_trace_buffer
+{
+    /* Thread id and name shown in the trace */
+    int tid;
+    char name[TRACE_NAME_LEN];
+
+    /* Events recorded so far, the ring keeps the last TRACE_BUFFER_SIZE */
+    atomic_uint_fast64_t head;
+
+    /* Ring */
+    struct bmi270_trace_event events[TRACE_BUFFER_SIZE];
+};
+
+/* Set by bmi270_trace_enable */
+extern atomic_int bmi270_trace_enabled;
+
+/* Buffer of the calling thread, NULL until its first event */
+extern _Thread_local struct bmi270_trace_buffer *bmi270_trace_local;
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+/* Register a buffer for the calling thread - NULL if TRACE_MAX_THREADS are taken or out of memory */
+struct bmi270_trace_buffer *bmi270_trace_register(void);
+
+/* Record one event with its own timestamp (e.g. a GPIO edge from the kernel) */
+static inline void bmi270_trace_at(uint8_t point, uint8_t phase, uint32_t arg, uint64_t ts_ns)
+{
+    struct bmi270_trace_buffer *buffer;
+    uint_fast64_t head;
+
+#ifdef BMI270_TRACE_USDT
+    DTRACE_PROBE4(bmi270, trace, point, phase, arg, ts_ns);
+#endif
+
+    if (!atomic_load_explicit(&bmi270_trace_enabled, memory_order_relaxed))
+        return;
+
+    if (!(buffer = bmi270_trace_local) && !(buffer = bmi270_trace_register()))
+        return;
+
+    // Single writer: fill the slot, then publish it
+    head = atomic_load_explicit(&buffer->head, memory_order_relaxed);
+    buffer->events[head & (TRACE_BUFFER_SIZE - 1)] = (struct bmi270_trace_event){ts_ns, arg, point, phase};
+    atomic_store_explicit(&buffer->head, head + 1, memory_order_release);
+}
+
+/* Events are recorded or probed: the clock is only read then */
+static inline int bmi270_trace_active(void)
+{
+#ifdef BMI270_TRACE_USDT
+    return 1;
+#else
+    return atomic_load_explicit(&bmi270_trace_enabled, memory_order_relaxed);
+#endif
+}
+
+/* Start of a span */
+static inline void bmi270_trace_begin(uint8_t point, uint32_t arg)
+{
+    if (bmi270_trace_active())
+        bmi270_trace_at(point, TRACE_BEGIN, arg, bmi270_stats_now());
+}
+
+/* End of the innermost span */
+static inline void bmi270_trace_end(uint8_t point, uint32_t arg)
+{
+    if (bmi270_trace_active())
+        bmi270_trace_at(point, TRACE_END, arg, bmi270_stats_now());
+}
+
+/* Instant event */
+static inline void bmi270_trace_instant(uint8_t point, uint32_t arg)
+{
+    if (bmi270_trace_active())
+        bmi270_trace_at(point, TRACE_INSTANT, arg, bmi270_stats_now());
+}
+
+/* Start or stop recording (all threads) */
+void bmi270_trace_enable(int enable);
+
+/* Name the calling thread in the trace */
+void bmi270_trace_name(const char *name);
+
+/* Drop all recorded events - only while recording is stopped */
+void bmi270_trace_clear(void);
+
+/* Write all buffers as Chrome trace JSON - returns the number of events written */
+int bmi270_trace_export(FILE *out);
+
+/* Write all buffers as Chrome trace JSON into a file - returns the number of events written or a negative errno */
+int bmi270_trace_export_file(const char *path);
+
+#endif // BMI270_TRACE_H
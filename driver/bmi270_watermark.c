@@ -0,0 +1,186 @@
+#include <errno.h>
+
+#include "bmi270_watermark.h"
+
+/* ----------------------------------------------------
+                  HELPER FUNCTIONS
+-----------------------------------------------------*/
+
+/* Fastest enabled ODR (Hz), 0 if no sensor is running */
+static double fifo_odr(const struct bmi270 *sensor)
+{
+    return sensor->acc_odr > sensor->gyr_odr ? sensor->acc_odr : sensor->gyr_odr;
+}
+
+static uint8_t fwm_int_bit(uint8_t int_pin)
+{
+    return int_pin == INT1 ? FWM_INT : FWM_INT << 4;
+}
+
+static int program(struct bmi270_watermark *wm, uint16_t frames)
+{
+    int result;
+
+    if ((result = set_fifo_watermark(wm->sensor, frames * wm->config.frame_size)) < 0)
+        return result;
+
+    wm->frames = frames;
+    return 0;
+}
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+void bmi270_watermark_defaults(struct bmi270_watermark_config *config)
+{
+    config->latency_budget_us = WTM_DEFAULT_BUDGET;
+    config->frame_size = WTM_FRAME_ACC_GYR;
+    config->min_frames = 1;
+    config->max_frames = 0;
+    config->int_pin = INT1;
+}
+
+int bmi270_watermark_init(struct bmi270_watermark *wm, struct bmi270 *sensor, const struct bmi270_watermark_config *config)
+{
+    int result;
+
+    wm->sensor = sensor;
+    wm->config = *config;
+    wm->frames = 0;
+    wm->service_us = 0;
+    wm->service_dev_us = 0;
+    wm->latency_us = 0;
+    wm->wakeups = 0;
+    wm->total_frames = 0;
+    wm->violations = 0;
+    wm->reprograms = 0;
+
+    if (config->frame_size == 0 || config->min_frames == 0 || (uint32_t)config->min_frames * config->frame_size > FIFO_SIZE ||
+        (config->max_frames && config->max_frames < config->min_frames) ||
+        (config->int_pin && config->int_pin != INT1 && config->int_pin != INT2))
+    {
+        bmi270_log(BMI270_LOG_ERROR, "0x%X --> Invalid watermark configuration", sensor->i2c_addr);
+        return -EINVAL;
+    }
+
+    // Start at the lowest latency, the watermark grows once service times are known
+    if ((result = program(wm, config->min_frames)) < 0)
+        return result;
+
+    // Keep other data interrupts mapped to the pin
+    if (config->int_pin && (result = update_register(sensor, INT_MAP_DATA, 0, fwm_int_bit(config->int_pin))) < 0)
+        return result;
+
+    bmi270_log(BMI270_LOG_INFO, "0x%X --> Adaptive FIFO watermark started (budget %u us, %d frames)", sensor->i2c_addr, config->latency_budget_us, wm->frames);
+    return 0;
+}
+
+uint16_t bmi270_watermark_target(const struct bmi270_watermark *wm)
+{
+    const struct bmi270_watermark_config *config = &wm->config;
+    double odr = fifo_odr(wm->sensor);
+    uint64_t margin_us = wm->service_us + 4 * (uint64_t)wm->service_dev_us;
+    uint64_t target, limit, service_frames;
+
+    if (odr <= 0.0)
+        return wm->frames;
+
+    if (margin_us >= config->latency_budget_us)
+        return config->min_frames;
+
+    // Frames produced while filling up to the watermark and while servicing it must fit the budget...
+    target = (uint64_t)((config->latency_budget_us - margin_us) * odr / 1e6);
+
+    // ... and the FIFO, which keeps filling until the read is done
+    service_frames = (uint64_t)(margin_us * odr / 1e6) + 1;
+    limit = FIFO_SIZE / config->frame_size;
+    limit = limit > service_frames ? limit - service_frames : 0;
+
+    if (config->max_frames && limit > config->max_frames)
+        limit = config->max_frames;
+
+    if (target > limit)
+        target = limit;
+
+    return target < config->min_frames ? config->min_frames : (uint16_t)target;
+}
+
+int bmi270_watermark_update(struct bmi270_watermark *wm, uint32_t bytes, uint32_t service_us)
+{
+    uint32_t frames = bytes / wm->config.frame_size;
+    double odr = fifo_odr(wm->sensor);
+    uint16_t target, step;
+    int result;
+
+    wm->wakeups++;
+    wm->total_frames += frames;
+
+    // The oldest sample of the batch was produced frames / ODR before the read completed
+    if (odr > 0.0)
+    {
+        wm->latency_us = (uint32_t)(frames * 1e6 / odr);
+
+        if (wm->latency_us > wm->config.latency_budget_us)
+            wm->violations++;
+    }
+
+    // Smoothed service time (gain 1/8) and mean deviation (gain 1/4)
+    if (wm->wakeups == 1)
+    {
+        wm->service_us = service_us;
+        wm->service_dev_us = service_us / 2;
+    }
+    else
+    {
+        int64_t error = (int64_t)service_us - wm->service_us;
+
+        wm->service_us = (uint32_t)((int64_t)wm->service_us + error / 8);
+        wm->service_dev_us = (uint32_t)((int64_t)wm->service_dev_us + ((error < 0 ? -error : error) - (int64_t)wm->service_dev_us) / 4);
+    }
+
+    target = bmi270_watermark_target(wm);
+
+    // Shrink at once, grow gradually and only past the hysteresis band
+    if (target > wm->frames)
+    {
+        if (target - wm->frames < (wm->frames / 8 > 1 ? wm->frames / 8 : 1))
+            return 0;
+
+        step = wm->frames / 4 > 1 ? wm->frames / 4 : 1;
+
+        if (target - wm->frames > step)
+            target = wm->frames + step;
+    }
+    else if (target == wm->frames)
+    {
+        return 0;
+    }
+
+    if ((result = program(wm, target)) < 0)
+        return result;
+
+    wm->reprograms++;
+    return 1;
+}
+
+double bmi270_watermark_batching(const struct bmi270_watermark *wm)
+{
+    return wm->wakeups ? (double)wm->total_frames / (double)wm->wakeups : 0.0;
+}
+
+int bmi270_watermark_stop(struct bmi270_watermark *wm)
+{
+    int result;
+
+    if (wm->config.int_pin && (result = update_register(wm->sensor, INT_MAP_DATA, fwm_int_bit(wm->config.int_pin), 0)) < 0)
+        return result;
+
+    if ((result = set_fifo_watermark(wm->sensor, 0)) < 0)
+        return result;
+
+    wm->frames = 0;
+
+    bmi270_log(BMI270_LOG_INFO, "0x%X --> Adaptive FIFO watermark stopped (%.1f frames per wakeup)", wm->sensor->i2c_addr, bmi270_watermark_batching(wm));
+    return 0;
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#ifndef BMI270_WATERMARK_H
+#define BMI270_WATERMARK_H
+
+#include "bmi270.h"
+
+/* ----------------------------------------------------
+                    DEFINITIONS
+-----------------------------------------------------*/
+
+/*
+ * Adaptive FIFO watermark: the sensor raises FWM_INT once the watermark is
+ * reached, so every wakeup reads one batch. The oldest sample of a batch is
+ * batch / ODR old when the read completes, which is the fill time up to the
+ * watermark plus the service time (interrupt to read done). The controller
+ * tracks the service time like TCP tracks round trips (smoothed mean plus four
+ * times the mean deviation) and programs the largest watermark that keeps the
+ * batch inside the latency budget: fewer wakeups and longer FIFO bursts.
+ *
+ * The watermark drops at once when the budget is at risk and grows by at most
+ * a quarter per wakeup, and only by more than an eighth, so it settles without
+ * a register write on every wakeup.
+ */
+
+#define WTM_DEFAULT_BUDGET  20000              // Latency budget (us)
+#define WTM_FRAME_ACC_GYR   13                 // Header + acc + gyr frame (bytes)
+
+struct bmi270_watermark_config
+{
+    /* Maximum age of the oldest sample when its batch has been read (us) */
+    uint32_t latency_budget_us;
+
+    /* FIFO frame size (bytes): WTM_FRAME_ACC_GYR in header mode with acc and gyr */
+    uint8_t frame_size;
+
+    /* Watermark limits (frames), max_frames = 0: limited by the FIFO size only */
+    uint16_t min_frames;
+    uint16_t max_frames;
+
+    /* FWM_INT is mapped to this pin (INT1, INT2), 0 = polled by the caller */
+    uint8_t int_pin;
+};
+
+struct bmi270_watermark
+{
+    /* Controlled sensor */
+    struct bmi270 *sensor;
+
+    /* Configuration */
+    struct bmi270_watermark_config config;
+
+    /* Programmed watermark (frames) */
+    uint16_t frames;
+
+    /* Smoothed service time and its mean deviation (us), 0 until the first wakeup */
+    uint32_t service_us;
+    uint32_t service_dev_us;
+
+    /* Age of the oldest sample of the last batch (us) */
+    uint32_t latency_us;
+
+    /* Wakeups and frames read */
+    uint64_t wakeups;
+    uint64_t total_frames;
+
+    /* Batches older than the latency budget */
+    uint32_t violations;
+
+    /* Watermark register writes after init */
+    uint32_t reprograms;
+};
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+/* Fill config with defaults: 20 ms budget, acc + gyr frames with header, FWM_INT on INT1 */
+void bmi270_watermark_defaults(struct bmi270_watermark_config *config);
+
+/* Program the minimum watermark and map FWM_INT, the ODR is taken from the sensor (set it first) */
+int bmi270_watermark_init(struct bmi270_watermark *wm, struct bmi270 *sensor, const struct bmi270_watermark_config *config);
+
+/* Account one wakeup that read bytes in service_us - returns 1 if the watermark was reprogrammed, 0 if not, or a negative errno */
+int bmi270_watermark_update(struct bmi270_watermark *wm, uint32_t bytes, uint32_t service_us);
+
+/* Watermark the controller aims for with the current service time estimate (frames) */
+uint16_t bmi270_watermark_target(const struct bmi270_watermark *wm);
+
+/* Achieved batching factor: frames per wakeup */
+double bmi270_watermark_batching(const struct bmi270_watermark *wm);
+
+/* Unmap FWM_INT and clear the watermark */
+int bmi270_watermark_stop(struct bmi270_watermark *wm);
+
+#endif // BMI270_WATERMARK_H
@@ -0,0 +1,52 @@
+#include <cstdio>
+#include <unistd.h>
+#include <vector>
+
+#include "bmi270.hpp"
+
+#define BATCH_SIZE 64                   // Samples per FIFO read
+
+/* ----------------------------------------------------
+                        MAIN
+-----------------------------------------------------*/
+
+int main()
+{
+    try
+    {
+        bmi::Bmi270 sensor(I2C_PRIM_ADDR);
+
+        sensor.set_mode(PERFORMANCE_MODE);
+        sensor.set_acc_range(ACC_RANGE_2G);
+        sensor.set_gyr_range(GYR_RANGE_1000);
+        sensor.set_acc_odr(ACC_ODR_200);
+        sensor.set_gyr_odr(GYR_ODR_200);
+        bmi::check(enable_fifo_header(sensor.get()));
+        bmi::check(disable_data_streaming(sensor.get()));
+
+        // Buffers are allocated once, reads only fill them
+        std::vector<uint8_t> fifo(FIFO_SIZE);
+        std::vector<bmi::Sample<float>> samples(BATCH_SIZE);
+
+        while (true)
+        {
+            size_t count = sensor.read<float>(samples, fifo);
+
+            for (size_t i = 0; i < count; i++)
+            {
+                const bmi::Sample<float> &s = samples[i];
+                std::printf("%8.3f %8.3f %8.3f | %8.3f %8.3f %8.3f\n", s.acc[0], s.acc[1], s.acc[2], s.gyr[0], s.gyr[1], s.gyr[2]);
+            }
+
+            usleep(50000);
+        }
+    }
+    catch (const std::system_error &e)
+    {
+        // The bus was closed by the handle
+        std::printf("ERROR: %s\n", e.what());
+        return 1;
+    }
+
+    return 0;
+}
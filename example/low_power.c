@@ -0,0 +1,116 @@
+#include <signal.h>
+#include <stdio.h>
+
+#include "bmi270.h"
+#include "bmi270_fifo.h"
+#include "bmi270_loop.h"
+#include "bmi270_power.h"
+
+#define BATTERY_MAH 220.0               // CR2032, for the battery life estimate
+#define MAX_SAMPLES (FIFO_SIZE / POWER_FRAME_ACC)
+
+static struct bmi270_loop loop;
+static struct bmi270_fifo fifo;
+static struct bmi270_sample samples[MAX_SAMPLES];
+
+/* ----------------------------------------------------
+                    EVENT HANDLERS
+-----------------------------------------------------*/
+
+void stop(int signal)
+{
+    (void)signal;
+    bmi270_loop_stop(&loop);
+}
+
+// One burst read per batch, the host sleeps in between
+void on_batch(struct bmi270_loop *loop, int source, uint64_t expirations, void *ctx)
+{
+    struct bmi270 *sensor = ctx;
+    double acc[3], mean[3] = {0.0, 0.0, 0.0};
+    int count, gap = 0;
+
+    (void)loop;
+    (void)source;
+    (void)expirations;
+
+    if ((count = bmi270_fifo_read(&fifo, samples, MAX_SAMPLES, 0)) <= 0)
+        return;
+
+    for (int i = 0; i < count; i++)
+    {
+        convert_acc_raw(sensor, samples[i].acc, acc);
+
+        for (int axis = 0; axis < 3; axis++)
+            mean[axis] += acc[axis] / count;
+
+        gap |= (samples[i].flags & SAMPLE_GAP) != 0;
+    }
+
+    printf("%d samples%s, mean acc: %.3f %.3f %.3f m/s^2\n", count, gap ? " (gap)" : "", mean[0], mean[1], mean[2]);
+    fflush(stdout);
+}
+
+/* ----------------------------------------------------
+                        MAIN
+-----------------------------------------------------*/
+
+int main()
+{
+    struct bmi270 sensor = {.i2c_addr = I2C_PRIM_ADDR};
+    struct bmi270_power_config config;
+    struct bmi270_power_estimate estimate;
+
+    bmi270_set_log_handler(bmi270_log_print, BMI270_LOG_WARN, stderr);
+
+    if (bmi270_init(&sensor) < 0)
+    {
+        fprintf(stderr, "Failed to initialize the sensor. You might want to do a power cycle.\n");
+        return 1;
+    }
+
+    // -------------------------------------------------
+    // HARDWARE CONFIGURATION
+    // -------------------------------------------------
+
+    set_acc_range(&sensor, ACC_RANGE_2G);
+    disable_data_streaming(&sensor);
+
+    // 12.5 Hz, 8 samples averaged, one read every 20 s
+    bmi270_power_defaults(&config);
+    config.acc_odr = ACC_ODR_12_5;
+    config.averaging = ACC_BWP_AVG8;
+    config.batch_us = 20000000;
+
+    if (bmi270_power_apply(&sensor, &config) < 0 || bmi270_fifo_init(&fifo, &sensor, 0) < 0 ||
+        bmi270_power_estimate(&sensor, &estimate) < 0)
+    {
+        fprintf(stderr, "ERROR: Low power setup failed!\n");
+        return 1;
+    }
+
+    printf("Estimated current: %.1f uA (accelerometer %.1f uA at %.1f %% duty, base %.1f uA), %.0f days on %.0f mAh\n",
+           estimate.total_ua, estimate.acc_ua, estimate.acc_duty * 100.0, estimate.base_ua,
+           BATTERY_MAH * 1000.0 / estimate.total_ua / 24.0, BATTERY_MAH);
+
+    // -------------------------------------------------
+    // EVENT LOOP
+    // -------------------------------------------------
+
+    signal(SIGINT, stop);
+    signal(SIGTERM, stop);
+
+    if (bmi270_loop_init(&loop) < 0 || bmi270_loop_add_timer(&loop, (uint64_t)config.batch_us * 1000, on_batch, &sensor) < 0)
+    {
+        fprintf(stderr, "ERROR: Event loop setup failed!\n");
+        return 1;
+    }
+
+    bmi270_loop_run(&loop);
+    bmi270_loop_close(&loop);
+    bmi270_close(&sensor);
+
+    fprintf(stderr, "%llu gaps, %llu samples lost\n", (unsigned long long)fifo.gaps, (unsigned long long)fifo.lost);
+
+    return 0;
+}
@@ -1,19 +1,67 @@
-#define _POSIX_C_SOURCE 199309L
+#define _GNU_SOURCE
 
 #include <arpa/inet.h>
-#include <math.h>
+#include <errno.h>
 #include <netinet/in.h>
+#include <signal.h>
 #include <stdio.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/signalfd.h>
 #include <sys/socket.h>
 #include <unistd.h>
 #include <time.h>
 
 #include "bmi270.h"
-#include "bmi270_config_file.h"
+#include "bmi270_codec.h"
+#include "bmi270_loop.h"
+#include "bmi270_metrics.h"
+#include "bmi270_recovery.h"
+#include "bmi270_settings.h"
+#include "bmi270_stats.h"
+#include "bmi270_trace.h"
+
+#define NUM_CHANNELS 7                  // int values sent per sensor: time, acc x/y/z, gyr x/y/z
+#define SINK_BUFFER_SIZE 4096           // Bytes buffered while the network is busy
+#define MAX_OVERRIDES 32                // -o key=value options
+
+struct device
+{
+    struct bmi270 sensor;
+    struct bmi270_recovery recovery;
+    struct bmi270_stats stats;
+    struct bmi270_metrics_device *metrics;
+    struct bmi270_device_settings *settings;
+    struct timespec old_time;
+
+    /* A failed reload left the registers unknown: the next one writes all settings */
+    int dirty;
+};
+
+struct app
+{
+    /* Running settings, the device list is fixed at startup */
+    struct bmi270_settings settings;
+    struct device devices[SETTINGS_MAX_DEVICES];
+
+    /* Settings file (NULL = built-in defaults) and command line overrides, applied again on reload */
+    const char *settings_file;
+    const char *overrides[MAX_OVERRIDES];
+    int num_overrides;
+
+    struct sockaddr_in receiver_address;
+    int sock, sink, timer;
+    int data_streaming;
+};
+
+static struct bmi270_loop loop;
+static struct bmi270_metrics metrics;
 
-#define UPDATE_RATE 200.0               // Hz       (Current Max: ~1000.0 Hz)
-#define UPDATE_TIME (1.0 / UPDATE_RATE) // Seconds
-#define NUM_DATA 14                     // Number of int values to send
+// Samples collected for the next compressed datagram (time deltas saturate at INT16_MAX us)
+static struct bmi270_codec codec;
+static int16_t block[SETTINGS_MAX_BATCH * CODEC_MAX_CHANNELS];
+static uint16_t block_count;
+static uint8_t packet[CODEC_HEADER_SIZE + CODEC_MAX_CHANNELS * (CODEC_CHANNEL_SIZE + 2 * SETTINGS_MAX_BATCH)];
 
 /* ----------------------------------------------------
                     HELPER FUNCTIONS
@@ -29,199 +77,500 @@ int32_t get_microseconds_delta(struct timespec *old_time, struct timespec *timer
     return elapsed_us;
 }
 
+uint64_t get_microseconds(struct timespec *timer)
+{
+    return (uint64_t)timer->tv_sec * 1000000 + (uint64_t)timer->tv_nsec / 1000;
+}
+
+int send_data(struct app *app, const int32_t *data_array, int num_data)
+{
+    if (app->settings.batch == 0)
+        return bmi270_loop_send(&loop, app->sink, data_array, num_data * sizeof(int32_t));
+
+    int16_t *sample = &block[block_count * num_data];
+
+    for (int i = 0; i < num_data; i++)
+    {
+        sample[i] = data_array[i] > INT16_MAX ? INT16_MAX : (int16_t)data_array[i];
+    }
+
+    if (++block_count < app->settings.batch)
+        return 0;
+
+    block_count = 0;
+
+    bmi270_trace_begin(TRACE_CONVERT, app->settings.batch);
+    int len = bmi270_codec_encode(&codec, block, app->settings.batch, num_data, packet, sizeof(packet));
+    bmi270_trace_end(TRACE_CONVERT, app->settings.batch);
+
+    return len < 0 ? len : bmi270_loop_send(&loop, app->sink, packet, len);
+}
+
+int read_sample(struct device *device, int16_t *acc, int16_t *gyr, uint64_t now_us)
+{
+    int result = -1;
+
+    // Recovery does a bounded amount of bus work, the other sensors keep streaming
+    if (bmi270_recovery_step(&device->recovery, now_us) == RECOVERY_OK)
+    {
+        if ((result = get_acc_raw(&device->sensor, &acc[0], &acc[1], &acc[2])) == 0)
+            result = get_gyr_raw(&device->sensor, &gyr[0], &gyr[1], &gyr[2]);
+
+        bmi270_recovery_report(&device->recovery, result, now_us);
+    }
+
+    if (result < 0)
+        bmi270_metrics_read_failure(device->metrics);
+    else
+        bmi270_metrics_sample(device->metrics);
+
+    // Never send stale buffer contents
+    if (result < 0)
+    {
+        acc[0] = acc[1] = acc[2] = 0;
+        gyr[0] = gyr[1] = gyr[2] = 0;
+    }
+
+    return result;
+}
+
+/* Recovery callback: the running settings, which may differ from the startup snapshot */
+int restore_settings(struct bmi270 *sensor, void *ctx)
+{
+    struct device *device = ctx;
+    int result = bmi270_settings_apply(sensor, NULL, device->settings);
+
+    device->dirty = result < 0;
+    return result < 0 ? result : 0;
+}
+
+/* Defaults, settings file, command line - in this order */
+int load_settings(struct app *app, struct bmi270_settings *settings)
+{
+    bmi270_settings_defaults(settings);
+
+    if (app->settings_file && bmi270_settings_load(settings, app->settings_file) < 0)
+        return -EINVAL;
+
+    for (int i = 0; i < app->num_overrides; i++)
+    {
+        if (bmi270_settings_parse(settings, app->overrides[i]) < 0)
+            return -EINVAL;
+    }
+
+    // No devices configured: the two sensors of the original setup
+    if (settings->num_devices == 0)
+    {
+        bmi270_settings_add(settings, "upper")->addr = I2C_PRIM_ADDR;
+        bmi270_settings_add(settings, "lower")->addr = I2C_SEC_ADDR;
+    }
+
+    if (settings->batch > 0 && settings->num_devices * NUM_CHANNELS > CODEC_MAX_CHANNELS)
+    {
+        printf("ERROR: batch needs at most %d sensors!\n", CODEC_MAX_CHANNELS / NUM_CHANNELS);
+        return -EINVAL;
+    }
+
+    return 0;
+}
+
+int set_receiver(struct app *app)
+{
+    app->receiver_address.sin_family = AF_INET;
+    app->receiver_address.sin_addr.s_addr = inet_addr(app->settings.receiver);
+    app->receiver_address.sin_port = htons(app->settings.receiver_port);
+    app->data_streaming = 0;
+
+    // Connected: the event loop sends with send() and buffers while the socket is busy
+    return connect(app->sock, (struct sockaddr *)&app->receiver_address, sizeof(app->receiver_address));
+}
+
 /* ----------------------------------------------------
-                        MAIN
+                    EVENT HANDLERS
 -----------------------------------------------------*/
 
-int main()
+void stop(int signal)
 {
+    (void)signal;
+    bmi270_loop_stop(&loop);
+}
+
+void on_update(struct bmi270_loop *loop, int source, uint64_t expirations, void *ctx)
+{
+    struct app *app = ctx;
+    int num_devices = app->settings.num_devices;
+    int16_t temp_acc[3], temp_gyr[3];
+    int32_t data_array[SETTINGS_MAX_DEVICES * NUM_CHANNELS];
+    struct timespec tic, toc, data_timer;
+
+    (void)source;
+    (void)expirations;
+
+    clock_gettime(CLOCK_MONOTONIC_RAW, &tic);
+
     // -------------------------------------------------
-    // INITIALIZATION
+    // PACKAGE DATA
     // -------------------------------------------------
 
-    struct bmi270 sensor_upper = {.i2c_addr = I2C_PRIM_ADDR};
+    for (int i = 0; i < num_devices; i++)
+    {
+        struct device *device = &app->devices[i];
+        int32_t *data = &data_array[i * NUM_CHANNELS];
 
-    struct bmi270 sensor_lower = {.i2c_addr = I2C_SEC_ADDR};
+        bmi270_metrics_loop(device->metrics, get_microseconds(&tic) * 1000);
 
-    if (bmi270_init(&sensor_upper) == -1)
-        printf("Failed to initialize sensor_upper. You might want to do a power cycle.\n");
+        clock_gettime(CLOCK_MONOTONIC_RAW, &data_timer);
+        data[0] = get_microseconds_delta(&device->old_time, &data_timer);    // Time (-1 = no valid sample)
+        device->old_time = data_timer;
 
-    if (bmi270_init(&sensor_lower) == -1)
-        printf("Failed to initialize sensor_lower. You might want to do a power cycle.\n");
+        bmi270_trace_begin(TRACE_READ, i);
 
-    // -------------------------------------------------
-    // HARDWARE CONFIGURATION
-    // -------------------------------------------------
+        if (read_sample(device, temp_acc, temp_gyr, get_microseconds(&data_timer)) < 0)
+            data[0] = -1;
 
-    set_mode(&sensor_upper, PERFORMANCE_MODE);
-    set_acc_range(&sensor_upper, ACC_RANGE_2G);
-    set_gyr_range(&sensor_upper, GYR_RANGE_1000);
-    set_acc_odr(&sensor_upper, ACC_ODR_200);
-    set_gyr_odr(&sensor_upper, GYR_ODR_200);
-    set_acc_bwp(&sensor_upper, ACC_BWP_OSR4);
-    set_gyr_bwp(&sensor_upper, GYR_BWP_OSR4);
-    disable_fifo_header(&sensor_upper);
-    enable_data_streaming(&sensor_upper);
-    enable_acc_filter_perf(&sensor_upper);
-    enable_gyr_noise_perf(&sensor_upper);
-    enable_gyr_filter_perf(&sensor_upper);
+        bmi270_trace_end(TRACE_READ, i);
+        bmi270_trace_begin(TRACE_CONVERT, i);
 
-    set_mode(&sensor_lower, PERFORMANCE_MODE);
-    set_acc_range(&sensor_lower, ACC_RANGE_2G);
-    set_gyr_range(&sensor_lower, GYR_RANGE_1000);
-    set_acc_odr(&sensor_lower, ACC_ODR_200);
-    set_gyr_odr(&sensor_lower, GYR_ODR_200);
-    set_acc_bwp(&sensor_lower, ACC_BWP_OSR4);
-    set_gyr_bwp(&sensor_lower, GYR_BWP_OSR4);
-    disable_fifo_header(&sensor_lower);
-    enable_data_streaming(&sensor_lower);
-    enable_acc_filter_perf(&sensor_lower);
-    enable_gyr_noise_perf(&sensor_lower);
-    enable_gyr_filter_perf(&sensor_lower);
+        data[1] = (int32_t)temp_acc[0];             // Acc X
+        data[2] = (int32_t)temp_acc[1];             // Acc Y
+        data[3] = (int32_t)temp_acc[2];             // Acc Z
+        data[4] = (int32_t)temp_gyr[0];             // Gyr X
+        data[5] = (int32_t)temp_gyr[1];             // Gyr Y
+        data[6] = (int32_t)temp_gyr[2];             // Gyr Z
+
+        bmi270_trace_end(TRACE_CONVERT, i);
+    }
 
     // -------------------------------------------------
-    // NETWORK CONFIGURATION
+    // SENDING DATA
     // -------------------------------------------------
 
-    int sock = socket(AF_INET, SOCK_DGRAM, 0);
+    int result = send_data(app, data_array, num_devices * NUM_CHANNELS);
 
-    if (sock < 0)
+    // A dropped datagram loses the samples of all sensors it carries
+    if (result == -ENOBUFS)
     {
-        printf("ERROR: Socket creation failed!\n");
-        return -1;
+        for (int i = 0; i < num_devices; i++)
+        {
+            bmi270_metrics_drop(app->devices[i].metrics, app->settings.batch > 0 ? app->settings.batch : 1);
+        }
     }
 
-    struct sockaddr_in receiver_address;
-    receiver_address.sin_family = AF_INET;
-    receiver_address.sin_addr.s_addr = inet_addr("192.168.1.2");
-    receiver_address.sin_port = htons(8000);
+    // Dropped samples (network busy) or no receiver listening yet are not fatal
+    if (result < 0 && result != -ENOBUFS && result != -ECONNREFUSED)
+    {
+        printf("ERROR: Sending data failed!\n");
+        bmi270_loop_stop(loop);
+        return;
+    }
 
+    if (!app->data_streaming)
+    {
+        printf("\nSending data of %d sensors to %s:%d at %g Hz.\n", num_devices, inet_ntoa(app->receiver_address.sin_addr), ntohs(app->receiver_address.sin_port), app->settings.rate);
+        app->data_streaming = 1;
+    }
 
     // -------------------------------------------------
-    // VARIABLES
+    // BUS STATISTICS
     // -------------------------------------------------
 
-    int data_streaming = 0;
+    if (app->settings.stats_interval > 0.0)
+    {
+        clock_gettime(CLOCK_MONOTONIC_RAW, &toc);
+        uint64_t elapsed_ns = (uint64_t)get_microseconds_delta(&tic, &toc) * 1000;
 
-    // for package data
-    int16_t temp_acc[3], temp_gyr[3];
-    int32_t data_array[NUM_DATA];
-    struct timespec begin, data_timer, old_time1, old_time2;
-    clock_gettime(CLOCK_MONOTONIC_RAW, &begin);
-    old_time1 = begin;
-    old_time2 = begin;
+        for (int i = 0; i < num_devices; i++)
+        {
+            bmi270_stats_loop(&app->devices[i].stats, elapsed_ns, (uint64_t)(1e9 / app->settings.rate));
+        }
+    }
+}
+
+void on_stats(struct bmi270_loop *loop, int source, uint64_t expirations, void *ctx)
+{
+    struct app *app = ctx;
+
+    (void)loop;
+    (void)source;
+    (void)expirations;
+
+    for (int i = 0; i < app->settings.num_devices; i++)
+    {
+        bmi270_stats_dump(&app->devices[i].stats, stdout, app->settings.devices[i].name);
+    }
+}
+
+void on_reload(struct bmi270_loop *loop, int source, uint64_t events, void *ctx)
+{
+    struct app *app = ctx;
+    struct bmi270_settings *running = &app->settings;
+    struct signalfd_siginfo info;
+    struct bmi270_settings settings;
+    int result;
+
+    (void)events;
 
-    // for timing
-    struct timespec sleep_time = {0, (long)(1.0 / UPDATE_RATE * 1000000000.0)};
-    struct timespec tic, toc;
-    double sleep_time_avg = 0.0;
-    double sleep_time_var = 0.0;
-    int i = 0;
+    while (read(loop->sources[source].fd, &info, sizeof(info)) == sizeof(info))
+        ;
 
-    while (1)
+    printf("\nReloading settings.\n");
+
+    if (load_settings(app, &settings) < 0)
     {
-        clock_gettime(CLOCK_MONOTONIC_RAW, &tic);
+        printf("ERROR: Invalid settings, keeping the running ones!\n");
+        return;
+    }
 
-        // -------------------------------------------------
-        // PACKAGE DATA
-        // -------------------------------------------------
+    // -------------------------------------------------
+    // SENSORS: REGISTER DELTAS ONLY
+    // -------------------------------------------------
 
-        clock_gettime(CLOCK_MONOTONIC_RAW, &data_timer);
-        data_array[0] = get_microseconds_delta(&old_time1, &data_timer);    // Sensor 1 - Time
-        old_time1 = data_timer;
-        
-        get_acc_raw(&sensor_upper, &temp_acc[0], &temp_acc[1], &temp_acc[2]);
-        get_gyr_raw(&sensor_upper, &temp_gyr[0], &temp_gyr[1], &temp_gyr[2]);
-
-        data_array[1]  = (int32_t)temp_acc[0];          // Sensor 1 - Acc X
-        data_array[2]  = (int32_t)temp_acc[1];          // Sensor 1 - Acc Y
-        data_array[3]  = (int32_t)temp_acc[2];          // Sensor 1 - Acc Z
-        data_array[4]  = (int32_t)temp_gyr[0];          // Sensor 1 - Gyr X
-        data_array[5]  = (int32_t)temp_gyr[1];          // Sensor 1 - Gyr Y
-        data_array[6]  = (int32_t)temp_gyr[2];          // Sensor 1 - Gyr Z
+    for (int i = 0; i < running->num_devices; i++)
+    {
+        struct bmi270_device_settings *old = &running->devices[i];
+        struct bmi270_device_settings *new = bmi270_settings_find(&settings, old->name);
+        struct device *device = &app->devices[i];
 
-        clock_gettime(CLOCK_MONOTONIC_RAW, &data_timer);
-        data_array[7] = get_microseconds_delta(&old_time2, &data_timer);    // Sensor 2 - Time
-        old_time2 = data_timer;
+        if (!new || strcmp(new->bus, old->bus) != 0 || new->addr != old->addr)
+        {
+            printf("WARNING: %s was removed or moved, restart to apply!\n", old->name);
+            continue;
+        }
 
-        get_acc_raw(&sensor_lower, &temp_acc[0], &temp_acc[1], &temp_acc[2]);
-        get_gyr_raw(&sensor_lower, &temp_gyr[0], &temp_gyr[1], &temp_gyr[2]);
+        if (!bmi270_recovery_ready(&device->recovery))
+        {
+            printf("%s is recovering, settings are applied when it is back.\n", old->name);
+            device->dirty = 1;
+        }
+        else if ((result = bmi270_settings_apply(&device->sensor, device->dirty ? NULL : old, new)) < 0)
+        {
+            printf("ERROR: Reconfiguring %s failed!\n", old->name);
+            device->dirty = 1;
+        }
+        else
+        {
+            // Recovery writes the snapshot before restore_settings: keep it current
+            if (result > 0)
+                bmi270_recovery_snapshot(&device->recovery);
 
-        data_array[8]  = (int32_t)temp_acc[0];          // Sensor 2 - Acc X
-        data_array[9]  = (int32_t)temp_acc[1];          // Sensor 2 - Acc Y
-        data_array[10] = (int32_t)temp_acc[2];          // Sensor 2 - Acc Z
-        data_array[11] = (int32_t)temp_gyr[0];          // Sensor 2 - Gyr X
-        data_array[12] = (int32_t)temp_gyr[1];          // Sensor 2 - Gyr Y
-        data_array[13] = (int32_t)temp_gyr[2];          // Sensor 2 - Gyr Z
+            printf("%s: %d settings changed.\n", old->name, result);
+            device->dirty = 0;
+        }
 
-        // -------------------------------------------------
-        // SENDING DATA
-        // -------------------------------------------------
+        *old = *new;
+        bmi270_metrics_reload(device->metrics);
+    }
 
-        int result = sendto(sock, data_array, NUM_DATA * sizeof(int), 0, (struct sockaddr *)&receiver_address, sizeof(receiver_address));
+    for (int i = 0; i < settings.num_devices; i++)
+    {
+        if (!bmi270_settings_find(running, settings.devices[i].name))
+            printf("WARNING: %s is new, restart to add it!\n", settings.devices[i].name);
+    }
+
+    // -------------------------------------------------
+    // ACQUISITION AND NETWORK
+    // -------------------------------------------------
+
+    if (settings.rate != running->rate)
+    {
+        bmi270_loop_remove(loop, app->timer);
 
-        if (result < 0)
+        if ((app->timer = bmi270_loop_add_timer(loop, (uint64_t)(1e9 / settings.rate), on_update, app)) < 0)
         {
-            printf("ERROR: Sending data failed!\n");
-            data_streaming = 0;
-            return -1;
+            printf("ERROR: Changing the update rate failed!\n");
+            bmi270_loop_stop(loop);
+            return;
         }
 
-        if (!data_streaming)
+        for (int i = 0; i < running->num_devices; i++)
         {
-            printf("\nSending data to %s:%d at %i Hz.\n", inet_ntoa(receiver_address.sin_addr), ntohs(receiver_address.sin_port), (int)(UPDATE_RATE));
-            data_streaming = 1;
+            app->devices[i].metrics->period_ns = (uint64_t)(1e9 / settings.rate);
         }
 
-        // -------------------------------------------------
-        // SLEEPING TO KEEP UPDATE RATE
-        // -------------------------------------------------
+        running->rate = settings.rate;
+        app->data_streaming = 0;
+    }
 
-        clock_gettime(CLOCK_MONOTONIC_RAW, &toc);
-        double elapsed_time = (toc.tv_sec - tic.tv_sec) + (double)(toc.tv_nsec - tic.tv_nsec) / 1000000000.0;
+    if (settings.batch != running->batch)
+    {
+        // A partial block is lost, the receiver sees the new block size from the next datagram
+        block_count = 0;
+        running->batch = settings.batch;
+    }
+
+    if (strcmp(settings.receiver, running->receiver) != 0 || settings.receiver_port != running->receiver_port)
+    {
+        strcpy(running->receiver, settings.receiver);
+        running->receiver_port = settings.receiver_port;
+
+        if (set_receiver(app) < 0)
+            printf("ERROR: Socket connect failed!\n");
+    }
 
-        sleep_time_avg += (elapsed_time - sleep_time_avg) / (i + 1);
-        sleep_time_var += (elapsed_time - sleep_time_avg) * (elapsed_time - sleep_time_avg) / (i + 1);
-        i++;
+    if (settings.stats_interval != running->stats_interval || settings.metrics_port != running->metrics_port ||
+        strcmp(settings.trace_file, running->trace_file) != 0)
+        printf("WARNING: stats_interval, metrics_port and trace_file take effect after a restart!\n");
+}
+
+/* ----------------------------------------------------
+                        MAIN
+-----------------------------------------------------*/
+
+static void usage(const char *name)
+{
+    fprintf(stderr, "Usage: %s [-c settings] [-o key=value ...] [-q]\n"
+                    "  -c file       settings file, reloaded on SIGHUP\n"
+                    "  -o key=value  setting on top of the file, device keys as <device>.<key>=value\n"
+                    "  -q            no driver log output\n", name);
+}
 
-        double adjustment = sqrt(sleep_time_var);
+// Usage: main -c bmi270d.conf -o rate=400 -o upper.gyr_odr=400
+int main(int argc, char **argv)
+{
+    static struct app app;
+    int opt;
 
-        sleep_time.tv_nsec = (long)((UPDATE_TIME - elapsed_time - adjustment) * 1000000000.0);
+    // Driver is silent by default, print its messages for the example
+    bmi270_set_log_handler(bmi270_log_print, BMI270_LOG_INFO, stdout);
 
-        if (i >= (UPDATE_RATE * 1.25))
+    while ((opt = getopt(argc, argv, "c:o:qh")) != -1)
+    {
+        switch (opt)
         {
-            sleep_time_avg = 0.0;
-            sleep_time_var = 0.0;
-            i = 0;
+        case 'c':
+            app.settings_file = optarg;
+            break;
+        case 'o':
+            if (app.num_overrides == MAX_OVERRIDES)
+            {
+                usage(argv[0]);
+                return 2;
+            }
+
+            app.overrides[app.num_overrides++] = optarg;
+            break;
+        case 'q':
+            bmi270_set_log_handler(NULL, BMI270_LOG_INFO, NULL);
+            break;
+        default:
+            usage(argv[0]);
+            return opt == 'h' ? 0 : 2;
         }
+    }
+
+    if (load_settings(&app, &app.settings) < 0)
+        return 2;
+
+    // -------------------------------------------------
+    // INITIALIZATION AND HARDWARE CONFIGURATION
+    // -------------------------------------------------
+
+    struct bmi270_recovery_config recovery_config;
+    struct timespec now;
+
+    bmi270_recovery_defaults(&recovery_config);
+    bmi270_metrics_init(&metrics);
+
+    for (int i = 0; i < app.settings.num_devices; i++)
+    {
+        struct bmi270_device_settings *settings = &app.settings.devices[i];
+        struct device *device = &app.devices[i];
+
+        device->sensor.i2c_addr = settings->addr;
+        device->settings = settings;
 
-        if (sleep_time.tv_nsec > 0)
-            nanosleep(&sleep_time, NULL);
+        if (app.settings.stats_interval > 0.0)
+            bmi270_stats_attach(&device->sensor, &device->stats);
 
-        // -------------------------------------------------
-        // DEBUGGING PRINTS
-        // -------------------------------------------------
+        if (bmi270_init_bus(&device->sensor, settings->bus) < 0)
+            printf("Failed to initialize %s. You might want to do a power cycle.\n", settings->name);
 
-        // // PRINT SENT DATA
-        // for (int i = 0; i < NUM_DATA; i++)
-        // {
-        //     printf("%i | ", data_array[i]);
-        // }
-        // printf("\n");
+        // Streams whatever came up, recovery restores the rest
+        device->dirty = bmi270_settings_apply(&device->sensor, NULL, settings) < 0;
 
-        // // PRINT TOTAL ELAPSED TIME
-        // clock_gettime(CLOCK_MONOTONIC_RAW, &data_timer);
-        // double total_elapsed = (data_timer.tv_sec - tic.tv_sec) + (double)(data_timer.tv_nsec - tic.tv_nsec) / 1000000000.0;
+        recovery_config.restore = restore_settings;
+        recovery_config.ctx = device;
 
-        // printf("Total elapsed time: %f\n", total_elapsed);
+        clock_gettime(CLOCK_MONOTONIC_RAW, &now);
+        bmi270_recovery_init(&device->recovery, &device->sensor, &recovery_config, get_microseconds(&now));
+        device->metrics = bmi270_metrics_add(&metrics, settings->name, &device->sensor, &device->recovery, (uint64_t)(1e9 / app.settings.rate));
+        device->old_time = now;
+    }
+
+    // -------------------------------------------------
+    // NETWORK CONFIGURATION
+    // -------------------------------------------------
+
+    if ((app.sock = socket(AF_INET, SOCK_DGRAM, 0)) < 0)
+    {
+        printf("ERROR: Socket creation failed!\n");
+        return -1;
+    }
+
+    if (set_receiver(&app) < 0)
+    {
+        printf("ERROR: Socket connect failed!\n");
+        return -1;
+    }
+
+    // -------------------------------------------------
+    // EVENT LOOP
+    // -------------------------------------------------
+
+    static uint8_t sink_buffer[SINK_BUFFER_SIZE];
+    sigset_t reload_signals;
+    int reload_fd;
+
+    signal(SIGINT, stop);
+    signal(SIGTERM, stop);
+
+    // SIGHUP is read from the loop: reconfiguration runs between two updates, never inside one
+    sigemptyset(&reload_signals);
+    sigaddset(&reload_signals, SIGHUP);
+    sigprocmask(SIG_BLOCK, &reload_signals, NULL);
+    reload_fd = signalfd(-1, &reload_signals, SFD_NONBLOCK | SFD_CLOEXEC);
+
+    if (app.settings.trace_file[0])
+    {
+        bmi270_trace_name("acquisition");
+        bmi270_trace_enable(1);
+    }
+
+    // The kernel paces the update rate: no sleep quantization, no drift compensation
+    if (bmi270_loop_init(&loop) < 0 ||
+        (app.sink = bmi270_loop_add_sink(&loop, app.sock, sink_buffer, sizeof(sink_buffer))) < 0 ||
+        (app.timer = bmi270_loop_add_timer(&loop, (uint64_t)(1e9 / app.settings.rate), on_update, &app)) < 0 ||
+        (app.settings.stats_interval > 0.0 && bmi270_loop_add_timer(&loop, (uint64_t)(app.settings.stats_interval * 1e9), on_stats, &app) < 0) ||
+        (app.settings.metrics_port > 0 && bmi270_metrics_listen_tcp(&metrics, &loop, app.settings.metrics_port) < 0) ||
+        reload_fd < 0 || bmi270_loop_add_fd(&loop, reload_fd, EPOLLIN, on_reload, &app) < 0)
+    {
+        printf("ERROR: Event loop setup failed!\n");
+        return -1;
+    }
+
+    bmi270_loop_run(&loop);
+    bmi270_loop_close(&loop);
+    close(reload_fd);
+    close(app.sock);
+
+    if (app.settings.trace_file[0])
+    {
+        bmi270_trace_enable(0);
+
+        if (bmi270_trace_export_file(app.settings.trace_file) < 0)
+            printf("ERROR: Writing trace %s failed!\n", app.settings.trace_file);
+        else
+            printf("Trace written to %s (open in ui.perfetto.dev or chrome://tracing)\n", app.settings.trace_file);
     }
 
     // -------------------------------------------------
     // CLOSE I2C DEVICE
     // -------------------------------------------------
 
-    close(sensor_upper.i2c_fd);
-    close(sensor_lower.i2c_fd);
+    for (int i = 0; i < app.settings.num_devices; i++)
+    {
+        bmi270_close(&app.devices[i].sensor);
+    }
 
     printf("\n-------- SCRIPT ENDED SUCCESSFULLY --------\n");
 
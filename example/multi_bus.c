@@ -0,0 +1,138 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bmi270.h"
+#include "bmi270_manager.h"
+#include "bmi270_strapdown.h"
+
+#define UPDATE_RATE 400.0               // Hz per sensor
+#define BATCH_PERIOD 10000               // us of samples per batch
+#define NUM_BATCHES 16                  // Batches in flight
+#define STRAPDOWN_RATE 0.0              // Hz of delta-angle / delta-velocity output per sensor (0.0 = raw samples)
+
+static struct bmi270_manager manager;
+static struct bmi270_pool pool;
+static struct bmi270_strapdown strapdown[MANAGER_MAX_DEVICES];
+
+/* ----------------------------------------------------
+                        MAIN
+-----------------------------------------------------*/
+
+// Usage: multi_bus /dev/i2c-1:0x68 /dev/i2c-1:0x69 /dev/i2c-3:0x68 ...
+int main(int argc, char **argv)
+{
+    struct bmi270 *sensors[MANAGER_MAX_DEVICES];
+    struct bmi270_pool_config pool_config;
+    int result;
+
+    if (argc < 2)
+    {
+        fprintf(stderr, "Usage: %s <bus>:<address> ...\n", argv[0]);
+        return 1;
+    }
+
+    bmi270_set_log_handler(bmi270_log_print, BMI270_LOG_INFO, stdout);
+
+    if ((result = bmi270_manager_init(&manager)) < 0)
+        return 1;
+
+    // -------------------------------------------------
+    // SENSORS
+    // -------------------------------------------------
+
+    for (int i = 1; i < argc; i++)
+    {
+        char bus[MANAGER_PATH_LEN];
+        char *separator = strrchr(argv[i], ':');
+
+        if (separator == NULL || (size_t)(separator - argv[i]) >= sizeof(bus))
+        {
+            fprintf(stderr, "Invalid sensor: %s\n", argv[i]);
+            return 1;
+        }
+
+        memcpy(bus, argv[i], separator - argv[i]);
+        bus[separator - argv[i]] = '\0';
+
+        int device = bmi270_manager_add(&manager, bus, (uint8_t)strtol(separator + 1, NULL, 0));
+
+        if (device < 0)
+        {
+            fprintf(stderr, "Could not add %s: %s\n", argv[i], strerror(-device));
+            return 1;
+        }
+
+        struct bmi270 *sensor = sensors[device] = bmi270_manager_sensor(&manager, device);
+
+        set_mode(sensor, PERFORMANCE_MODE);
+        set_acc_range(sensor, ACC_RANGE_2G);
+        set_gyr_range(sensor, GYR_RANGE_1000);
+        set_acc_odr(sensor, ACC_ODR_400);
+        set_gyr_odr(sensor, GYR_ODR_400);
+
+        // Integrated at the ODR here, the output carries the coning and sculling motion between two lines
+        if (STRAPDOWN_RATE > 0.0 && bmi270_strapdown_init(&strapdown[device], sensor, STRAPDOWN_RATE) < 0)
+            return 1;
+    }
+
+    // -------------------------------------------------
+    // SAMPLE POOL
+    // -------------------------------------------------
+
+    // Sized once from the configured ODRs, no allocations while streaming
+    bmi270_pool_config(&pool_config, sensors, manager.num_devices, BATCH_PERIOD, NUM_BATCHES);
+
+    if ((result = bmi270_pool_init(&pool, &pool_config, NULL, 0)) < 0)
+    {
+        fprintf(stderr, "Could not allocate sample pool: %s\n", strerror(-result));
+        return 1;
+    }
+
+    // -------------------------------------------------
+    // MERGED STREAM
+    // -------------------------------------------------
+
+    if ((result = bmi270_manager_start(&manager, UPDATE_RATE, NULL)) < 0)
+    {
+        fprintf(stderr, "Could not start: %s\n", strerror(-result));
+        return 1;
+    }
+
+    while (1)
+    {
+        struct bmi270_batch *batch = bmi270_manager_read_batch(&manager, &pool, 100);
+
+        if (batch == NULL)
+            continue;
+
+        for (uint32_t i = 0; i < batch->count; i++)
+        {
+            struct bmi270_sample *s = &batch->samples[i];
+            struct bmi270_strapdown_output out;
+
+            if (STRAPDOWN_RATE > 0.0)
+            {
+                if (bmi270_strapdown_update_sample(&strapdown[s->device], s, &out))
+                    printf("%llu %u %.9f %.9f %.9f %.6f %.6f %.6f %u\n", (unsigned long long)out.timestamp_us, s->device,
+                           out.delta_angle[0], out.delta_angle[1], out.delta_angle[2],
+                           out.delta_velocity[0], out.delta_velocity[1], out.delta_velocity[2], out.flags);
+
+                continue;
+            }
+
+            if (!(s->flags & SAMPLE_VALID))
+                continue;
+
+            printf("%llu %u %d %d %d %d %d %d\n", (unsigned long long)s->timestamp_us, s->device,
+                   s->acc[0], s->acc[1], s->acc[2], s->gyr[0], s->gyr[1], s->gyr[2]);
+        }
+
+        bmi270_batch_unref(batch);
+    }
+
+    bmi270_manager_close(&manager);
+    bmi270_pool_destroy(&pool);
+
+    return 0;
+}
@@ -0,0 +1,139 @@
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bmi270.h"
+#include "bmi270_fifo.h"
+#include "bmi270_loop.h"
+#include "bmi270_spectrum.h"
+
+#define READ_PERIOD 0.05                // Seconds between FIFO reads (80 samples at 1600 Hz)
+#define SPECTRUM_SIZE 1024              // FFT points (1.5625 Hz resolution at 1600 Hz)
+#define REPORT_FRAMES 6                 // Frames per report, 50 % overlap: 2 s per report at 1600 Hz
+#define MAX_SAMPLES (FIFO_SIZE / 13)    // Samples of a full FIFO (header + acc + gyr frames)
+
+static struct bmi270_loop loop;
+static struct bmi270_fifo fifo;
+static struct bmi270_spectrum spectrum;
+static struct bmi270_sample samples[MAX_SAMPLES];
+
+/* ----------------------------------------------------
+                    EVENT HANDLERS
+-----------------------------------------------------*/
+
+void stop(int signal)
+{
+    (void)signal;
+    bmi270_loop_stop(&loop);
+}
+
+// One JSON line per report instead of 1600 samples per second
+void on_read(struct bmi270_loop *loop, int source, uint64_t expirations, void *ctx)
+{
+    struct bmi270_spectrum_report report;
+    int count;
+
+    (void)loop;
+    (void)source;
+    (void)expirations;
+    (void)ctx;
+
+    if ((count = bmi270_fifo_read(&fifo, samples, MAX_SAMPLES, 0)) <= 0 ||
+        bmi270_spectrum_push(&spectrum, samples, count, &report) == 0)
+        return;
+
+    printf("{\"ts\":%llu,\"frames\":%u,\"gap\":%d,\"resolution\":%.4f,\"axes\":[",
+           (unsigned long long)report.timestamp_us, report.frames, (report.flags & SAMPLE_GAP) != 0, report.resolution_hz);
+
+    for (int axis = 0; axis < SPECTRUM_AXES; axis++)
+    {
+        printf("%s{\"rms\":%.5f,\"bands\":[", axis ? "," : "", report.rms[axis]);
+
+        for (int b = 0; b < spectrum.config.num_bands; b++)
+            printf("%s%.5f", b ? "," : "", report.band_rms[axis][b]);
+
+        printf("],\"peaks\":[");
+
+        for (int p = 0; p < spectrum.config.num_peaks && report.peaks[axis][p].amplitude > 0.0f; p++)
+            printf("%s[%.2f,%.5f]", p ? "," : "", report.peaks[axis][p].freq_hz, report.peaks[axis][p].amplitude);
+
+        printf("]}");
+    }
+
+    printf("]}\n");
+    fflush(stdout);
+}
+
+/* ----------------------------------------------------
+                        MAIN
+-----------------------------------------------------*/
+
+int main()
+{
+    struct bmi270 sensor = {.i2c_addr = I2C_PRIM_ADDR};
+    struct bmi270_spectrum_config config;
+
+    bmi270_set_log_handler(bmi270_log_print, BMI270_LOG_WARN, stderr);
+
+    if (bmi270_init(&sensor) < 0)
+    {
+        fprintf(stderr, "Failed to initialize the sensor. You might want to do a power cycle.\n");
+        return 1;
+    }
+
+    // -------------------------------------------------
+    // HARDWARE CONFIGURATION
+    // -------------------------------------------------
+
+    set_mode(&sensor, PERFORMANCE_MODE);
+    set_acc_range(&sensor, ACC_RANGE_4G);
+    set_gyr_range(&sensor, GYR_RANGE_1000);
+    set_acc_odr(&sensor, ACC_ODR_1600);
+    set_gyr_odr(&sensor, GYR_ODR_1600);
+    set_acc_bwp(&sensor, ACC_BWP_NORMAL);
+    set_gyr_bwp(&sensor, GYR_BWP_NORMAL);
+    disable_data_streaming(&sensor);
+    disable_fifo_aux(&sensor);
+    enable_fifo_header(&sensor);
+
+    // -------------------------------------------------
+    // SPECTRUM
+    // -------------------------------------------------
+
+    bmi270_spectrum_defaults(&config);
+    config.size = SPECTRUM_SIZE;
+    config.hop = SPECTRUM_SIZE / 2;
+    config.frames_per_report = REPORT_FRAMES;
+
+    // Running speeds and their harmonics, bearing and gear mesh range
+    config.bands[config.num_bands++] = (struct bmi270_spectrum_band){10.0f, 200.0f};
+    config.bands[config.num_bands++] = (struct bmi270_spectrum_band){200.0f, 800.0f};
+
+    if (bmi270_fifo_init(&fifo, &sensor, 0) < 0 || bmi270_spectrum_init(&spectrum, &sensor, &config) < 0)
+    {
+        fprintf(stderr, "ERROR: FIFO or spectrum setup failed!\n");
+        return 1;
+    }
+
+    // -------------------------------------------------
+    // EVENT LOOP
+    // -------------------------------------------------
+
+    signal(SIGINT, stop);
+    signal(SIGTERM, stop);
+
+    if (bmi270_loop_init(&loop) < 0 || bmi270_loop_add_timer(&loop, (uint64_t)(READ_PERIOD * 1e9), on_read, NULL) < 0)
+    {
+        fprintf(stderr, "ERROR: Event loop setup failed!\n");
+        return 1;
+    }
+
+    bmi270_loop_run(&loop);
+    bmi270_loop_close(&loop);
+    bmi270_close(&sensor);
+
+    fprintf(stderr, "%llu frames, %llu reports, %llu gaps\n", (unsigned long long)spectrum.total_frames,
+            (unsigned long long)spectrum.reports, (unsigned long long)spectrum.gaps);
+
+    return 0;
+}
@@ -0,0 +1,118 @@
+#include <signal.h>
+#include <stdio.h>
+
+#include "bmi270.h"
+#include "bmi270_fifo.h"
+#include "bmi270_loop.h"
+#include "bmi270_stats.h"
+#include "bmi270_watermark.h"
+
+#define GPIO_CHIP "/dev/gpiochip0"      // INT1 is wired to GPIO_LINE of this chip
+#define GPIO_LINE 17
+#define BUDGET_US 10000                 // Oldest sample at most 10 ms old when its batch is read
+#define MAX_SAMPLES (FIFO_SIZE / WTM_FRAME_ACC_GYR)
+
+static struct bmi270_loop loop;
+static struct bmi270_fifo fifo;
+static struct bmi270_watermark wm;
+static struct bmi270_sample samples[MAX_SAMPLES];
+
+/* ----------------------------------------------------
+                    EVENT HANDLERS
+-----------------------------------------------------*/
+
+void stop(int signal)
+{
+    (void)signal;
+    bmi270_loop_stop(&loop);
+}
+
+// FWM_INT edge: read the batch, the service time runs from the edge to the end of the read
+void on_watermark(struct bmi270_loop *loop, int source, uint64_t edge_ns, void *ctx)
+{
+    int count;
+
+    (void)loop;
+    (void)source;
+    (void)ctx;
+
+    if ((count = bmi270_fifo_read(&fifo, samples, MAX_SAMPLES, 0)) < 0)
+        return;
+
+    if (bmi270_watermark_update(&wm, (uint32_t)count * wm.config.frame_size, (uint32_t)((bmi270_stats_now() - edge_ns) / 1000)) == 1)
+    {
+        printf("Watermark %u frames (service %u +- %u us, last batch %d frames, %u us old)\n", wm.frames, wm.service_us,
+               wm.service_dev_us, count, wm.latency_us);
+        fflush(stdout);
+    }
+}
+
+/* ----------------------------------------------------
+                        MAIN
+-----------------------------------------------------*/
+
+int main()
+{
+    struct bmi270 sensor = {.i2c_addr = I2C_PRIM_ADDR};
+    struct bmi270_watermark_config config;
+
+    bmi270_set_log_handler(bmi270_log_print, BMI270_LOG_WARN, stderr);
+
+    if (bmi270_init(&sensor) < 0)
+    {
+        fprintf(stderr, "Failed to initialize the sensor. You might want to do a power cycle.\n");
+        return 1;
+    }
+
+    // -------------------------------------------------
+    // HARDWARE CONFIGURATION
+    // -------------------------------------------------
+
+    set_mode(&sensor, PERFORMANCE_MODE);
+    set_acc_range(&sensor, ACC_RANGE_4G);
+    set_gyr_range(&sensor, GYR_RANGE_1000);
+    set_acc_odr(&sensor, ACC_ODR_1600);
+    set_gyr_odr(&sensor, GYR_ODR_1600);
+    disable_data_streaming(&sensor);
+    disable_fifo_aux(&sensor);
+    enable_fifo_header(&sensor);
+
+    // INT1 push-pull, active high: the GPIO sees a rising edge when the watermark is reached
+    set_int_pin_config(&sensor, INT1, INT_ACTIVE_HIGH | INT_OUTPUT_EN);
+
+    // Header frames with acc and gyr, FWM_INT on INT1
+    bmi270_watermark_defaults(&config);
+    config.latency_budget_us = BUDGET_US;
+
+    if (bmi270_fifo_init(&fifo, &sensor, 0) < 0 || bmi270_watermark_init(&wm, &sensor, &config) < 0)
+    {
+        fprintf(stderr, "ERROR: FIFO or watermark setup failed!\n");
+        return 1;
+    }
+
+    // -------------------------------------------------
+    // EVENT LOOP
+    // -------------------------------------------------
+
+    signal(SIGINT, stop);
+    signal(SIGTERM, stop);
+
+    if (bmi270_loop_init(&loop) < 0 || bmi270_loop_add_gpio(&loop, GPIO_CHIP, GPIO_LINE, on_watermark, NULL) < 0)
+    {
+        fprintf(stderr, "ERROR: Event loop setup failed!\n");
+        return 1;
+    }
+
+    // Drain what was batched before the edge could be seen, the next crossing raises FWM_INT again
+    bmi270_fifo_read(&fifo, samples, MAX_SAMPLES, 0);
+
+    bmi270_loop_run(&loop);
+    bmi270_loop_close(&loop);
+    bmi270_watermark_stop(&wm);
+    bmi270_close(&sensor);
+
+    fprintf(stderr, "%llu wakeups, %.1f frames per wakeup, %u over budget, %u watermark changes, %u gaps\n",
+            (unsigned long long)wm.wakeups, bmi270_watermark_batching(&wm), wm.violations, wm.reprograms, fifo.gaps);
+
+    return 0;
+}
@@ -0,0 +1,721 @@
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include <errno.h>
+#include <string.h>
+
+#include "bmi270.h"
+#include "bmi270_regs.h"
+#include "bmi270_sim.h"
+
+/* ----------------------------------------------------
+                    DEFINITIONS
+-----------------------------------------------------*/
+
+#define SAMPLE_FIELDS       6                  // acc x, y, z, gyr x, y, z
+#define SAMPLE_FRAME_SIZE   13                 // Header + gyr + acc frame (bytes)
+#define SAMPLE_MAX          (FIFO_SIZE / SAMPLE_FRAME_SIZE)  // Samples one FIFO read can return
+
+typedef struct
+{
+    PyObject_HEAD
+
+    struct bmi270 sensor;
+
+    /* Simulated bus (simulated=True), NULL for hardware */
+    struct bmi270_sim *sim;
+
+    /* FIFO read buffer, parsed in place */
+    uint8_t fifo[FIFO_SIZE];
+
+    /* Held around bus I/O and close: the GIL is released meanwhile, other threads may use the same sensor */
+    PyThread_type_lock lock;
+
+    int open;
+} SensorObject;
+
+typedef struct
+{
+    PyObject_HEAD
+
+    /* int16 samples, count x SAMPLE_FIELDS */
+    int16_t *data;
+    Py_ssize_t count;
+
+    /* Shape and strides handed out through the buffer protocol */
+    Py_ssize_t shape[2];
+    Py_ssize_t strides[2];
+} SamplesObject;
+
+static PyTypeObject SamplesType;
+
+/* ----------------------------------------------------
+                  HELPER FUNCTIONS
+-----------------------------------------------------*/
+
+static PyObject *raise_errno(int result)
+{
+    errno = -result;
+    return PyErr_SetFromErrno(PyExc_OSError);
+}
+
+static int check_open(SensorObject *self)
+{
+    if (!self->open)
+    {
+        PyErr_SetString(PyExc_ValueError, "sensor is closed");
+        return 0;
+    }
+
+    return 1;
+}
+
+/* Take the sensor lock, called without the GIL - returns -EBADF if another thread closed the sensor meanwhile */
+static int lock_sensor(SensorObject *self)
+{
+    PyThread_acquire_lock(self->lock, WAIT_LOCK);
+
+    if (self->open)
+        return 0;
+
+    PyThread_release_lock(self->lock);
+    return -EBADF;
+}
+
+/* Read the FIFO and parse acc + gyr frames into out (count x SAMPLE_FIELDS) - called without the GIL */
+static int read_samples(SensorObject *self, int16_t *out, Py_ssize_t max, Py_ssize_t *count)
+{
+    struct bmi270_fifo_frame frame;
+    uint16_t length, offset = 0;
+    uint8_t config;
+    int result, consumed;
+
+    *count = 0;
+
+    // Bounds max * SAMPLE_FRAME_SIZE as well: a whole FIFO read never holds more
+    if (max > SAMPLE_MAX)
+        max = SAMPLE_MAX;
+
+    if ((result = read_register(&self->sensor, FIFO_CONFIG_1, &config)) < 0 ||
+        (result = get_fifo_length(&self->sensor, &length)) < 0)
+        return result;
+
+    // Only read what fits into out: the rest stays in the FIFO for the next call
+    if (length > max * SAMPLE_FRAME_SIZE)
+        length = (uint16_t)(max * SAMPLE_FRAME_SIZE);
+
+    if (length > FIFO_SIZE)
+        length = FIFO_SIZE;
+
+    if ((result = read_fifo(&self->sensor, self->fifo, length)) < 0)
+        return result;
+
+    while (*count < max && (consumed = parse_fifo_frame(self->fifo + offset, length - offset, config, &frame)) > 0)
+    {
+        offset += consumed;
+
+        if (frame.type != FIFO_FRAME_DATA || frame.acc == NULL || frame.gyr == NULL)
+            continue;
+
+        int16_t *sample = out + *count * SAMPLE_FIELDS;
+
+        for (int axis = 0; axis < 3; axis++)
+        {
+            sample[axis] = FIFO_AXIS(frame.acc, axis);
+            sample[3 + axis] = FIFO_AXIS(frame.gyr, axis);
+        }
+
+        (*count)++;
+    }
+
+    return 0;
+}
+
+/* ----------------------------------------------------
+                      SAMPLES
+-----------------------------------------------------*/
+
+static void Samples_dealloc(SamplesObject *self)
+{
+    PyMem_Free(self->data);
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static int Samples_getbuffer(SamplesObject *self, Py_buffer *view, int flags)
+{
+    // Zero-copy: numpy.asarray(samples) is a (count, 6) int16 view of the storage
+    self->shape[0] = self->count;
+    self->shape[1] = SAMPLE_FIELDS;
+    self->strides[0] = SAMPLE_FIELDS * sizeof(int16_t);
+    self->strides[1] = sizeof(int16_t);
+
+    view->obj = (PyObject *)self;
+    view->buf = self->data;
+    view->len = self->count * SAMPLE_FIELDS * sizeof(int16_t);
+    view->readonly = 0;
+    view->itemsize = sizeof(int16_t);
+    view->format = (flags & PyBUF_FORMAT) ? "h" : NULL;
+    view->ndim = 2;
+    view->shape = (flags & PyBUF_ND) ? self->shape : NULL;
+    view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? self->strides : NULL;
+    view->suboffsets = NULL;
+    view->internal = NULL;
+
+    Py_INCREF(self);
+
+    return 0;
+}
+
+static Py_ssize_t Samples_len(SamplesObject *self)
+{
+    return self->count;
+}
+
+static PyBufferProcs Samples_as_buffer = {
+    .bf_getbuffer = (getbufferproc)Samples_getbuffer,
+};
+
+static PySequenceMethods Samples_as_sequence = {
+    .sq_length = (lenfunc)Samples_len,
+};
+
+static PyTypeObject SamplesType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "bmi270_c.Samples",
+    .tp_doc = "Raw int16 samples (acc x, y, z, gyr x, y, z), exported through the buffer protocol",
+    .tp_basicsize = sizeof(SamplesObject),
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_dealloc = (destructor)Samples_dealloc,
+    .tp_as_buffer = &Samples_as_buffer,
+    .tp_as_sequence = &Samples_as_sequence,
+};
+
+/* ----------------------------------------------------
+                       SENSOR
+-----------------------------------------------------*/
+
+static int Sensor_init(SensorObject *self, PyObject *args, PyObject *kwds)
+{
+    static char *keywords[] = {"address", "bus", "simulated", NULL};
+    int address = I2C_PRIM_ADDR, simulated = 0, result;
+    const char *bus = I2C_DEVICE;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|isp", keywords, &address, &bus, &simulated))
+        return -1;
+
+    // Held until the sensor is set up again, taken without the GIL like everywhere else
+    Py_BEGIN_ALLOW_THREADS
+    PyThread_acquire_lock(self->lock, WAIT_LOCK);
+    Py_END_ALLOW_THREADS
+
+    // __init__ called again: start over
+    if (self->open)
+        bmi270_close(&self->sensor);
+
+    PyMem_Free(self->sim);
+    self->sim = NULL;
+    self->open = 0;
+
+    memset(&self->sensor, 0, sizeof(self->sensor));
+    self->sensor.i2c_addr = (uint8_t)address;
+    self->sensor.i2c_fd = -1;
+
+    // Simulated bus for offline pipelines and tests
+    if (simulated)
+    {
+        if ((self->sim = PyMem_Calloc(1, sizeof(*self->sim))) == NULL)
+        {
+            PyThread_release_lock(self->lock);
+            PyErr_NoMemory();
+            return -1;
+        }
+
+        bmi270_sim_init(self->sim);
+        bmi270_sim_attach(&self->sensor, self->sim);
+    }
+
+    // The config file upload takes ~40 ms of bus time
+    Py_BEGIN_ALLOW_THREADS
+    result = bmi270_init_bus(&self->sensor, bus);
+    Py_END_ALLOW_THREADS
+
+    if (result < 0)
+    {
+        bmi270_close(&self->sensor);
+        PyThread_release_lock(self->lock);
+        raise_errno(result);
+        return -1;
+    }
+
+    self->open = 1;
+    PyThread_release_lock(self->lock);
+
+    return 0;
+}
+
+static PyObject *Sensor_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    SensorObject *self = (SensorObject *)PyType_GenericNew(type, args, kwds);
+
+    if (self && (self->lock = PyThread_allocate_lock()) == NULL)
+    {
+        Py_DECREF(self);
+        return PyErr_NoMemory();
+    }
+
+    return (PyObject *)self;
+}
+
+/* Close the bus once no other thread is using it */
+static void close_sensor(SensorObject *self)
+{
+    Py_BEGIN_ALLOW_THREADS
+    if (lock_sensor(self) == 0)
+    {
+        bmi270_close(&self->sensor);
+        self->open = 0;
+        PyThread_release_lock(self->lock);
+    }
+    Py_END_ALLOW_THREADS
+}
+
+static PyObject *Sensor_close(SensorObject *self, PyObject *unused)
+{
+    (void)unused;
+
+    close_sensor(self);
+
+    Py_RETURN_NONE;
+}
+
+static void Sensor_dealloc(SensorObject *self)
+{
+    if (self->lock)
+    {
+        close_sensor(self);
+        PyThread_free_lock(self->lock);
+    }
+
+    PyMem_Free(self->sim);
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static PyObject *Sensor_enter(SensorObject *self, PyObject *unused)
+{
+    (void)unused;
+    Py_INCREF(self);
+    return (PyObject *)self;
+}
+
+static PyObject *Sensor_exit(SensorObject *self, PyObject *args)
+{
+    (void)args;
+    return Sensor_close(self, NULL);
+}
+
+/* Setter taking one uint8_t code, bus I/O without the GIL */
+static PyObject *call_setter(SensorObject *self, PyObject *args, int (*setter)(struct bmi270 *, uint8_t))
+{
+    unsigned char value;
+    int result;
+
+    if (!check_open(self) || !PyArg_ParseTuple(args, "b", &value))
+        return NULL;
+
+    Py_BEGIN_ALLOW_THREADS
+    if ((result = lock_sensor(self)) == 0)
+    {
+        result = setter(&self->sensor, value);
+        PyThread_release_lock(self->lock);
+    }
+    Py_END_ALLOW_THREADS
+
+    if (result < 0)
+        return raise_errno(result);
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *Sensor_set_mode(SensorObject *self, PyObject *args) { return call_setter(self, args, set_mode); }
+static PyObject *Sensor_set_acc_range(SensorObject *self, PyObject *args) { return call_setter(self, args, set_acc_range); }
+static PyObject *Sensor_set_gyr_range(SensorObject *self, PyObject *args) { return call_setter(self, args, set_gyr_range); }
+static PyObject *Sensor_set_acc_odr(SensorObject *self, PyObject *args) { return call_setter(self, args, set_acc_odr); }
+static PyObject *Sensor_set_gyr_odr(SensorObject *self, PyObject *args) { return call_setter(self, args, set_gyr_odr); }
+
+static PyObject *Sensor_enable_fifo(SensorObject *self, PyObject *unused)
+{
+    int result;
+
+    (void)unused;
+
+    if (!check_open(self))
+        return NULL;
+
+    // Header mode, acc + gyr frames
+    Py_BEGIN_ALLOW_THREADS
+    if ((result = lock_sensor(self)) == 0)
+    {
+        if ((result = enable_fifo_header(&self->sensor)) == 0)
+            result = update_register(&self->sensor, FIFO_CONFIG_1, FIELD_MASK(FIFO_SENSORS_EN), FIELD_MASK(FIFO_ACC_EN) | FIELD_MASK(FIFO_GYR_EN));
+
+        PyThread_release_lock(self->lock);
+    }
+    Py_END_ALLOW_THREADS
+
+    if (result < 0)
+        return raise_errno(result);
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *Sensor_read_register(SensorObject *self, PyObject *args)
+{
+    unsigned char reg;
+    uint8_t value;
+    int result;
+
+    if (!check_open(self) || !PyArg_ParseTuple(args, "b", &reg))
+        return NULL;
+
+    Py_BEGIN_ALLOW_THREADS
+    if ((result = lock_sensor(self)) == 0)
+    {
+        result = read_register(&self->sensor, reg, &value);
+        PyThread_release_lock(self->lock);
+    }
+    Py_END_ALLOW_THREADS
+
+    if (result < 0)
+        return raise_errno(result);
+
+    return PyLong_FromLong(value);
+}
+
+static PyObject *Sensor_write_register(SensorObject *self, PyObject *args)
+{
+    unsigned char reg, value;
+    int result;
+
+    if (!check_open(self) || !PyArg_ParseTuple(args, "bb", &reg, &value))
+        return NULL;
+
+    Py_BEGIN_ALLOW_THREADS
+    if ((result = lock_sensor(self)) == 0)
+    {
+        result = write_register(&self->sensor, reg, value);
+        PyThread_release_lock(self->lock);
+    }
+    Py_END_ALLOW_THREADS
+
+    if (result < 0)
+        return raise_errno(result);
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *Sensor_read(SensorObject *self, PyObject *unused)
+{
+    int16_t acc[3], gyr[3];
+    int result;
+
+    (void)unused;
+
+    if (!check_open(self))
+        return NULL;
+
+    Py_BEGIN_ALLOW_THREADS
+    if ((result = lock_sensor(self)) == 0)
+    {
+        result = get_acc_gyr_raw(&self->sensor, acc, gyr);
+        PyThread_release_lock(self->lock);
+    }
+    Py_END_ALLOW_THREADS
+
+    if (result < 0)
+        return raise_errno(result);
+
+    return Py_BuildValue("(hhhhhh)", acc[0], acc[1], acc[2], gyr[0], gyr[1], gyr[2]);
+}
+
+static PyObject *Sensor_fifo_length(SensorObject *self, PyObject *unused)
+{
+    uint16_t length;
+    int result;
+
+    (void)unused;
+
+    if (!check_open(self))
+        return NULL;
+
+    Py_BEGIN_ALLOW_THREADS
+    if ((result = lock_sensor(self)) == 0)
+    {
+        result = get_fifo_length(&self->sensor, &length);
+        PyThread_release_lock(self->lock);
+    }
+    Py_END_ALLOW_THREADS
+
+    if (result < 0)
+        return raise_errno(result);
+
+    return PyLong_FromLong(length);
+}
+
+static PyObject *Sensor_read_fifo_into(SensorObject *self, PyObject *args)
+{
+    Py_buffer buffer;
+    uint16_t length;
+    int result;
+
+    if (!check_open(self) || !PyArg_ParseTuple(args, "w*", &buffer))
+        return NULL;
+
+    // The buffer export pins the caller's memory while the GIL is released
+    Py_BEGIN_ALLOW_THREADS
+    if ((result = lock_sensor(self)) == 0)
+    {
+        if ((result = get_fifo_length(&self->sensor, &length)) == 0)
+        {
+            if (length > buffer.len)
+                length = (uint16_t)buffer.len;
+
+            result = read_fifo(&self->sensor, buffer.buf, length);
+        }
+
+        PyThread_release_lock(self->lock);
+    }
+    Py_END_ALLOW_THREADS
+
+    PyBuffer_Release(&buffer);
+
+    if (result < 0)
+        return raise_errno(result);
+
+    return PyLong_FromLong(length);
+}
+
+static PyObject *Sensor_read_samples_into(SensorObject *self, PyObject *args)
+{
+    PyObject *out;
+    Py_buffer buffer;
+    Py_ssize_t count;
+    int result;
+
+    if (!check_open(self) || !PyArg_ParseTuple(args, "O", &out))
+        return NULL;
+
+    if (PyObject_GetBuffer(out, &buffer, PyBUF_WRITABLE | PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) < 0)
+        return NULL;
+
+    if (buffer.itemsize != sizeof(int16_t) || buffer.format == NULL || strcmp(buffer.format, "h") != 0)
+    {
+        PyBuffer_Release(&buffer);
+        PyErr_SetString(PyExc_TypeError, "expected a writable, C-contiguous int16 buffer (e.g. numpy.empty((n, 6), numpy.int16))");
+        return NULL;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    if ((result = lock_sensor(self)) == 0)
+    {
+        result = read_samples(self, buffer.buf, buffer.len / (SAMPLE_FIELDS * sizeof(int16_t)), &count);
+        PyThread_release_lock(self->lock);
+    }
+    Py_END_ALLOW_THREADS
+
+    PyBuffer_Release(&buffer);
+
+    if (result < 0)
+        return raise_errno(result);
+
+    return PyLong_FromSsize_t(count);
+}
+
+static PyObject *Sensor_read_samples(SensorObject *self, PyObject *args)
+{
+    Py_ssize_t max = SAMPLE_MAX;
+    SamplesObject *samples;
+    int result;
+
+    if (!check_open(self) || !PyArg_ParseTuple(args, "|n", &max))
+        return NULL;
+
+    if (max < 0)
+    {
+        PyErr_SetString(PyExc_ValueError, "max must not be negative");
+        return NULL;
+    }
+
+    // No more samples than one FIFO read returns: the buffer size cannot overflow
+    if (max > SAMPLE_MAX)
+        max = SAMPLE_MAX;
+
+    if ((samples = PyObject_New(SamplesObject, &SamplesType)) == NULL)
+        return NULL;
+
+    samples->count = 0;
+
+    if ((samples->data = PyMem_Malloc(max * SAMPLE_FIELDS * sizeof(int16_t) + 1)) == NULL)
+    {
+        Py_DECREF(samples);
+        return PyErr_NoMemory();
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    if ((result = lock_sensor(self)) == 0)
+    {
+        result = read_samples(self, samples->data, max, &samples->count);
+        PyThread_release_lock(self->lock);
+    }
+    Py_END_ALLOW_THREADS
+
+    if (result < 0)
+    {
+        Py_DECREF(samples);
+        return raise_errno(result);
+    }
+
+    return (PyObject *)samples;
+}
+
+static PyObject *Sensor_get_scale(SensorObject *self, void *closure)
+{
+    (void)closure;
+    return Py_BuildValue("(dd)", self->sensor.acc_range / 32768.0, self->sensor.gyr_range / 32768.0);
+}
+
+static PyObject *Sensor_get_sim_fifo(SensorObject *self, void *closure)
+{
+    uint16_t length;
+
+    (void)closure;
+
+    if (self->sim == NULL)
+        Py_RETURN_NONE;
+
+    // Transfers of other threads drain the simulated FIFO
+    Py_BEGIN_ALLOW_THREADS
+    PyThread_acquire_lock(self->lock, WAIT_LOCK);
+    length = self->sim->fifo_len;
+    PyThread_release_lock(self->lock);
+    Py_END_ALLOW_THREADS
+
+    return PyLong_FromLong(length);
+}
+
+static PyObject *Sensor_sim_push(SensorObject *self, PyObject *args)
+{
+    Py_buffer buffer;
+    uint16_t pushed;
+
+    if (self->sim == NULL)
+    {
+        PyErr_SetString(PyExc_ValueError, "not a simulated sensor");
+        return NULL;
+    }
+
+    if (!PyArg_ParseTuple(args, "y*", &buffer))
+        return NULL;
+
+    // The simulated FIFO is read by transfers of other threads
+    Py_BEGIN_ALLOW_THREADS
+    PyThread_acquire_lock(self->lock, WAIT_LOCK);
+    pushed = self->sim ? bmi270_sim_fifo_push(self->sim, buffer.buf, buffer.len > FIFO_SIZE ? FIFO_SIZE : (uint16_t)buffer.len) : 0;
+    PyThread_release_lock(self->lock);
+    Py_END_ALLOW_THREADS
+
+    PyBuffer_Release(&buffer);
+
+    return PyLong_FromLong(pushed);
+}
+
+static PyMethodDef Sensor_methods[] = {
+    {"close", (PyCFunction)Sensor_close, METH_NOARGS, "Close the I2C bus"},
+    {"__enter__", (PyCFunction)Sensor_enter, METH_NOARGS, NULL},
+    {"__exit__", (PyCFunction)Sensor_exit, METH_VARARGS, NULL},
+    {"set_mode", (PyCFunction)Sensor_set_mode, METH_VARARGS, "set_mode(mode)"},
+    {"set_acc_range", (PyCFunction)Sensor_set_acc_range, METH_VARARGS, "set_acc_range(range)"},
+    {"set_gyr_range", (PyCFunction)Sensor_set_gyr_range, METH_VARARGS, "set_gyr_range(range)"},
+    {"set_acc_odr", (PyCFunction)Sensor_set_acc_odr, METH_VARARGS, "set_acc_odr(odr)"},
+    {"set_gyr_odr", (PyCFunction)Sensor_set_gyr_odr, METH_VARARGS, "set_gyr_odr(odr)"},
+    {"enable_fifo", (PyCFunction)Sensor_enable_fifo, METH_NOARGS, "Store acc + gyr frames with headers in the FIFO"},
+    {"read_register", (PyCFunction)Sensor_read_register, METH_VARARGS, "read_register(reg) -> int"},
+    {"write_register", (PyCFunction)Sensor_write_register, METH_VARARGS, "write_register(reg, value)"},
+    {"read", (PyCFunction)Sensor_read, METH_NOARGS, "Raw (acc x, y, z, gyr x, y, z) from the data registers"},
+    {"fifo_length", (PyCFunction)Sensor_fifo_length, METH_NOARGS, "FIFO fill level in bytes"},
+    {"read_fifo_into", (PyCFunction)Sensor_read_fifo_into, METH_VARARGS, "read_fifo_into(buffer) -> bytes read"},
+    {"read_samples_into", (PyCFunction)Sensor_read_samples_into, METH_VARARGS, "read_samples_into(int16 (n, 6) buffer) -> samples read"},
+    {"read_samples", (PyCFunction)Sensor_read_samples, METH_VARARGS, "read_samples(max) -> Samples, numpy.asarray() gives a (n, 6) int16 view"},
+    {"sim_push", (PyCFunction)Sensor_sim_push, METH_VARARGS, "Simulated sensor: append raw frames to the FIFO"},
+    {NULL, NULL, 0, NULL},
+};
+
+static PyGetSetDef Sensor_getset[] = {
+    {"scale", (getter)Sensor_get_scale, NULL, "(acc m/s^2, gyr rad/s) per raw count", NULL},
+    {"sim_fifo_length", (getter)Sensor_get_sim_fifo, NULL, "Simulated sensor: FIFO fill level", NULL},
+    {NULL, NULL, NULL, NULL, NULL},
+};
+
+static PyTypeObject SensorType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "bmi270_c.Sensor",
+    .tp_doc = "Sensor(address=0x68, bus='/dev/i2c-1', simulated=False)",
+    .tp_basicsize = sizeof(SensorObject),
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_new = Sensor_new,
+    .tp_init = (initproc)Sensor_init,
+    .tp_dealloc = (destructor)Sensor_dealloc,
+    .tp_methods = Sensor_methods,
+    .tp_getset = Sensor_getset,
+};
+
+/* ----------------------------------------------------
+                       MODULE
+-----------------------------------------------------*/
+
+static struct PyModuleDef bmi270_module = {
+    PyModuleDef_HEAD_INIT,
+    .m_name = "bmi270_c",
+    .m_doc = "BMI270 C driver bindings",
+    .m_size = -1,
+};
+
+PyMODINIT_FUNC PyInit_bmi270_c(void)
+{
+    PyObject *module;
+
+    if (PyType_Ready(&SensorType) < 0 || PyType_Ready(&SamplesType) < 0)
+        return NULL;
+
+    if ((module = PyModule_Create(&bmi270_module)) == NULL)
+        return NULL;
+
+    Py_INCREF(&SensorType);
+    PyModule_AddObject(module, "Sensor", (PyObject *)&SensorType);
+    Py_INCREF(&SamplesType);
+    PyModule_AddObject(module, "Samples", (PyObject *)&SamplesType);
+
+    PyModule_AddIntConstant(module, "I2C_PRIM_ADDR", I2C_PRIM_ADDR);
+    PyModule_AddIntConstant(module, "I2C_SEC_ADDR", I2C_SEC_ADDR);
+    PyModule_AddIntConstant(module, "LOW_POWER_MODE", LOW_POWER_MODE);
+    PyModule_AddIntConstant(module, "NORMAL_MODE", NORMAL_MODE);
+    PyModule_AddIntConstant(module, "PERFORMANCE_MODE", PERFORMANCE_MODE);
+    PyModule_AddIntConstant(module, "ACC_RANGE_2G", ACC_RANGE_2G);
+    PyModule_AddIntConstant(module, "ACC_RANGE_4G", ACC_RANGE_4G);
+    PyModule_AddIntConstant(module, "ACC_RANGE_8G", ACC_RANGE_8G);
+    PyModule_AddIntConstant(module, "ACC_RANGE_16G", ACC_RANGE_16G);
+    PyModule_AddIntConstant(module, "GYR_RANGE_2000", GYR_RANGE_2000);
+    PyModule_AddIntConstant(module, "GYR_RANGE_1000", GYR_RANGE_1000);
+    PyModule_AddIntConstant(module, "GYR_RANGE_500", GYR_RANGE_500);
+    PyModule_AddIntConstant(module, "GYR_RANGE_250", GYR_RANGE_250);
+    PyModule_AddIntConstant(module, "GYR_RANGE_125", GYR_RANGE_125);
+
+    for (int odr = ACC_ODR_25; odr <= GYR_ODR_3200; odr++)
+    {
+        char name[16];
+
+        snprintf(name, sizeof(name), "ODR_%d", (int)ODR_HZ(odr));
+        PyModule_AddIntConstant(module, name, odr);
+    }
+
+    return module;
+}
@@ -0,0 +1,634 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <linux/i2c-dev.h>
+#include <linux/i2c.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <time.h>
+
+#include "bmi270_harness.h"
+#include "bmi270_regs.h"
+
+// One trace line, parsed
+struct entry
+{
+    uint64_t time_ns;
+    char direction;
+    unsigned reg;
+    unsigned len;
+    int result;
+    uint8_t data[256];
+    unsigned num_data;
+};
+
+/* ----------------------------------------------------
+                  HELPER FUNCTIONS
+-----------------------------------------------------*/
+
+/* Sensortime ticks (39.0625 us) per sample of an ODR code, like the FIFO reader */
+static uint32_t odr_ticks(uint8_t odr)
+{
+    return odr >= 0x01 && odr <= 0x0D ? UINT32_C(8) << (0x0D - odr) : 0;
+}
+
+static uint32_t sensortime(uint64_t ns)
+{
+    return (uint32_t)(ns * 2 / 78125) & SENSORTIME_MASK;
+}
+
+static void sleep_ns(uint64_t ns)
+{
+    struct timespec ts = {.tv_sec = ns / 1000000000ULL, .tv_nsec = ns % 1000000000ULL};
+
+    nanosleep(&ts, NULL);
+}
+
+/* Data frame period of the sensors powered and stored in the FIFO (0 = none) */
+static uint64_t frame_period(const struct bmi270_sim *sim, uint32_t *acc_ticks, uint32_t *gyr_ticks)
+{
+    uint8_t pwr = sim->regs[PWR_CTRL], fifo = sim->regs[FIFO_CONFIG_1];
+    uint32_t ticks = 0;
+
+    *acc_ticks = (pwr & FIELD_MASK(PWR_CTRL_ACC_EN)) && (fifo & FIELD_MASK(FIFO_ACC_EN)) ? odr_ticks(sim->regs[ACC_CONF] & LSB_MASK_8BIT) : 0;
+    *gyr_ticks = (pwr & FIELD_MASK(PWR_CTRL_GYR_EN)) && (fifo & FIELD_MASK(FIFO_GYR_EN)) ? odr_ticks(sim->regs[GYR_CONF] & LSB_MASK_8BIT) : 0;
+
+    if (*acc_ticks)
+        ticks = *acc_ticks;
+
+    if (*gyr_ticks && (!ticks || *gyr_ticks < ticks))
+        ticks = *gyr_ticks;
+
+    return (uint64_t)ticks * 78125 / 2;
+}
+
+/* Restart the frame clock when the configuration changed the frame period */
+static void update_timing(struct bmi270_harness *h)
+{
+    uint32_t acc_ticks, gyr_ticks;
+    uint64_t period;
+
+    if (!h->sim || (period = frame_period(h->sim, &acc_ticks, &gyr_ticks)) == h->frame_ns)
+        return;
+
+    h->frame_ns = period;
+    h->next_frame_ns = h->now_ns + period;
+    h->base_frame = h->frame;
+    h->base_ns = h->next_frame_ns;
+}
+
+/* Size of the frame starting at data, of which len bytes are there (0 = unknown) */
+static int frame_size(const uint8_t *data, uint16_t len, uint8_t config)
+{
+    struct bmi270_fifo_frame frame;
+    uint8_t buffer[32] = {0};
+    int size;
+
+    memcpy(buffer, data, len < sizeof(buffer) ? len : sizeof(buffer));
+    size = parse_fifo_frame(buffer, sizeof(buffer), config, &frame);
+
+    return size > 0 ? size : 0;
+}
+
+/* Drop the oldest frame behind the skip frame, header mode counts it in the skip frame */
+static void drop_oldest(struct bmi270_harness *h, uint8_t config)
+{
+    struct bmi270_sim *sim = h->sim;
+    struct bmi270_fifo_frame frame;
+    uint16_t start = h->skipped ? 2 : 0;
+    int size = parse_fifo_frame(sim->fifo + start, sim->fifo_len - start, config, &frame);
+
+    if (size <= 0)
+        size = sim->fifo_len - start;
+
+    memmove(sim->fifo + start, sim->fifo + start + size, sim->fifo_len - start - size);
+    sim->fifo_len -= size;
+    h->overflow_frames++;
+    h->full = 1;
+
+    if (!(config & FIELD_MASK(FIFO_HEADER_EN)))
+        return;
+
+    if (!h->skipped)
+    {
+        memmove(sim->fifo + 2, sim->fifo, sim->fifo_len);
+        sim->fifo[0] = FIFO_HEAD_SKIP;
+        sim->fifo_len += 2;
+    }
+
+    if (h->skipped < FIFO_SKIP_MAX)
+        h->skipped++;
+
+    sim->fifo[1] = h->skipped;
+}
+
+static void push_frame(struct bmi270_harness *h)
+{
+    struct bmi270_sim *sim = h->sim;
+    uint8_t config = sim->regs[FIFO_CONFIG_1], data[13], header = FIFO_HEAD_REGULAR;
+    uint32_t acc_ticks, gyr_ticks, elapsed = 0;
+    int16_t acc[3] = {(int16_t)(h->frame & 0xFFFF), (int16_t)(h->frame >> 16), 4096};
+    int16_t gyr[3] = {(int16_t)(h->frame & 0xFFFF), 0, 0};
+    uint16_t size = 0;
+
+    frame_period(sim, &acc_ticks, &gyr_ticks);
+
+    if (h->frame_ns)
+        elapsed = (uint32_t)((h->frame - h->base_frame) * (h->frame_ns * 2 / 78125));
+
+    // A slower sensor is only in every n-th frame (header mode), payload order GYR, ACC
+    if (gyr_ticks && (!(config & FIELD_MASK(FIFO_HEADER_EN)) || elapsed % gyr_ticks == 0))
+    {
+        header |= FIFO_HEAD_GYR;
+
+        for (int i = 0; i < 3; i++)
+            data[1 + size++] = gyr[i] & FULL_MASK_8BIT, data[1 + size++] = (uint16_t)gyr[i] >> 8;
+    }
+
+    if (acc_ticks && (!(config & FIELD_MASK(FIFO_HEADER_EN)) || elapsed % acc_ticks == 0))
+    {
+        header |= FIFO_HEAD_ACC;
+
+        for (int i = 0; i < 3; i++)
+            data[1 + size++] = acc[i] & FULL_MASK_8BIT, data[1 + size++] = (uint16_t)acc[i] >> 8;
+    }
+
+    h->frame++;
+    h->last_frame_ns = h->now_ns;
+    h->time_pos = 0;
+
+    if (size == 0)
+        return;
+
+    data[0] = header;
+
+    if (config & FIELD_MASK(FIFO_HEADER_EN))
+        size++;
+
+    // Stop-on-full keeps the old frames and loses the new one, so does a frame being read at the start
+    if ((sim->regs[FIFO_CONFIG_0] & FIELD_MASK(FIFO_STOP_ON_FULL) || h->partial) && sim->fifo_len + size + (h->pending ? 2 : 0) > FIFO_SIZE)
+    {
+        if (config & FIELD_MASK(FIFO_HEADER_EN) && h->pending < FIFO_SKIP_MAX)
+            h->pending++;
+
+        h->overflow_frames++;
+        h->full = 1;
+        return;
+    }
+
+    if (sim->fifo_len < 2)
+        h->skipped = 0;
+
+    while (!h->partial && sim->fifo_len > (h->skipped ? 2 : 0) &&
+           sim->fifo_len + size + (h->pending ? 2 : 0) + (config & FIELD_MASK(FIFO_HEADER_EN) && !h->skipped ? 2 : 0) > FIFO_SIZE)
+        drop_oldest(h, config);
+
+    // Frames lost while the FIFO start was being read: skip frame in front of the new one
+    if (h->pending)
+    {
+        uint8_t skip[2] = {FIFO_HEAD_SKIP, h->pending};
+
+        bmi270_sim_fifo_push(sim, skip, sizeof(skip));
+        h->pending = 0;
+    }
+
+    bmi270_sim_fifo_push(sim, config & FIELD_MASK(FIFO_HEADER_EN) ? data : data + 1, size);
+}
+
+/* Advance the clock, pushing the frames due on the way */
+static void advance(struct bmi270_harness *h, uint64_t ns)
+{
+    uint64_t target = h->now_ns + ns;
+
+    while (h->sim && h->frame_ns && h->next_frame_ns <= target)
+    {
+        h->now_ns = h->next_frame_ns;
+        h->next_frame_ns += h->frame_ns;
+        push_frame(h);
+    }
+
+    h->now_ns = target;
+}
+
+/* Bus time: start, address byte and data bytes of each message at 9 bits per byte, stop */
+static uint64_t bus_ns(const struct bmi270_harness *h, const struct i2c_msg *msgs, int nmsgs)
+{
+    uint64_t bits = 1;
+
+    for (int i = 0; i < nmsgs; i++)
+        bits += 1 + 9 * (1 + (uint64_t)msgs[i].len);
+
+    return bits * 1000000000ULL / h->bus_hz;
+}
+
+static int fault_hits(struct bmi270_harness *h, struct bmi270_fault *fault, uint8_t direction, uint8_t reg)
+{
+    if (!(fault->direction & direction) || (fault->reg != FAULT_ANY_REG && fault->reg != reg) ||
+        h->now_ns < fault->after_us * 1000 || (fault->count && fault->hits >= fault->count))
+        return 0;
+
+    if (++fault->seen <= fault->skip)
+        return 0;
+
+    fault->hits++;
+    h->injected++;
+
+    return 1;
+}
+
+/* Track where the next frame starts: a burst ending inside a frame leaves its rest at the FIFO start,
+   at the end of the read announced by FIFO_LENGTH the whole frame is repeated */
+static void track_frames(struct bmi270_harness *h, const uint8_t *data, uint16_t read, uint16_t len)
+{
+    struct bmi270_sim *sim = h->sim;
+    uint16_t pos = h->partial < read ? h->partial : read, left = h->read_left;
+    int size;
+
+    // Rest of the frame the previous burst ended in
+    memcpy(h->cut + h->cut_len, data, pos);
+    h->cut_len += pos;
+
+    if (read <= h->partial)
+    {
+        h->partial -= read;
+    }
+    else
+    {
+        h->cut_len = 0;
+
+        while (pos < read)
+        {
+            if ((size = frame_size(data + pos, read - pos, sim->regs[FIFO_CONFIG_1])) == 0)
+            {
+                pos = read;
+                break;
+            }
+
+            if (pos + size > read)
+            {
+                memcpy(h->cut, data + pos, read - pos);
+                h->cut_len = read - pos;
+            }
+
+            pos += size;
+        }
+
+        h->partial = pos - read;
+    }
+
+    h->read_left = left > len ? left - len : 0;
+
+    if (!left || h->read_left || !h->partial || sim->fifo_len + h->cut_len > FIFO_SIZE)
+        return;
+
+    memmove(sim->fifo + h->cut_len, sim->fifo, sim->fifo_len);
+    memcpy(sim->fifo, h->cut, h->cut_len);
+    sim->fifo_len += h->cut_len;
+    h->partial = h->cut_len = 0;
+}
+
+static int sim_transfer(struct bmi270_harness *h, struct bmi270 *sensor, struct i2c_msg *msgs, int nmsgs)
+{
+    struct bmi270_sim *sim = h->sim;
+    uint8_t reg = msgs[0].buf[0];
+    uint16_t fifo_len = sim->fifo_len;
+    uint32_t time = sensortime(h->now_ns);
+    uint8_t time_frame[FIFO_TIME_SIZE];
+    int result;
+
+    sim->regs[SENSORTIME_0] = time & FULL_MASK_8BIT;
+    sim->regs[SENSORTIME_1] = (time >> 8) & FULL_MASK_8BIT;
+    sim->regs[SENSORTIME_2] = time >> 16;
+
+    if (h->full)
+        sim->regs[INT_STATUS_1] |= FFULL_INT_STATUS;
+
+    sensor->bus_ctx = sim;
+    result = bmi270_sim_transfer(sensor, msgs, nmsgs);
+    sensor->bus_ctx = h;
+
+    if (result < 0 || nmsgs < 2)
+    {
+        // Flushed or reset by a command: nothing left of the old frames
+        if (sim->fifo_len == 0)
+            h->skipped = h->partial = h->cut_len = h->read_left = 0;
+
+        h->time_pos = 0;
+        update_timing(h);
+        return result;
+    }
+
+    if (reg <= INT_STATUS_1 && reg + msgs[1].len > INT_STATUS_1)
+        h->full = 0;
+
+    // The driver reads the fill level and, in header mode, the sensortime frame behind it
+    if (reg <= FIFO_LENGTH_0 && reg + msgs[1].len > FIFO_LENGTH_0)
+        h->read_left = fifo_len + (sim->regs[FIFO_CONFIG_1] & FIELD_MASK(FIFO_HEADER_EN) ? FIFO_TIME_SIZE : 0);
+
+    if (reg != FIFO_DATA)
+    {
+        h->time_pos = 0;
+        return result;
+    }
+
+    // Reading moves the FIFO start: a skip frame there is gone
+    h->skipped = 0;
+    track_frames(h, msgs[1].buf, msgs[1].len < fifo_len ? msgs[1].len : fifo_len, msgs[1].len);
+
+    if (!(sim->regs[FIFO_CONFIG_0] & FIELD_MASK(FIFO_TIME_EN)) || !(sim->regs[FIFO_CONFIG_1] & FIELD_MASK(FIFO_HEADER_EN)))
+        return result;
+
+    // Past the fill level: the sensortime frame of the newest data frame, once
+    time = sensortime(h->last_frame_ns);
+    time_frame[0] = FIFO_HEAD_TIME;
+    time_frame[1] = time & FULL_MASK_8BIT;
+    time_frame[2] = (time >> 8) & FULL_MASK_8BIT;
+    time_frame[3] = time >> 16;
+
+    for (uint16_t i = sim->fifo_len ? msgs[1].len : fifo_len < msgs[1].len ? fifo_len : msgs[1].len; i < msgs[1].len && h->time_pos < FIFO_TIME_SIZE; i++)
+        msgs[1].buf[i] = time_frame[h->time_pos++];
+
+    return result;
+}
+
+static int bus_transfer(struct bmi270_harness *h, struct bmi270 *sensor, struct i2c_msg *msgs, int nmsgs)
+{
+    struct i2c_rdwr_ioctl_data data = {.msgs = msgs, .nmsgs = nmsgs};
+    int result;
+
+    if (h->sim)
+        return sim_transfer(h, sensor, msgs, nmsgs);
+
+    if (!h->transfer)
+        return ioctl(sensor->i2c_fd, I2C_RDWR, &data) < 0 ? -errno : nmsgs;
+
+    sensor->bus_ctx = h->bus_ctx;
+    result = h->transfer(sensor, msgs, nmsgs);
+    sensor->bus_ctx = h;
+
+    return result;
+}
+
+/* Next transaction of the trace, 0 at its end */
+static int read_entry(struct bmi270_harness *h, struct entry *entry)
+{
+    unsigned long long time_ns;
+    char *pos, *end;
+    int consumed;
+
+    do
+    {
+        if (!fgets(h->line, sizeof(h->line), h->replay))
+            return 0;
+    } while (h->line[0] == '#' || h->line[0] == '\n');
+
+    if (sscanf(h->line, "%llu %c %x %u %d%n", &time_ns, &entry->direction, &entry->reg, &entry->len, &entry->result, &consumed) != 5)
+        return -EINVAL;
+
+    entry->time_ns = time_ns;
+    entry->num_data = 0;
+    pos = h->line + consumed;
+
+    while (entry->num_data < sizeof(entry->data))
+    {
+        unsigned long value = strtoul(pos, &end, 16);
+
+        if (end == pos)
+            break;
+
+        entry->data[entry->num_data++] = (uint8_t)value;
+        pos = end;
+    }
+
+    return 1;
+}
+
+/* Serve a transaction from the trace entry read for it */
+static int replay_transfer(struct bmi270_harness *h, struct bmi270 *sensor, const struct entry *entry, uint8_t direction, uint8_t reg, uint8_t *data, uint16_t len)
+{
+    if (entry->direction != (direction == FAULT_READ ? 'r' : 'w') || entry->reg != reg || entry->len != len)
+    {
+        h->divergences++;
+        bmi270_log(BMI270_LOG_ERROR, "0x%X --> Replay diverged at transaction %llu: %c 0x%X (%u bytes), trace has %c 0x%X (%u bytes)",
+                   sensor->i2c_addr, (unsigned long long)h->transactions, direction == FAULT_READ ? 'r' : 'w', reg, len, entry->direction, entry->reg, entry->len);
+        return -EPROTO;
+    }
+
+    if (direction == FAULT_READ && entry->result >= 0)
+    {
+        for (uint16_t i = 0; i < len; i++)
+            data[i] = i < entry->num_data ? entry->data[i] : 0;
+    }
+
+    if (direction == FAULT_WRITE && (entry->num_data != len || memcmp(entry->data, data, len) != 0))
+    {
+        h->divergences++;
+        bmi270_log(BMI270_LOG_ERROR, "0x%X --> Replay diverged at transaction %llu: other data written to register 0x%X", sensor->i2c_addr, (unsigned long long)h->transactions, reg);
+    }
+
+    return entry->result;
+}
+
+static void record(struct bmi270_harness *h, uint8_t direction, uint8_t reg, const uint8_t *data, uint16_t len, int result)
+{
+    fprintf(h->record, "%llu %c %02X %u %d", (unsigned long long)h->now_ns, direction == FAULT_READ ? 'r' : 'w', reg, len, result);
+
+    if (direction == FAULT_WRITE || result >= 0)
+    {
+        for (uint16_t i = 0; i < len; i++)
+            fprintf(h->record, " %02X", data[i]);
+    }
+
+    fputc('\n', h->record);
+}
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+void bmi270_harness_init(struct bmi270_harness *h, struct bmi270_sim *sim)
+{
+    memset(h, 0, sizeof(*h));
+    h->sim = sim;
+    h->bus_hz = HARNESS_BUS_HZ;
+}
+
+void bmi270_harness_attach(struct bmi270_harness *h, struct bmi270 *sensor)
+{
+    h->transfer = sensor->transfer;
+    h->bus_ctx = sensor->bus_ctx;
+    sensor->transfer = bmi270_harness_transfer;
+    sensor->bus_ctx = h;
+
+    update_timing(h);
+}
+
+int bmi270_harness_add_fault(struct bmi270_harness *h, const struct bmi270_fault *fault)
+{
+    if (h->num_faults == HARNESS_MAX_FAULTS)
+        return -ENOSPC;
+
+    h->faults[h->num_faults] = *fault;
+    h->faults[h->num_faults].seen = 0;
+    h->faults[h->num_faults].hits = 0;
+
+    return h->num_faults++;
+}
+
+void bmi270_harness_clear_faults(struct bmi270_harness *h)
+{
+    h->num_faults = 0;
+}
+
+int bmi270_harness_record(struct bmi270_harness *h, const char *path)
+{
+    if (!(h->record = fopen(path, "w")))
+    {
+        bmi270_log(BMI270_LOG_ERROR, "%s --> Failed to open the trace (%s)", path, strerror(errno));
+        return -errno;
+    }
+
+    fprintf(h->record, "# bmi270 trace: <time_ns> <r|w> <reg> <len> <result> <bytes>\n");
+
+    return 0;
+}
+
+int bmi270_harness_replay(struct bmi270_harness *h, const char *path)
+{
+    if (!(h->replay = fopen(path, "r")))
+    {
+        bmi270_log(BMI270_LOG_ERROR, "%s --> Failed to open the trace (%s)", path, strerror(errno));
+        return -errno;
+    }
+
+    return 0;
+}
+
+void bmi270_harness_close(struct bmi270_harness *h)
+{
+    if (h->record)
+        fclose(h->record);
+
+    if (h->replay)
+        fclose(h->replay);
+
+    h->record = h->replay = NULL;
+}
+
+uint64_t bmi270_harness_now(const struct bmi270_harness *h)
+{
+    return h->now_ns / 1000;
+}
+
+void bmi270_harness_wait(struct bmi270_harness *h, uint64_t us)
+{
+    if (h->realtime)
+        sleep_ns(us * 1000);
+
+    advance(h, us * 1000);
+}
+
+uint64_t bmi270_harness_frame_us(const struct bmi270_harness *h, uint32_t frame)
+{
+    return (h->base_ns + (uint64_t)(int32_t)(frame - h->base_frame) * h->frame_ns) / 1000;
+}
+
+uint32_t bmi270_harness_sample_frame(const struct bmi270_sample *sample)
+{
+    return (uint16_t)sample->acc[0] | (uint32_t)(uint16_t)sample->acc[1] << 16;
+}
+
+int bmi270_harness_transfer(struct bmi270 *sensor, struct i2c_msg *msgs, int nmsgs)
+{
+    struct bmi270_harness *h = sensor->bus_ctx;
+    struct i2c_msg copy[2];
+    struct entry entry;
+    uint8_t write[256], direction, reg, *data;
+    uint32_t hit = 0;
+    uint16_t len;
+    int result = 0, nack = 0;
+
+    if (nmsgs < 1 || nmsgs > 2 || msgs[0].len < 1 || msgs[0].len > sizeof(write))
+        return -EINVAL;
+
+    // Faults must not stick to the driver's buffer across retries: writes go out of a copy
+    memcpy(copy, msgs, nmsgs * sizeof(*msgs));
+    memcpy(write, msgs[0].buf, msgs[0].len);
+    copy[0].buf = write;
+
+    direction = nmsgs == 2 ? FAULT_READ : FAULT_WRITE;
+    reg = write[0];
+    data = direction == FAULT_READ ? copy[1].buf : write + 1;
+    len = direction == FAULT_READ ? copy[1].len : copy[0].len - 1;
+
+    h->transactions++;
+
+    if (h->replay && (result = read_entry(h, &entry)) <= 0)
+    {
+        h->divergences++;
+        bmi270_log(BMI270_LOG_ERROR, "0x%X --> Replay trace %s at transaction %llu", sensor->i2c_addr, result < 0 ? "unreadable" : "ended", (unsigned long long)h->transactions);
+        return -ENODATA;
+    }
+
+    advance(h, bus_ns(h, copy, nmsgs));
+
+    for (int i = 0; i < h->num_faults; i++)
+    {
+        struct bmi270_fault *fault = &h->faults[i];
+
+        if (!fault_hits(h, fault, direction, reg))
+            continue;
+
+        hit |= UINT32_C(1) << i;
+
+        switch (fault->type)
+        {
+        case (FAULT_NACK):
+            nack = fault->error ? fault->error : -EREMOTEIO;
+            break;
+        case (FAULT_DELAY):
+            if (h->realtime)
+                sleep_ns((uint64_t)fault->delay_us * 1000);
+
+            advance(h, (uint64_t)fault->delay_us * 1000);
+            break;
+        case (FAULT_CORRUPT):
+            if (direction == FAULT_WRITE && fault->offset < len)
+                data[fault->offset] ^= fault->mask;
+            break;
+        case (FAULT_RESET):
+            if (h->sim)
+            {
+                bmi270_sim_init(h->sim);
+                h->skipped = h->time_pos = h->full = h->pending = 0;
+                h->partial = h->cut_len = h->read_left = 0;
+                update_timing(h);
+            }
+            break;
+        }
+    }
+
+    if (nack)
+        result = nack;
+    else if (h->replay)
+        result = replay_transfer(h, sensor, &entry, direction, reg, data, len);
+    else
+        result = bus_transfer(h, sensor, copy, nmsgs);
+
+    for (int i = 0; i < h->num_faults && direction == FAULT_READ && result >= 0; i++)
+    {
+        if (hit & (UINT32_C(1) << i) && h->faults[i].type == FAULT_CORRUPT && h->faults[i].offset < len)
+            data[h->faults[i].offset] ^= h->faults[i].mask;
+    }
+
+    // The trace sets the pace: delays the transaction had when it was recorded
+    if (h->replay && entry.time_ns > h->now_ns)
+        advance(h, entry.time_ns - h->now_ns);
+
+    // The driver's view: data it wrote, data and results it got back
+    if (h->record)
+        record(h, direction, reg, direction == FAULT_READ ? data : msgs[0].buf + 1, len, result);
+
+    return result;
+}
@@ -0,0 +1,187 @@
+#pragma once
+
+#ifndef BMI270_HARNESS_H
+#define BMI270_HARNESS_H
+
+#include <stdio.h>
+
+#include "bmi270_sim.h"
+
+/* ----------------------------------------------------
+                    DEFINITIONS
+-----------------------------------------------------*/
+
+/*
+ * Test harness between the driver and its bus (struct bmi270.transfer), the
+ * driver code runs unmodified on top of it:
+ *
+ *     - backends: the simulated BMI270, a recorded trace (replay) or the real
+ *       bus the sensor was set up with
+ *     - virtual clock: every transaction takes its I2C bus time, injected
+ *       delays and bmi270_harness_wait advance it, so runs are deterministic
+ *       (realtime also sleeps, for the real bus and wall clock latency)
+ *     - ODR timing (simulated BMI270): data frames are pushed into the FIFO at
+ *       the configured ODRs as the clock advances, overflow drops the oldest
+ *       frames behind a skip frame, a frame cut off at the end of the read
+ *       announced by FIFO_LENGTH is repeated, reads past the fill level
+ *       return a sensortime frame and SENSORTIME_0 - 2 follow the clock
+ *     - faults: NACKs, delays, corrupted bytes and sensor resets, hitting
+ *       chosen transactions (register, direction, time, how many)
+ *     - record / replay: one text line per transaction, as the driver saw it
+ *
+ *       <time_ns> <r|w> <reg> <len> <result> <bytes>
+ *
+ *       time is the clock when the transaction completed, bytes are the data
+ *       read (result >= 0) or written, hex. Replay serves reads and results
+ *       from the trace, holds the clock to it, compares writes and counts
+ *       divergences: a run with faults replays without them.
+ *
+ * Data frames count: acc x / y hold the low / high 16 bits of the frame number,
+ * gyr x the low 16 bits, so samples lost without a SAMPLE_GAP show up as jumps.
+ */
+
+#define HARNESS_MAX_FAULTS  16
+#define HARNESS_BUS_HZ      400000             // Default I2C clock (fast mode)
+#define HARNESS_LINE_LEN    1024               // Trace line, longest transfer: 255 bytes
+
+// Fault Types
+#define FAULT_NACK          UINT8_C(1)         // Transfer fails with error, the sensor sees nothing
+#define FAULT_DELAY         UINT8_C(2)         // Transfer takes delay_us longer
+#define FAULT_CORRUPT       UINT8_C(3)         // Data byte offset XOR mask (reads after, writes before the sensor)
+#define FAULT_RESET         UINT8_C(4)         // Simulated sensor powers up again before the transfer
+
+// Fault Directions
+#define FAULT_READ          UINT8_C(0x01)
+#define FAULT_WRITE         UINT8_C(0x02)
+#define FAULT_ANY_REG       -1
+
+struct bmi270_fault
+{
+    /* FAULT_* */
+    uint8_t type;
+
+    /* Transactions hit: FAULT_READ / FAULT_WRITE, register (FAULT_ANY_REG = all) */
+    uint8_t direction;
+    int16_t reg;
+
+    /* Matching transactions let through first, not before after_us (virtual clock) */
+    uint32_t skip;
+    uint64_t after_us;
+
+    /* Matching transactions hit (0 = all following) */
+    uint32_t count;
+
+    /* FAULT_NACK: negative errno (0 = -EREMOTEIO) */
+    int error;
+
+    /* FAULT_DELAY */
+    uint32_t delay_us;
+
+    /* FAULT_CORRUPT: byte of the data and the bits flipped */
+    uint16_t offset;
+    uint8_t mask;
+
+    /* Matching transactions seen and hit so far */
+    uint32_t seen;
+    uint32_t hits;
+};
+
+struct bmi270_harness
+{
+    /* Simulated BMI270 (NULL: replay or real bus), trace to replay (NULL: none) */
+    struct bmi270_sim *sim;
+    FILE *replay;
+
+    /* Wrapped transfer and its context (transfer NULL: I2C_RDWR on i2c_fd) */
+    int (*transfer)(struct bmi270 *sensor, struct i2c_msg *msgs, int nmsgs);
+    void *bus_ctx;
+
+    /* Trace being written (NULL: none) */
+    FILE *record;
+
+    /* Virtual clock (ns), I2C clock for the bus time, sleep for delays and waits */
+    uint64_t now_ns;
+    uint32_t bus_hz;
+    uint8_t realtime;
+
+    /* Faults */
+    struct bmi270_fault faults[HARNESS_MAX_FAULTS];
+    uint8_t num_faults;
+
+    /* ODR timing: frame period (0 = no frames), next frame, frames generated, time of the last one */
+    uint64_t frame_ns;
+    uint64_t next_frame_ns;
+    uint32_t frame;
+    uint64_t last_frame_ns;
+
+    /* Frame number and time the current frame period started at */
+    uint32_t base_frame;
+    uint64_t base_ns;
+
+    /* Frames lost to overflow behind the skip frame at the FIFO start, sensortime frame bytes served */
+    uint8_t skipped;
+    uint8_t time_pos;
+
+    /* Bytes left of a frame a burst ended in and the bytes read of it, new frames lost meanwhile (skip frame follows) */
+    uint16_t partial;
+    uint8_t cut[32];
+    uint8_t cut_len;
+    uint8_t pending;
+
+    /* Overflow since INT_STATUS_1 was last read */
+    uint8_t full;
+
+    /* Bytes left of the FIFO read announced by the last FIFO_LENGTH read */
+    uint16_t read_left;
+
+    /* Transactions, injected faults, replay divergences, frames lost to overflow */
+    uint64_t transactions;
+    uint32_t injected;
+    uint32_t divergences;
+    uint64_t overflow_frames;
+
+    /* Line buffer of the trace */
+    char line[HARNESS_LINE_LEN];
+};
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+/* Clock at 0, no faults, 400 kHz bus - sim drives ODR timing and FAULT_RESET (NULL = none) */
+void bmi270_harness_init(struct bmi270_harness *h, struct bmi270_sim *sim);
+
+/* Route the sensor's transfers through the harness, to the sim if it has one or else the sensor's current transfer */
+void bmi270_harness_attach(struct bmi270_harness *h, struct bmi270 *sensor);
+
+/* Add a fault - returns its index */
+int bmi270_harness_add_fault(struct bmi270_harness *h, const struct bmi270_fault *fault);
+
+/* Remove all faults */
+void bmi270_harness_clear_faults(struct bmi270_harness *h);
+
+/* Write every following transaction to path */
+int bmi270_harness_record(struct bmi270_harness *h, const char *path);
+
+/* Serve every following transaction from the trace at path instead of the wrapped transfer */
+int bmi270_harness_replay(struct bmi270_harness *h, const char *path);
+
+/* Close the record and replay files */
+void bmi270_harness_close(struct bmi270_harness *h);
+
+/* Virtual clock (us) */
+uint64_t bmi270_harness_now(const struct bmi270_harness *h);
+
+/* Advance the clock by us, pushing the frames due into the simulated FIFO */
+void bmi270_harness_wait(struct bmi270_harness *h, uint64_t us);
+
+/* Time (us) the data frame with this number was generated at */
+uint64_t bmi270_harness_frame_us(const struct bmi270_harness *h, uint32_t frame);
+
+/* Frame number of a FIFO sample generated by the harness */
+uint32_t bmi270_harness_sample_frame(const struct bmi270_sample *sample);
+
+/* Bus transfer implementation (struct bmi270.transfer) */
+int bmi270_harness_transfer(struct bmi270 *sensor, struct i2c_msg *msgs, int nmsgs);
+
+#endif // BMI270_HARNESS_H
@@ -0,0 +1,232 @@
+#include <linux/i2c.h>
+#include <string.h>
+
+#include "bmi270_regs.h"
+#include "bmi270_sim.h"
+
+// Self-test response of a healthy sensor to positive excitation (mg), negative is mirrored
+static const int32_t self_test_mg[3] = {8500, -8000, 5500};
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+void bmi270_sim_init(struct bmi270_sim *sim)
+{
+    memset(sim, 0, sizeof(*sim));
+
+    sim->regs[CHIP_ID_ADDRESS] = BMI270_CHIP_ID;
+    sim->regs[ACC_CONF] = 0xA8;
+    sim->regs[ACC_RANGE] = ACC_RANGE_8G;
+    sim->regs[GYR_CONF] = 0xA9;
+    sim->regs[PWR_CONF] = 0x03;
+}
+
+void bmi270_sim_attach(struct bmi270 *sensor, struct bmi270_sim *sim)
+{
+    sensor->transfer = bmi270_sim_transfer;
+    sensor->bus_ctx = sim;
+}
+
+static void update_data(struct bmi270_sim *sim)
+{
+    // Slowly changing values, different per axis
+    for (int i = 0; i < 6; i++)
+    {
+        int16_t value = (int16_t)((sim->sample * (i + 1) * 37) & 0x0FFF) - 0x0800;
+
+        sim->regs[ACC_X_7_0 + 2 * i] = value & FULL_MASK_8BIT;
+        sim->regs[ACC_X_7_0 + 2 * i + 1] = (uint16_t)value >> 8;
+    }
+
+    // Accelerometer self-test: the excitation dominates the output
+    if (sim->regs[ACC_SELF_TEST] & ACC_ST_EN)
+    {
+        int32_t sign = sim->regs[ACC_SELF_TEST] & ACC_ST_SIGN_POS ? 1 : -1;
+        int32_t range_mg = ACC_RANGE_G(sim->regs[ACC_RANGE] & FIELD_MAX(ACC_RANGE_SEL)) * 1000;
+
+        for (int i = 0; i < 3; i++)
+        {
+            int16_t value = (int16_t)(sign * self_test_mg[i] * 32768 / range_mg);
+
+            sim->regs[ACC_X_7_0 + 2 * i] = value & FULL_MASK_8BIT;
+            sim->regs[ACC_X_7_0 + 2 * i + 1] = (uint16_t)value >> 8;
+        }
+    }
+
+    sim->sample++;
+}
+
+static void update_fifo_int(struct bmi270_sim *sim)
+{
+    uint16_t watermark = (sim->regs[FIFO_WTM_1] << 8 | sim->regs[FIFO_WTM_0]) & FIFO_WTM_MASK;
+
+    // FIFO interrupts follow the fill level, watermark 0 never fires
+    sim->regs[INT_STATUS_1] &= ~(FWM_INT_STATUS | FFULL_INT_STATUS);
+
+    if (watermark && sim->fifo_len >= watermark)
+        sim->regs[INT_STATUS_1] |= FWM_INT_STATUS;
+
+    if (sim->fifo_len == FIFO_SIZE)
+        sim->regs[INT_STATUS_1] |= FFULL_INT_STATUS;
+}
+
+uint16_t bmi270_sim_fifo_push(struct bmi270_sim *sim, const uint8_t *data, uint16_t len)
+{
+    if (len > FIFO_SIZE - sim->fifo_len)
+        len = FIFO_SIZE - sim->fifo_len;
+
+    memcpy(sim->fifo + sim->fifo_len, data, len);
+    sim->fifo_len += len;
+
+    update_fifo_int(sim);
+
+    return len;
+}
+
+static void read_fifo_data(struct bmi270_sim *sim, uint8_t *data, uint16_t len)
+{
+    uint16_t available = len < sim->fifo_len ? len : sim->fifo_len;
+
+    memcpy(data, sim->fifo, available);
+    memmove(sim->fifo, sim->fifo + available, sim->fifo_len - available);
+    sim->fifo_len -= available;
+
+    update_fifo_int(sim);
+
+    // Reading beyond the fill level returns the empty marker
+    memset(data + available, FIFO_EMPTY, len - available);
+}
+
+static uint8_t read_reg(struct bmi270_sim *sim, uint8_t reg)
+{
+    uint8_t value;
+
+    if (reg >= FEATURES_IN && reg < FEATURES_IN + FEAT_PAGE_SIZE)
+        return sim->pages[sim->regs[FEAT_PAGE] % SIM_NUM_PAGES][reg - FEATURES_IN];
+
+    if (reg == FIFO_LENGTH_0)
+        return sim->fifo_len & FULL_MASK_8BIT;
+
+    if (reg == FIFO_LENGTH_1)
+        return sim->fifo_len >> 8;
+
+    value = sim->regs[reg % SIM_NUM_REGS];
+
+    // Interrupt status is clear on read
+    if (reg == INT_STATUS_0 || reg == INT_STATUS_1)
+        sim->regs[reg] = 0;
+
+    return value;
+}
+
+static void write_reg(struct bmi270_sim *sim, uint8_t reg, uint8_t value)
+{
+    if (reg >= FEATURES_IN && reg < FEATURES_IN + FEAT_PAGE_SIZE)
+    {
+        sim->pages[sim->regs[FEAT_PAGE] % SIM_NUM_PAGES][reg - FEATURES_IN] = value;
+        return;
+    }
+
+    sim->regs[reg % SIM_NUM_REGS] = value;
+
+    if (reg == INIT_CTRL && value == 0x01)
+    {
+        sim->regs[INTERNAL_STATUS] = STATUS_INIT_OK;
+        sim->pages[FEAT_PAGE_CONFIG_ID][FEAT_OFF_CONFIG_ID] = SIM_CONFIG_VERSION & FULL_MASK_8BIT;
+        sim->pages[FEAT_PAGE_CONFIG_ID][FEAT_OFF_CONFIG_ID + 1] = SIM_CONFIG_VERSION >> 8;
+    }
+
+    if (reg == CMD && value == SOFT_RESET)
+        bmi270_sim_init(sim);
+
+    if (reg == CMD && value == FIFO_FLUSH)
+        sim->fifo_len = 0;
+
+    // Gyroscope self-test completes immediately, all axes pass
+    if (reg == CMD && value == G_TRIGGER)
+        sim->regs[GYR_SELF_TEST_AXES] = GYR_ST_DONE | GYR_ST_AXES_OK;
+}
+
+static uint32_t init_offset(struct bmi270_sim *sim)
+{
+    // INIT_ADDR counts 16 bit words, INIT_ADDR_0 holds bits 3:0
+    return 2 * ((sim->regs[INIT_ADDR_0] & LSB_MASK_8BIT) | (sim->regs[INIT_ADDR_1] << 4));
+}
+
+static void write_init_data(struct bmi270_sim *sim, const uint8_t *data, uint16_t len)
+{
+    uint32_t offset = init_offset(sim);
+
+    for (uint16_t i = 0; i < len && offset + i < SIM_CONFIG_SIZE; i++)
+    {
+        sim->config[offset + i] = data[i];
+    }
+}
+
+static void read_init_data(struct bmi270_sim *sim, uint8_t *data, uint16_t len)
+{
+    uint32_t offset = init_offset(sim);
+
+    for (uint16_t i = 0; i < len; i++)
+    {
+        data[i] = offset + i < SIM_CONFIG_SIZE ? sim->config[offset + i] : 0;
+    }
+}
+
+int bmi270_sim_transfer(struct bmi270 *sensor, struct i2c_msg *msgs, int nmsgs)
+{
+    struct bmi270_sim *sim = sensor->bus_ctx;
+    uint8_t reg;
+
+    sim->transactions++;
+
+    if (nmsgs < 1 || msgs[0].len < 1 || (msgs[0].flags & I2C_M_RD))
+        return -1;
+
+    reg = msgs[0].buf[0];
+
+    // Register write: address followed by data, auto-increment
+    if (nmsgs == 1)
+    {
+        if (reg == INIT_DATA)
+            write_init_data(sim, &msgs[0].buf[1], msgs[0].len - 1);
+        else
+            for (uint16_t i = 1; i < msgs[0].len; i++)
+                write_reg(sim, reg + i - 1, msgs[0].buf[i]);
+
+        sim->bytes_written += msgs[0].len - 1;
+        return 1;
+    }
+
+    // Register read: address write followed by read, auto-increment
+    if (!(msgs[1].flags & I2C_M_RD))
+        return -1;
+
+    if (reg <= GYR_Z_15_8 && reg + msgs[1].len > ACC_X_7_0)
+        update_data(sim);
+
+    // FIFO_DATA does not auto-increment
+    if (reg == FIFO_DATA)
+    {
+        read_fifo_data(sim, msgs[1].buf, msgs[1].len);
+        sim->bytes_read += msgs[1].len;
+        return 2;
+    }
+
+    // INIT_DATA reads back the config file from INIT_ADDR
+    if (reg == INIT_DATA)
+    {
+        read_init_data(sim, msgs[1].buf, msgs[1].len);
+        sim->bytes_read += msgs[1].len;
+        return 2;
+    }
+
+    for (uint16_t i = 0; i < msgs[1].len; i++)
+    {
+        msgs[1].buf[i] = read_reg(sim, reg + i);
+    }
+
+    sim->bytes_read += msgs[1].len;
+    return 2;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#ifndef BMI270_SIM_H
+#define BMI270_SIM_H
+
+#include "bmi270.h"
+
+/* ----------------------------------------------------
+                    DEFINITIONS
+-----------------------------------------------------*/
+
+#define SIM_NUM_REGS        128
+#define SIM_NUM_PAGES       8
+#define SIM_CONFIG_SIZE     CONFIG_FILE_SIZE
+#define SIM_CONFIG_VERSION  CONFIG_FILE_VERSION // Reported after a config file upload
+
+struct bmi270_sim
+{
+    /* Register file */
+    uint8_t regs[SIM_NUM_REGS];
+
+    /* Feature configuration pages (FEAT_PAGE) */
+    uint8_t pages[SIM_NUM_PAGES][FEAT_PAGE_SIZE];
+
+    /* Uploaded config file (INIT_DATA) */
+    uint8_t config[SIM_CONFIG_SIZE];
+
+    /* FIFO contents (FIFO_DATA reads consume them) */
+    uint8_t fifo[FIFO_SIZE];
+    uint16_t fifo_len;
+
+    /* Synthetic sample counter, advanced on every data read */
+    uint32_t sample;
+
+    /* Bus transactions (ioctl calls) */
+    uint64_t transactions;
+
+    /* Register bytes read and written */
+    uint64_t bytes_read;
+    uint64_t bytes_written;
+};
+
+/* ----------------------------------------------------
+                     FUNCTIONS
+-----------------------------------------------------*/
+
+/* Power-on state: chip ID set, not initialized */
+void bmi270_sim_init(struct bmi270_sim *sim);
+
+/* Route all sensor bus transfers to the simulated BMI270 */
+void bmi270_sim_attach(struct bmi270 *sensor, struct bmi270_sim *sim);
+
+/* Append bytes (e.g. frames) to the FIFO - returns the number of bytes that fit */
+uint16_t bmi270_sim_fifo_push(struct bmi270_sim *sim, const uint8_t *data, uint16_t len);
+
+/* Bus transfer implementation (struct bmi270.transfer) */
+int bmi270_sim_transfer(struct bmi270 *sensor, struct i2c_msg *msgs, int nmsgs);
+
+#endif // BMI270_SIM_H
@@ -0,0 +1,417 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "bmi270.h"
+#include "bmi270_sim.h"
+#include "bmi270_stats.h"
+
+#define MAX_DEVICES 16                  // Sensors on the command line
+#define MAX_BUSES 8                     // Distinct buses on the command line
+#define PATH_LEN 32                     // I2C bus device path length
+#define MAX_LATENCIES 65536             // Timed transactions per sweep step
+#define STEP_MS 500                     // Default duration per sweep step
+#define SAMPLE_SIZE 12                  // Acc + gyr burst (bytes)
+
+struct device
+{
+    char bus[PATH_LEN];
+    uint8_t addr;
+    struct bmi270 sensor;
+    struct bmi270_stats stats;
+    struct bmi270_sim sim;
+    int ok;
+};
+
+struct step
+{
+    long reads;
+    long errors;
+    long overruns;
+    double seconds;
+    double p50_us;
+    double p90_us;
+    double p99_us;
+    double max_us;
+};
+
+// Register reads up to SAMPLE_SIZE, larger bursts from FIFO_DATA (no auto-increment)
+static const uint8_t read_sizes[] = {1, 6, SAMPLE_SIZE, 64, 128, 255};
+static const double rates[] = {100.0, 200.0, 400.0, 800.0, 1600.0, 3200.0};
+
+static struct device devices[MAX_DEVICES];
+static int num_devices;
+
+static uint64_t latencies[MAX_LATENCIES];
+
+/* ----------------------------------------------------
+                    HELPER FUNCTIONS
+-----------------------------------------------------*/
+
+static int compare_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+static const char *internal_status_str(uint8_t status)
+{
+    static const char *messages[] = {"not initialized", "initialized", "init error", "driver error",
+                                     "sensor stopped", "NVM error", "start-up error", "compatibility error"};
+    uint8_t message = status & STATUS_MSG_MASK;
+
+    return message < sizeof(messages) / sizeof(messages[0]) ? messages[message] : "reserved";
+}
+
+static int read_once(struct bmi270 *sensor, uint8_t size, uint8_t *buffer)
+{
+    if (size == 1)
+        return read_register(sensor, STATUS, buffer);
+
+    return read_register_block(sensor, size <= SAMPLE_SIZE ? DATA_REG : FIFO_DATA, buffer, size);
+}
+
+static void timespec_add(struct timespec *ts, uint64_t ns)
+{
+    ts->tv_nsec += ns;
+
+    while (ts->tv_nsec >= 1000000000L)
+    {
+        ts->tv_nsec -= 1000000000L;
+        ts->tv_sec++;
+    }
+}
+
+/* Read size bytes from every device in turn, at rate_hz rounds per second (0 = as fast as possible) */
+static void run_step(struct device **group, int n, uint8_t size, double rate_hz, uint64_t duration_ns, struct step *step)
+{
+    uint8_t buffer[255];
+    uint64_t period_ns = rate_hz > 0.0 ? (uint64_t)(1e9 / rate_hz) : 0;
+    uint64_t start = bmi270_stats_now(), end = start + duration_ns, now = start;
+    long count = 0;
+    struct timespec next;
+
+    memset(step, 0, sizeof(*step));
+    clock_gettime(CLOCK_MONOTONIC, &next);
+
+    while (now < end)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            uint64_t before = bmi270_stats_now();
+
+            if (read_once(&group[i]->sensor, size, buffer) < 0)
+                step->errors++;
+
+            now = bmi270_stats_now();
+
+            if (count < MAX_LATENCIES)
+                latencies[count++] = now - before;
+
+            step->reads++;
+        }
+
+        if (period_ns == 0)
+            continue;
+
+        // Late rounds are counted and not made up for, like the manager's bus workers
+        timespec_add(&next, period_ns);
+        now = bmi270_stats_now();
+
+        if ((uint64_t)next.tv_sec * 1000000000ULL + (uint64_t)next.tv_nsec < now)
+        {
+            step->overruns++;
+            clock_gettime(CLOCK_MONOTONIC, &next);
+            continue;
+        }
+
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+        now = bmi270_stats_now();
+    }
+
+    step->seconds = (now - start) / 1e9;
+
+    if (count == 0)
+        return;
+
+    qsort(latencies, count, sizeof(latencies[0]), compare_u64);
+
+    step->p50_us = latencies[(long)(0.50 * (count - 1))] / 1000.0;
+    step->p90_us = latencies[(long)(0.90 * (count - 1))] / 1000.0;
+    step->p99_us = latencies[(long)(0.99 * (count - 1))] / 1000.0;
+    step->max_us = latencies[count - 1] / 1000.0;
+}
+
+static void print_header(const char *first)
+{
+    printf("  %-8s %10s %10s %9s %9s %9s %9s %8s %8s\n", first, "reads/s", "kB/s", "p50 us", "p90 us", "p99 us", "max us", "overruns", "errors");
+}
+
+static void print_step(const char *first, const struct step *step, uint8_t size)
+{
+    double per_second = step->seconds > 0.0 ? step->reads / step->seconds : 0.0;
+
+    printf("  %-8s %10.0f %10.1f %9.1f %9.1f %9.1f %9.1f %8ld %8ld\n", first, per_second, per_second * size / 1000.0,
+           step->p50_us, step->p90_us, step->p99_us, step->max_us, step->overruns, step->errors);
+}
+
+static void sweep(struct device **group, int n, uint64_t step_ns)
+{
+    struct step step;
+    char label[16];
+
+    printf("\n  Read size sweep (%d device%s, unthrottled)\n", n, n == 1 ? "" : "s");
+    print_header("bytes");
+
+    for (size_t i = 0; i < sizeof(read_sizes); i++)
+    {
+        run_step(group, n, read_sizes[i], 0.0, step_ns, &step);
+        snprintf(label, sizeof(label), "%u", read_sizes[i]);
+        print_step(label, &step, read_sizes[i]);
+    }
+
+    printf("\n  Rate sweep (%d byte reads, target per device)\n", SAMPLE_SIZE);
+    print_header("Hz");
+
+    for (size_t i = 0; i < sizeof(rates) / sizeof(rates[0]); i++)
+    {
+        run_step(group, n, SAMPLE_SIZE, rates[i], step_ns, &step);
+        snprintf(label, sizeof(label), "%.0f", rates[i]);
+        print_step(label, &step, SAMPLE_SIZE);
+    }
+}
+
+static int check_device(struct device *device, int self_test)
+{
+    uint8_t err_reg, internal_status, axes;
+    uint16_t version;
+    int32_t diff_mg[3];
+    int result, failed = 0;
+
+    printf("  chip id:          0x%02X\n", device->sensor.chip_id);
+
+    if ((result = get_error_status(&device->sensor, &err_reg, &internal_status)) < 0)
+    {
+        printf("  status:           %s\n", strerror(-result));
+        return 1;
+    }
+
+    printf("  internal status:  0x%02X (%s%s%s)\n", internal_status, internal_status_str(internal_status),
+           internal_status & STATUS_REMAP_ERR ? ", axes remap error" : "",
+           internal_status & STATUS_ODR_50HZ_ERR ? ", ODR below 50Hz" : "");
+    printf("  error register:   0x%02X (%s%s%s%s)\n", err_reg, err_reg ? "" : "none",
+           err_reg & ERR_FATAL ? "fatal " : "", err_reg & ERR_FIFO ? "fifo " : "", err_reg & ERR_AUX ? "aux " : "");
+
+    if (err_reg & ERR_INTERNAL_MASK)
+        printf("  internal error:   %u\n", (err_reg & ERR_INTERNAL_MASK) >> 1);
+
+    if (get_config_version(&device->sensor, &version) == 0)
+        printf("  config version:   0x%04X\n", version);
+
+    failed |= (internal_status & STATUS_MSG_MASK) != STATUS_INIT_OK || (err_reg & ERR_FATAL);
+
+    if (!self_test)
+        return failed;
+
+    if ((result = perform_acc_self_test(&device->sensor, diff_mg)) < 0)
+        printf("  acc self-test:    %s\n", strerror(-result));
+    else
+        printf("  acc self-test:    %s (x: %d mg, y: %d mg, z: %d mg)\n", result ? "PASS" : "FAIL", diff_mg[0], diff_mg[1], diff_mg[2]);
+
+    failed |= result != 1;
+
+    if ((result = perform_gyr_self_test(&device->sensor, &axes)) < 0)
+        printf("  gyr self-test:    %s\n", strerror(-result));
+    else
+        printf("  gyr self-test:    %s (x: %s, y: %s, z: %s)\n", result ? "PASS" : "FAIL",
+               axes & BIT_1 ? "ok" : "fail", axes & BIT_2 ? "ok" : "fail", axes & BIT_3 ? "ok" : "fail");
+
+    failed |= result != 1;
+
+    return failed;
+}
+
+static int add_device(const char *arg, int simulated)
+{
+    struct device *device = &devices[num_devices];
+    const char *separator = strrchr(arg, ':');
+    int result;
+
+    if (num_devices == MAX_DEVICES || separator == NULL || (size_t)(separator - arg) >= sizeof(device->bus))
+    {
+        fprintf(stderr, "Invalid sensor: %s\n", arg);
+        return -EINVAL;
+    }
+
+    memset(device, 0, sizeof(*device));
+    memcpy(device->bus, arg, separator - arg);
+    device->addr = (uint8_t)strtol(separator + 1, NULL, 0);
+    device->sensor.i2c_addr = device->addr;
+    device->sensor.i2c_fd = -1;
+
+    if (simulated)
+    {
+        bmi270_sim_init(&device->sim);
+        bmi270_sim_attach(&device->sensor, &device->sim);
+    }
+
+    num_devices++;
+
+    if ((result = bmi270_init_bus(&device->sensor, device->bus)) < 0)
+    {
+        fprintf(stderr, "Could not initialize %s: %s\n", arg, strerror(-result));
+        return 0;
+    }
+
+    // Retries would hide the bus error rate
+    device->sensor.max_retries = 0;
+    bmi270_stats_attach(&device->sensor, &device->stats);
+    device->ok = 1;
+
+    return 0;
+}
+
+static void usage(const char *name)
+{
+    fprintf(stderr, "Usage: %s [-S] [-t] [-T] [-d ms] [-v] [<bus>:<address> ...]\n"
+                    "  -S     simulated sensors (no hardware)\n"
+                    "  -t     skip self-tests\n"
+                    "  -T     skip throughput sweeps\n"
+                    "  -d ms  duration per sweep step (default %d)\n"
+                    "  -v     driver log output\n"
+                    "Default sensor: %s:0x%02X\n", name, STEP_MS, I2C_DEVICE, I2C_PRIM_ADDR);
+}
+
+/* ----------------------------------------------------
+                        MAIN
+-----------------------------------------------------*/
+
+// Usage: bmi270_diag /dev/i2c-1:0x68 /dev/i2c-1:0x69 /dev/i2c-3:0x68 ...
+int main(int argc, char **argv)
+{
+    int simulated = 0, self_test = 1, throughput = 1, step_ms = STEP_MS, failed = 0, opt;
+    const char *buses[MAX_BUSES];
+    int num_buses = 0;
+    char fallback[PATH_LEN + 8];
+
+    while ((opt = getopt(argc, argv, "StTd:vh")) != -1)
+    {
+        switch (opt)
+        {
+        case 'S':
+            simulated = 1;
+            break;
+        case 't':
+            self_test = 0;
+            break;
+        case 'T':
+            throughput = 0;
+            break;
+        case 'd':
+            step_ms = atoi(optarg);
+            break;
+        case 'v':
+            bmi270_set_log_handler(bmi270_log_print, BMI270_LOG_INFO, stderr);
+            break;
+        default:
+            usage(argv[0]);
+            return opt == 'h' ? 0 : 2;
+        }
+    }
+
+    if (step_ms <= 0)
+    {
+        usage(argv[0]);
+        return 2;
+    }
+
+    if (optind == argc)
+    {
+        snprintf(fallback, sizeof(fallback), "%s:0x%02X", I2C_DEVICE, I2C_PRIM_ADDR);
+
+        if (add_device(fallback, simulated) < 0)
+            return 2;
+    }
+
+    for (int i = optind; i < argc; i++)
+    {
+        if (add_device(argv[i], simulated) < 0)
+            return 2;
+    }
+
+    // -------------------------------------------------
+    // DEVICES
+    // -------------------------------------------------
+
+    for (int i = 0; i < num_devices; i++)
+    {
+        struct device *device = &devices[i];
+        struct device *group[1] = {device};
+
+        printf("== %s:0x%02X%s ==\n", device->bus, device->addr, simulated ? " (simulated)" : "");
+
+        if (!device->ok)
+        {
+            printf("  not available\n\n");
+            failed = 1;
+            continue;
+        }
+
+        failed |= check_device(device, self_test);
+
+        if (throughput)
+        {
+            sweep(group, 1, (uint64_t)step_ms * 1000000ULL);
+
+            printf("\n");
+            bmi270_stats_dump(&device->stats, stdout, "  stats");
+        }
+
+        printf("\n");
+    }
+
+    // -------------------------------------------------
+    // BUSES
+    // -------------------------------------------------
+
+    // Devices sharing a bus compete for it: measure them together
+    for (int i = 0; throughput && i < num_devices; i++)
+    {
+        struct device *group[MAX_DEVICES];
+        int n = 0, seen = 0;
+
+        for (int j = 0; j < num_buses; j++)
+            seen |= strcmp(buses[j], devices[i].bus) == 0;
+
+        if (seen || num_buses == MAX_BUSES)
+            continue;
+
+        buses[num_buses++] = devices[i].bus;
+
+        for (int j = i; j < num_devices; j++)
+        {
+            if (devices[j].ok && strcmp(devices[j].bus, devices[i].bus) == 0)
+                group[n++] = &devices[j];
+        }
+
+        if (n < 2)
+            continue;
+
+        printf("== %s (%d devices, round robin) ==\n", devices[i].bus, n);
+        sweep(group, n, (uint64_t)step_ms * 1000000ULL);
+        printf("\n");
+    }
+
+    for (int i = 0; i < num_devices; i++)
+    {
+        bmi270_close(&devices[i].sensor);
+    }
+
+    return failed;
+}
@@ -0,0 +1,558 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "bmi270.h"
+#include "bmi270_fifo.h"
+#include "bmi270_harness.h"
+#include "bmi270_recovery.h"
+#include "bmi270_regs.h"
+#include "bmi270_sim.h"
+#include "bmi270_watermark.h"
+
+#define MAX_SAMPLES 512                 // Samples per FIFO read (a full FIFO holds 472)
+#define MAX_FAULTS 4                    // Faults per scenario
+#define READ_PERIOD_US 20000            // FIFO read period of the workload
+#define RESUME_US 100000                // Samples must be this fresh at the end of a run
+#define WTM_POLL_US 100                 // FWM_INT pin check period of the watermark workload
+
+struct scenario
+{
+    const char *name;
+    const char *description;
+
+    /* Virtual run time and bus clock (0 = HARNESS_BUS_HZ) */
+    uint32_t duration_ms;
+    uint32_t bus_hz;
+
+    struct bmi270_fault faults[MAX_FAULTS];
+
+    /* Expected gaps, recoveries and config uploads */
+    uint32_t gaps;
+    uint32_t recoveries;
+    uint32_t uploads;
+
+    /* Samples lost must equal the frames dropped by overflow */
+    uint8_t exact_loss;
+
+    /* Worst sample latency allowed (us) */
+    uint64_t max_latency_us;
+
+    /* Frames cut off by a failed FIFO burst, lost on top of the overflow ones (exact_loss) */
+    uint32_t cut_frames;
+
+    /* Adaptive watermark latency budget (us): reads on FWM_INT instead of every READ_PERIOD_US, 0 = off */
+    uint32_t budget_us;
+};
+
+struct result
+{
+    uint64_t samples;
+    uint32_t gaps;
+    uint64_t lost;
+    uint64_t silent;
+    uint32_t parse_errors;
+    uint32_t overflows;
+    uint32_t read_errors;
+    uint32_t recoveries;
+    uint32_t uploads;
+    uint8_t state;
+    uint64_t max_latency_us;
+    uint64_t sum_latency_us;
+    uint64_t last_sample_us;
+    uint64_t end_us;
+
+    /* Watermark workload: wakeups counted here, the controller's batching factor and batches over budget */
+    uint64_t wakeups;
+    double batching;
+    uint32_t wm_violations;
+
+    /* Watermark range over the second half of the run (frames) */
+    uint16_t wm_min;
+    uint16_t wm_max;
+};
+
+// Workload: 1600 Hz acc + gyr, header mode FIFO read every READ_PERIOD_US (or on FWM_INT with budget_us), recovery supervised
+static const struct scenario scenarios[] = {
+    {"baseline", "no faults", 2000, 0, {{0}}, 0, 0, 0, 1, 65000},
+    {"nack_burst", "6 NACKs on the FIFO status read: recovery without upload, gap (restore cannot tell)", 2000, 0,
+     {{.type = FAULT_NACK, .direction = FAULT_READ, .reg = INT_STATUS_1, .after_us = 500000, .count = 6}},
+     1, 1, 0, 1, 200000},
+    {"late_read", "one read 400 ms late: FIFO overflow, skip frame, gap", 2000, 0,
+     {{.type = FAULT_DELAY, .direction = FAULT_READ, .reg = INT_STATUS_1, .after_us = 500000, .count = 1, .delay_us = 400000}},
+     1, 0, 0, 1, 450000},
+    {"corrupt_header", "corrupted frame header: parse error, gap", 2000, 0,
+     {{.type = FAULT_CORRUPT, .direction = FAULT_READ, .reg = FIFO_DATA, .after_us = 500000, .count = 1, .offset = 0, .mask = 0x40}},
+     1, 0, 0, 0, 65000},
+    {"nack_fifo_data", "FIFO data read fails with its retry: data stays in the FIFO", 2000, 0,
+     {{.type = FAULT_NACK, .direction = FAULT_READ, .reg = FIFO_DATA, .after_us = 500000, .count = 2}},
+     0, 0, 0, 1, 120000},
+    {"nack_fifo_burst", "second FIFO data burst fails with its retry: first burst parsed, cut frame lost, gap", 2000, 0,
+     {{.type = FAULT_NACK, .direction = FAULT_READ, .reg = FIFO_DATA, .after_us = 500000, .skip = 1, .count = 2}},
+     1, 0, 0, 1, 120000, 1},
+    {"power_glitch", "sensor powers up again: health check, config upload, restore, gap", 3000, 0,
+     {{.type = FAULT_RESET, .direction = FAULT_READ | FAULT_WRITE, .reg = FAULT_ANY_REG, .after_us = 800000, .count = 1}},
+     1, 1, 1, 0, 65000},
+    {"slow_bus", "2 ms clock stretching on every transaction", 2000, 0,
+     {{.type = FAULT_DELAY, .direction = FAULT_READ | FAULT_WRITE, .reg = FAULT_ANY_REG, .delay_us = 2000}},
+     0, 0, 0, 1, 120000},
+    {"watermark", "FIFO read on FWM_INT, adaptive watermark: settles within the budget, batching matches", 2000, 0, {{0}},
+     0, 0, 0, 1, WTM_DEFAULT_BUDGET, 0, WTM_DEFAULT_BUDGET},
+};
+
+#define NUM_SCENARIOS (sizeof(scenarios) / sizeof(scenarios[0]))
+
+static struct bmi270_sample samples[MAX_SAMPLES];
+
+/* ----------------------------------------------------
+                    HELPER FUNCTIONS
+-----------------------------------------------------*/
+
+static const struct scenario *find_scenario(const char *name)
+{
+    for (size_t i = 0; i < NUM_SCENARIOS; i++)
+    {
+        if (strcmp(scenarios[i].name, name) == 0)
+            return &scenarios[i];
+    }
+
+    fprintf(stderr, "Unknown scenario: %s (-l lists them)\n", name);
+    return NULL;
+}
+
+static int configure(struct bmi270 *sensor)
+{
+    int result;
+
+    if ((result = set_mode(sensor, PERFORMANCE_MODE)) < 0 ||
+        (result = set_acc_odr(sensor, ACC_ODR_1600)) < 0 ||
+        (result = set_gyr_odr(sensor, GYR_ODR_1600)) < 0 ||
+        (result = disable_data_streaming(sensor)) < 0 ||
+        (result = FIELD_WRITE(sensor, FIFO_ACC_EN, 1)) < 0 ||
+        (result = FIELD_WRITE(sensor, FIFO_GYR_EN, 1)) < 0 ||
+        (result = enable_fifo_header(sensor)) < 0 ||
+        (result = write_register(sensor, CMD, FIFO_FLUSH)) < 0)
+        return result;
+
+    return 0;
+}
+
+/* Recovery callback: whatever the FIFO held before the sensor came up again is gone */
+static int restart_fifo(struct bmi270 *sensor, void *ctx)
+{
+    struct bmi270_fifo *fifo = ctx;
+
+    (void)sensor;
+    bmi270_fifo_reset(fifo);
+    fifo->gap_pending = 1;
+
+    return 0;
+}
+
+/* Frame numbers must count up by one except at a SAMPLE_GAP (frames from the harness only) */
+static void check_samples(struct bmi270_harness *h, int count, uint64_t now_us, uint32_t *last_frame, int *has_frame, struct result *result)
+{
+    for (int i = 0; i < count; i++)
+    {
+        uint32_t frame = bmi270_harness_sample_frame(&samples[i]);
+        uint64_t latency;
+
+        if (*has_frame && frame != *last_frame + 1 && !(samples[i].flags & SAMPLE_GAP))
+            result->silent += frame - *last_frame - 1;
+
+        *last_frame = frame;
+        *has_frame = 1;
+
+        // Latency needs the frame clock of the sim
+        if (!h->sim)
+            continue;
+
+        latency = now_us - bmi270_harness_frame_us(h, frame);
+
+        if (latency > result->max_latency_us)
+            result->max_latency_us = latency;
+
+        result->sum_latency_us += latency;
+        result->last_sample_us = bmi270_harness_frame_us(h, frame);
+    }
+}
+
+/* Wait for FWM_INT like a GPIO edge would, polling the status the pin follows - returns 1 when it is set */
+static int wait_watermark(struct bmi270_harness *h, struct bmi270 *sensor, uint64_t until_us)
+{
+    uint8_t status;
+
+    while (bmi270_harness_now(h) < until_us)
+    {
+        bmi270_harness_wait(h, WTM_POLL_US);
+
+        if (read_register(sensor, INT_STATUS_1, &status) == 0 && (status & FWM_INT_STATUS))
+            return 1;
+    }
+
+    return 0;
+}
+
+/* Initialize, configure and stream for the scenario's duration on whatever the harness talks to */
+static int run(struct bmi270_harness *h, struct bmi270 *sensor, const struct scenario *scenario, const char *bus, struct result *result)
+{
+    struct bmi270_recovery_config config;
+    struct bmi270_recovery recovery;
+    struct bmi270_watermark_config wm_config;
+    struct bmi270_watermark wm;
+    struct bmi270_fifo fifo;
+    uint64_t end_us, edge_us = 0, settle_us;
+    uint32_t last_frame = 0;
+    int count, has_frame = 0, ret;
+
+    memset(result, 0, sizeof(*result));
+
+    if ((ret = bmi270_init_bus(sensor, bus)) < 0 || (ret = configure(sensor)) < 0 || (ret = bmi270_fifo_init(&fifo, sensor, 0)) < 0)
+        return ret;
+
+    bmi270_recovery_defaults(&config);
+    config.restore = restart_fifo;
+    config.ctx = &fifo;
+
+    if ((ret = bmi270_recovery_init(&recovery, sensor, &config, bmi270_harness_now(h))) < 0)
+        return ret;
+
+    // FWM_INT is only polled here, no pin to map
+    bmi270_watermark_defaults(&wm_config);
+    wm_config.latency_budget_us = scenario->budget_us;
+    wm_config.int_pin = 0;
+
+    if (scenario->budget_us && (ret = bmi270_watermark_init(&wm, sensor, &wm_config)) < 0)
+        return ret;
+
+    // Faults count from the start of streaming, a replayed trace already has them
+    for (int i = 0; i < MAX_FAULTS && scenario->faults[i].type && !h->replay; i++)
+    {
+        struct bmi270_fault fault = scenario->faults[i];
+
+        fault.after_us += bmi270_harness_now(h);
+        bmi270_harness_add_fault(h, &fault);
+    }
+
+    end_us = bmi270_harness_now(h) + (uint64_t)scenario->duration_ms * 1000;
+
+    // The watermark must have settled by the second half of the run
+    settle_us = end_us - (uint64_t)scenario->duration_ms * 500;
+
+    while (bmi270_harness_now(h) < end_us)
+    {
+        if (!scenario->budget_us)
+            bmi270_harness_wait(h, READ_PERIOD_US);
+        else if (wait_watermark(h, sensor, end_us))
+            edge_us = bmi270_harness_now(h) - WTM_POLL_US;
+        else
+            break;
+
+        if (bmi270_recovery_step(&recovery, bmi270_harness_now(h)) != RECOVERY_OK)
+            continue;
+
+        count = bmi270_fifo_read(&fifo, samples, MAX_SAMPLES, bmi270_harness_now(h));
+        bmi270_recovery_report(&recovery, count, bmi270_harness_now(h));
+
+        if (count < 0)
+        {
+            result->read_errors++;
+            continue;
+        }
+
+        result->samples += count;
+
+        if (scenario->budget_us)
+        {
+            // Service time from the edge (one poll before it was seen at worst) to the end of the read
+            bmi270_watermark_update(&wm, (uint32_t)count * wm.config.frame_size, (uint32_t)(bmi270_harness_now(h) - edge_us));
+
+            if (bmi270_harness_now(h) >= settle_us && (result->wm_min == 0 || wm.frames < result->wm_min))
+                result->wm_min = wm.frames;
+
+            if (bmi270_harness_now(h) >= settle_us && wm.frames > result->wm_max)
+                result->wm_max = wm.frames;
+
+            result->wakeups++;
+        }
+
+        if (h->sim || h->replay)
+            check_samples(h, count, bmi270_harness_now(h), &last_frame, &has_frame, result);
+    }
+
+    result->gaps = fifo.gaps;
+    result->lost = fifo.lost;
+    result->parse_errors = fifo.parse_errors;
+    result->overflows = fifo.overflows;
+    result->recoveries = recovery.recoveries;
+    result->uploads = recovery.uploads;
+    result->state = recovery.state;
+    result->end_us = bmi270_harness_now(h);
+
+    if (scenario->budget_us)
+    {
+        result->batching = bmi270_watermark_batching(&wm);
+        result->wm_violations = wm.violations;
+    }
+
+    return 0;
+}
+
+static void print_result(const char *label, const struct result *result, const struct bmi270_harness *h)
+{
+    printf("  %-8s samples %6llu  gaps %u  lost %llu  silent %llu  parse errors %u  overflows %u  read errors %u  recoveries %u  uploads %u"
+           "  latency avg %.1f ms max %.1f ms  transactions %llu  faults %u  divergences %u\n",
+           label, (unsigned long long)result->samples, result->gaps, (unsigned long long)result->lost, (unsigned long long)result->silent,
+           result->parse_errors, result->overflows, result->read_errors, result->recoveries, result->uploads,
+           result->samples ? result->sum_latency_us / 1000.0 / result->samples : 0.0, result->max_latency_us / 1000.0,
+           (unsigned long long)h->transactions, h->injected, h->divergences);
+}
+
+static int expect(int ok, const char *what)
+{
+    if (!ok)
+        printf("  FAILED: %s\n", what);
+
+    return ok ? 0 : 1;
+}
+
+/* Run a scenario on the simulated BMI270 recording a trace, replay it and check both runs */
+static int run_scenario(const struct scenario *scenario, const char *trace_path)
+{
+    static struct bmi270_sim sim;
+    static struct bmi270_harness sim_h, replay_h;
+    struct bmi270 sensor = {.i2c_addr = I2C_PRIM_ADDR, .i2c_fd = -1};
+    struct result result, replayed;
+    char path[] = "/tmp/bmi270_trace_XXXXXX";
+    int failed = 0, fd = -1;
+
+    printf("== %s: %s ==\n", scenario->name, scenario->description);
+
+    if (!trace_path)
+    {
+        if ((fd = mkstemp(path)) < 0)
+        {
+            fprintf(stderr, "Could not create a trace file: %s\n", strerror(errno));
+            return 1;
+        }
+
+        close(fd);
+        trace_path = path;
+    }
+
+    bmi270_sim_init(&sim);
+    bmi270_harness_init(&sim_h, &sim);
+    sim_h.bus_hz = scenario->bus_hz ? scenario->bus_hz : HARNESS_BUS_HZ;
+    bmi270_harness_attach(&sim_h, &sensor);
+
+    if (bmi270_harness_record(&sim_h, trace_path) < 0 || run(&sim_h, &sensor, scenario, I2C_DEVICE, &result) < 0)
+    {
+        printf("  FAILED: setup (%s)\n\n", strerror(-sensor.last_error));
+        bmi270_harness_close(&sim_h);
+        return 1;
+    }
+
+    bmi270_harness_close(&sim_h);
+    print_result("sim", &result, &sim_h);
+
+    // Same workload against the trace only: the driver must take the same path
+    memset(&sensor, 0, sizeof(sensor));
+    sensor.i2c_addr = I2C_PRIM_ADDR;
+    sensor.i2c_fd = -1;
+
+    bmi270_harness_init(&replay_h, NULL);
+    bmi270_harness_attach(&replay_h, &sensor);
+
+    if (bmi270_harness_replay(&replay_h, trace_path) < 0 || run(&replay_h, &sensor, scenario, I2C_DEVICE, &replayed) < 0)
+        memset(&replayed, 0xFF, sizeof(replayed));
+
+    bmi270_harness_close(&replay_h);
+
+    // Latency comes from the sim run, everything else must match
+    replayed.max_latency_us = result.max_latency_us;
+    replayed.sum_latency_us = result.sum_latency_us;
+    replayed.last_sample_us = result.last_sample_us;
+    print_result("replay", &replayed, &replay_h);
+
+    if (fd >= 0)
+        unlink(path);
+
+    failed |= expect(result.silent == 0, "samples lost without SAMPLE_GAP");
+    failed |= expect(result.gaps == scenario->gaps, "gaps");
+    failed |= expect(result.recoveries == scenario->recoveries, "recoveries");
+    failed |= expect(result.uploads == scenario->uploads, "config uploads");
+    failed |= expect(!scenario->exact_loss || result.lost == sim_h.overflow_frames + scenario->cut_frames, "samples lost versus frames dropped");
+    failed |= expect(result.state == RECOVERY_OK && result.end_us - result.last_sample_us <= RESUME_US, "streaming at the end");
+    failed |= expect(result.max_latency_us <= scenario->max_latency_us, "worst sample latency");
+    failed |= expect(!scenario->budget_us || (result.wm_violations == 0 && result.wm_min > 1 &&
+                                              result.wm_max - result.wm_min <= (result.wm_max / 8 > 1 ? result.wm_max / 8 : 1)),
+                     "watermark settled within the budget and its hysteresis band");
+    failed |= expect(!scenario->budget_us || (result.wakeups && result.batching == (double)result.samples / result.wakeups),
+                     "batching factor versus frames per wakeup");
+    failed |= expect(replay_h.divergences == 0 && memcmp(&result, &replayed, sizeof(result)) == 0, "replay matches the recorded run");
+
+    printf("  %s\n\n", failed ? "FAIL" : "PASS");
+
+    return failed;
+}
+
+/* Record the workload on a real sensor, faults other than FAULT_RESET still apply */
+static int record_hardware(const struct scenario *scenario, const char *device, const char *trace_path)
+{
+    static struct bmi270_harness h;
+    struct bmi270 sensor = {.i2c_fd = -1};
+    const char *separator = strrchr(device, ':');
+    char bus[64];
+    struct result result;
+    int ret;
+
+    if (separator == NULL || (size_t)(separator - device) >= sizeof(bus))
+    {
+        fprintf(stderr, "Invalid sensor: %s\n", device);
+        return 2;
+    }
+
+    memcpy(bus, device, separator - device);
+    bus[separator - device] = '\0';
+    sensor.i2c_addr = (uint8_t)strtol(separator + 1, NULL, 0);
+
+    // The harness wraps I2C_RDWR on the bus: open it here, bmi270_init_bus skips it for custom transfers
+    if ((sensor.i2c_fd = open(bus, O_RDWR)) < 0)
+    {
+        fprintf(stderr, "Could not open %s: %s\n", bus, strerror(errno));
+        return 2;
+    }
+
+    sensor.owns_fd = 1;
+    bmi270_harness_init(&h, NULL);
+    h.realtime = 1;
+    bmi270_harness_attach(&h, &sensor);
+
+    if ((ret = bmi270_harness_record(&h, trace_path)) < 0 || (ret = run(&h, &sensor, scenario, bus, &result)) < 0)
+        fprintf(stderr, "%s failed: %s\n", device, strerror(-ret));
+    else
+        print_result("hardware", &result, &h);
+
+    bmi270_harness_close(&h);
+    bmi270_close(&sensor);
+
+    return ret < 0;
+}
+
+/* Replay a trace, e.g. recorded on hardware, through the workload */
+static int replay_trace(const struct scenario *scenario, const char *trace_path)
+{
+    static struct bmi270_harness h;
+    struct bmi270 sensor = {.i2c_addr = I2C_PRIM_ADDR, .i2c_fd = -1};
+    struct result result;
+    int ret;
+
+    bmi270_harness_init(&h, NULL);
+    bmi270_harness_attach(&h, &sensor);
+
+    if ((ret = bmi270_harness_replay(&h, trace_path)) < 0 || (ret = run(&h, &sensor, scenario, I2C_DEVICE, &result)) < 0)
+        fprintf(stderr, "Replay failed: %s\n", strerror(-ret));
+    else
+        print_result("replay", &result, &h);
+
+    bmi270_harness_close(&h);
+
+    return ret < 0 || h.divergences != 0;
+}
+
+static void usage(const char *name)
+{
+    fprintf(stderr, "Usage: %s [-l] [-v] [-r trace [-b <bus>:<address>]] [-p trace] [scenario ...]\n"
+                    "  -l                 list scenarios\n"
+                    "  -r trace           record the transactions of one scenario\n"
+                    "  -b bus:address     record on a real sensor instead of the simulated one\n"
+                    "  -p trace           replay a trace through one scenario's workload\n"
+                    "  -v                 driver log output\n"
+                    "Without -r and -p every scenario (default: all) runs on the simulated BMI270 and is replayed from\n"
+                    "its own trace, the exit status is 1 if any check failed.\n", name);
+}
+
+/* ----------------------------------------------------
+                        MAIN
+-----------------------------------------------------*/
+
+// Usage: bmi270_replay (CI), bmi270_replay -r trace.txt -b /dev/i2c-1:0x68 baseline, bmi270_replay -p trace.txt baseline
+int main(int argc, char **argv)
+{
+    const char *record_path = NULL, *replay_path = NULL, *device = NULL;
+    const struct scenario *scenario = &scenarios[0];
+    int failed = 0, opt;
+
+    while ((opt = getopt(argc, argv, "lr:b:p:vh")) != -1)
+    {
+        switch (opt)
+        {
+        case 'l':
+            for (size_t i = 0; i < NUM_SCENARIOS; i++)
+                printf("%-16s %s\n", scenarios[i].name, scenarios[i].description);
+            return 0;
+        case 'r':
+            record_path = optarg;
+            break;
+        case 'b':
+            device = optarg;
+            break;
+        case 'p':
+            replay_path = optarg;
+            break;
+        case 'v':
+            bmi270_set_log_handler(bmi270_log_print, BMI270_LOG_INFO, stderr);
+            break;
+        default:
+            usage(argv[0]);
+            return opt == 'h' ? 0 : 2;
+        }
+    }
+
+    if ((record_path || replay_path) && argc - optind > 1)
+    {
+        usage(argv[0]);
+        return 2;
+    }
+
+    if ((record_path || replay_path) && optind < argc && !(scenario = find_scenario(argv[optind])))
+        return 2;
+
+    if (device && !record_path)
+    {
+        usage(argv[0]);
+        return 2;
+    }
+
+    if (device)
+        return record_hardware(scenario, device, record_path);
+
+    if (replay_path)
+        return replay_trace(scenario, replay_path);
+
+    if (record_path)
+        return run_scenario(scenario, record_path);
+
+    for (size_t i = 0; i < NUM_SCENARIOS; i++)
+    {
+        if (optind == argc)
+            failed |= run_scenario(&scenarios[i], NULL);
+    }
+
+    for (int i = optind; i < argc; i++)
+    {
+        const struct scenario *selected = find_scenario(argv[i]);
+
+        if (!selected)
+            return 2;
+
+        failed |= run_scenario(selected, NULL);
+    }
+
+    return failed;
+}